@@ -0,0 +1,201 @@
+#ifndef ALLOCATIONTRACKER_CPP
+#define ALLOCATIONTRACKER_CPP
+
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <cstdlib>
+#include "allocationTracker.hpp"
+
+namespace
+{
+    const char* const PHASE_NAMES[NUM_ALLOCATION_PHASES] =
+    {"other", "game setup", "game menu", "goods menu", "asset menu", "tax menu", "invasion menu",
+     "grain release", "year-end report", "auto-play", "bot turns", "catching up bots", "standings"};
+    const char* const BUDGET_NAMES[NUM_ALLOCATION_BUDGETS] = {"turn", "game"};
+    const int64_t BUDGETS[NUM_ALLOCATION_BUDGETS] = {TURN_ALLOCATION_BUDGET, GAME_ALLOCATION_BUDGET};
+
+    // everything here gets used from inside operator new, so none of it can allocate (constant initialized, no constructors that run at startup)
+    struct PhaseCounters
+    {
+        std::atomic<int64_t> allocations;
+        std::atomic<int64_t> bytes;
+        std::atomic<int64_t> frees;
+    };
+
+    std::atomic<bool> tracking {false};
+    PhaseCounters counters[NUM_ALLOCATION_PHASES];
+    thread_local AllocationPhase currentPhase = OtherPhase;
+    thread_local bool quiet = false; // set while writing the report
+
+    struct BudgetStats // turns or games measured so far
+    {
+        int64_t count;
+        int64_t allocations; // totals
+        int64_t bytes;
+        int64_t most; // allocations in the worst one
+        int64_t latest;
+        int64_t overBudget;
+    };
+
+    std::mutex budgetLock; // guards budgets (budgets can end on any thread)
+    BudgetStats budgets[NUM_ALLOCATION_BUDGETS];
+
+    void countAllocation(std::size_t size)
+    {
+        if (!tracking.load(std::memory_order_relaxed) || quiet) return;
+        PhaseCounters& phase = counters[currentPhase];
+        phase.allocations.fetch_add(1, std::memory_order_relaxed);
+        phase.bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    void countFree(void* pointer)
+    {
+        if (!pointer || !tracking.load(std::memory_order_relaxed) || quiet) return;
+        counters[currentPhase].frees.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // the standard library's behavior for operator new: keep trying the new handler until it gives up
+    void* allocate(std::size_t size)
+    {
+        countAllocation(size);
+        if (size == 0) size = 1; // every allocation gets its own address
+        void* pointer;
+        while (!(pointer = std::malloc(size)))
+        {
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) throw std::bad_alloc();
+            handler();
+        }
+        return pointer;
+    }
+
+    void release(void* pointer)
+    {
+        countFree(pointer);
+        std::free(pointer);
+    }
+}
+
+/// replaced global allocation functions (every other form of new and delete goes through these)
+
+void* operator new(std::size_t size) {return allocate(size);}
+void* operator new[](std::size_t size) {return allocate(size);}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {return allocate(size);}
+    catch (std::bad_alloc&) {return nullptr;}
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {return allocate(size);}
+    catch (std::bad_alloc&) {return nullptr;}
+}
+
+void operator delete(void* pointer) noexcept {release(pointer);}
+void operator delete[](void* pointer) noexcept {release(pointer);}
+void operator delete(void* pointer, std::size_t) noexcept {release(pointer);}
+void operator delete[](void* pointer, std::size_t) noexcept {release(pointer);}
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {release(pointer);}
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {release(pointer);}
+
+
+/// tracking
+
+void startAllocationTracking()
+{
+    tracking.store(true, std::memory_order_relaxed);
+}
+
+void stopAllocationTracking()
+{
+    tracking.store(false, std::memory_order_relaxed);
+}
+
+bool allocationTrackingEnabled()
+{
+    return tracking.load(std::memory_order_relaxed);
+}
+
+AllocationTally allocationTotals()
+{
+    AllocationTally total {0, 0};
+    for (const PhaseCounters& phase : counters)
+    {
+        total.allocations += phase.allocations.load(std::memory_order_relaxed);
+        total.bytes += phase.bytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void writeAllocationReport(std::ostream& out)
+{
+    quiet = true; // formatting the report allocates too
+
+    out << "\nAllocations by phase:\n"
+        << std::left << std::setw(20) << "Phase" << std::right << std::setw(14) << "Allocations" << std::setw(16) << "Bytes" << std::setw(14) << "Frees" << '\n';
+    int64_t allocations = 0, bytes = 0, frees = 0;
+    for (int p = 0; p < NUM_ALLOCATION_PHASES; ++p)
+    {
+        const PhaseCounters& phase = counters[p];
+        int64_t a = phase.allocations.load(std::memory_order_relaxed), b = phase.bytes.load(std::memory_order_relaxed), f = phase.frees.load(std::memory_order_relaxed);
+        allocations += a;
+        bytes += b;
+        frees += f;
+        if (a == 0 && f == 0) continue; // never ran
+        out << std::left << std::setw(20) << PHASE_NAMES[p] << std::right << std::setw(14) << a << std::setw(16) << b << std::setw(14) << f << '\n';
+    }
+    out << std::left << std::setw(20) << "total" << std::right << std::setw(14) << allocations << std::setw(16) << bytes << std::setw(14) << frees << '\n';
+
+    // budgets
+    std::lock_guard<std::mutex> guard(budgetLock);
+    for (int k = 0; k < NUM_ALLOCATION_BUDGETS; ++k)
+    {
+        const BudgetStats& stats = budgets[k];
+        out << "\nPer " << BUDGET_NAMES[k] << " (budget " << BUDGETS[k] << " allocations): ";
+        if (stats.count == 0)
+        {
+            out << "none measured\n";
+            continue;
+        }
+        out << stats.count << " measured, " << stats.allocations / stats.count << " allocations (" << stats.bytes / stats.count << " bytes) on average, "
+            << stats.most << " at most, " << stats.latest << " in the latest, " << stats.overBudget << " over budget\n";
+    }
+
+    quiet = false;
+}
+
+
+/// phases and budgets
+
+AllocationScope::AllocationScope(AllocationPhase phase) : previous(currentPhase)
+{
+    currentPhase = phase;
+}
+
+AllocationScope::~AllocationScope()
+{
+    currentPhase = previous;
+}
+
+AllocationBudget::~AllocationBudget()
+{
+    if (!allocationTrackingEnabled()) return;
+
+    AllocationTally end = allocationTotals();
+    int64_t allocations = end.allocations - start.allocations; // includes other threads' allocations in the meantime
+    int64_t bytes = end.bytes - start.bytes;
+
+    std::lock_guard<std::mutex> guard(budgetLock);
+    BudgetStats& stats = budgets[kind];
+    ++stats.count;
+    stats.allocations += allocations;
+    stats.bytes += bytes;
+    if (allocations > stats.most) stats.most = allocations;
+    stats.latest = allocations;
+    if (allocations > BUDGETS[kind]) ++stats.overBudget;
+}
+
+#endif // ALLOCATIONTRACKER_CPP
@@ -0,0 +1,84 @@
+#ifndef ALLOCATIONTRACKER_HPP
+#define ALLOCATIONTRACKER_HPP
+
+/*
+Allocation tracker details
+    - Counts every heap allocation the program makes (through the global operator new and delete, which allocationTracker.cpp replaces) while tracking is on
+        - Opt-in: the game only turns it on when started with "--allocations" (see main.cpp), otherwise every allocation costs one extra relaxed load
+        - Aligned allocations (over-aligned types) and anything allocated with malloc() directly don't go through these and aren't counted
+    - Allocations are attributed to the phase of the game they happen in: menus, grain releases, year-end reports, bot turns, and so on
+        - Game flow functions mark their phase with an AllocationScope, nested phases count towards the innermost one only
+        - Phases are per thread, counters are shared by the whole process
+    - Turns and games are measured against allocation budgets (see AllocationBudget), the point being to get the steady state (every turn past the first) down to none
+        - Per-turn and per-game stats: how many were measured, their average and largest allocation counts, the latest one, and how many went over budget
+    - The report comes out as a table once tracking stops (see writeAllocationReport())
+*/
+
+#include <iosfwd>
+#include <cstdint>
+
+namespace /// constant parameters for the allocation tracker
+{
+    const int64_t TURN_ALLOCATION_BUDGET = 0; // allocations allowed in a single town's turn
+    const int64_t GAME_ALLOCATION_BUDGET = 0; // allocations allowed in a whole game once it's set up (every turn's included)
+}
+
+enum AllocationPhase {OtherPhase, SetupPhase, GameMenuPhase, GoodsMenuPhase, AssetMenuPhase, TaxMenuPhase, InvasionMenuPhase,
+                      GrainReleasePhase, YearEndPhase, AutoPlayPhase, BotTurnPhase, CatchUpPhase, StandingsPhase};
+const int NUM_ALLOCATION_PHASES = 13;
+
+enum AllocationBudgetKind {TurnBudget, GameBudget};
+const int NUM_ALLOCATION_BUDGETS = 2;
+
+struct AllocationTally // allocations and bytes counted so far
+{
+    int64_t allocations;
+    int64_t bytes;
+};
+
+/// tracking
+void startAllocationTracking();
+// pre: N/A
+// post: start counting allocations and frees from every thread (adding on to anything counted before)
+void stopAllocationTracking();
+// pre: N/A
+// post: stop counting, keeping everything counted so far
+bool allocationTrackingEnabled();
+// pre: N/A
+// post: return true while allocations are being counted
+
+AllocationTally allocationTotals();
+// pre: N/A
+// post: return the allocations and bytes counted so far across every phase
+
+void writeAllocationReport(std::ostream& out);
+// pre: N/A
+// post: write allocations, bytes, and frees by phase as a table to the stream, followed by the per-turn and per-game stats against their budgets
+// nothing written out gets counted
+
+/// phases and budgets
+class AllocationScope // attributes allocations on this thread to a phase until the end of the scope, going back to the earlier phase afterwards
+{
+private:
+    AllocationPhase previous;
+public:
+    AllocationScope(AllocationPhase phase);
+    ~AllocationScope();
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+};
+
+class AllocationBudget // measures allocations from its construction to the end of the scope as one turn or game
+{
+private:
+    AllocationBudgetKind kind;
+    AllocationTally start;
+public:
+    AllocationBudget(AllocationBudgetKind k) : kind(k), start(allocationTotals()) {}
+    ~AllocationBudget();
+    // post: add the allocations since construction to the per-turn or per-game stats (if tracking is on)
+    AllocationBudget(const AllocationBudget&) = delete;
+    AllocationBudget& operator=(const AllocationBudget&) = delete;
+};
+
+#endif // ALLOCATIONTRACKER_HPP
@@ -0,0 +1,29 @@
+#ifndef BOT_HPP
+#define BOT_HPP
+
+/// computer-controlled player, plays by the same rules as everyone else but keeps track of how it makes its decisions (see botActions())
+
+#include <string>
+#include "player.hpp"
+#include "botSearch.hpp" // search budgets
+
+enum BotStrategy {PolicyStrategy, SearchStrategy}; // policy table lookups (see botPolicy.hpp) or expectimax search (see botSearch.hpp)
+
+class Bot : public Player
+{
+private:
+    BotStrategy strategy;
+    SearchBudget budget; // how long each turn's search gets (only used by searching bots)
+
+public:
+    Bot(GameContext& g, std::string n, std::string tn, BotStrategy s, SearchBudget b = {BOT_THINKING_TIME, 0, BOT_SEARCH_THREADS}) // game, name, town name, strategy, and search budget, everything else assigned randomly like the shortened player constructor
+    : Player(g, n, tn), strategy(s), budget(b) {}
+
+    BotStrategy getStrategy() const {return strategy;}
+    const SearchBudget& getBudget() const {return budget;}
+    void setBudget(SearchBudget b) {budget = b;}
+    // pre: at least one limit set (see SearchBudget)
+    // post: searches for the bot's later turns stop at the new budget
+};
+
+#endif // BOT_HPP
@@ -0,0 +1,131 @@
+#ifndef BOTPOLICY_CPP
+#define BOTPOLICY_CPP
+
+#include <stdexcept>
+#include "botPolicy.hpp"
+#include "botPolicyTable.hpp" // generated tables
+#include "player.hpp"
+#include "releaseSolver.hpp" // grain releases
+#include "weightedSampler.hpp" // invasion targets
+
+namespace
+{
+    // index of the first bucket whose limit is above the value
+    template <typename T>
+    int bucket(int value, const T* limits, int numBuckets)
+    {
+        int index = 0;
+        while (index < numBuckets - 1 && value >= limits[index]) ++index;
+        return index;
+    }
+
+    // spend up to the budget on one asset, making as many purchases as a bot could in a turn
+    void buyAssets(Player& town, int budget, AssetType type)
+    {
+        for (int i = 0; i < BOT_PURCHASES && town.getAssetPrice(type) < budget; ++i)
+        {
+            budget -= town.getAssetPrice(type);
+            town.buyAsset(type);
+        }
+    }
+}
+
+int policyState(const Player& town)
+{
+    int grainPerSerf = town.getSerfs() > 0 ? town.getGrain() / town.getSerfs() : GRAIN_PER_SERF_LIMITS[GRAIN_BUCKETS - 2];
+    int taxLevel = (100 * town.getSales() / MAX_SALES_TAX + 100 * town.getIncome() / MAX_INCOME_TAX + 100 * town.getCustoms() / MAX_CUSTOMS_TAX) / NUM_TAXES;
+    int assets = town.getTotalAssets();
+
+    // combine buckets into a single index, with the years left changing fastest
+    int state = bucket(grainPerSerf, GRAIN_PER_SERF_LIMITS, GRAIN_BUCKETS);
+    state = state * GOLD_BUCKETS + bucket(town.getGold(), GOLD_LIMITS, GOLD_BUCKETS);
+    state = state * TAX_BUCKETS + bucket(taxLevel, TAX_LEVEL_LIMITS, TAX_BUCKETS);
+    state = state * ASSET_BUCKETS + bucket(assets, ASSET_LIMITS, ASSET_BUCKETS);
+    state = state * YEAR_BUCKETS + bucket(town.getYearsLeft(), YEARS_LEFT_LIMITS, YEAR_BUCKETS);
+    return state;
+}
+
+void applyPolicyAction(Player& town, int action)
+{
+    if (action < 0 || action >= NUM_POLICY_ACTIONS) throw std::logic_error("Error: Applying bot policy action that doesn't exist.");
+
+    // every tax gets set to the same share of its maximum
+    int taxLevel = action % NUM_TAX_LEVELS;
+    town.adjustSales(MAX_SALES_TAX * taxLevel / (NUM_TAX_LEVELS - 1));
+    town.adjustIncome(MAX_INCOME_TAX * taxLevel / (NUM_TAX_LEVELS - 1));
+    town.adjustCustoms(MAX_CUSTOMS_TAX * taxLevel / (NUM_TAX_LEVELS - 1));
+
+    // spend up to half the treasury on the investment, or sell off goods
+    PolicyInvestment investment = static_cast<PolicyInvestment>(action / NUM_TAX_LEVELS);
+    int budget = town.getGold() / 2;
+    if (budget <= 0 && investment != SellGrain && investment != SellLand) return; // nothing to spend (buying anything now would mean going into debt)
+
+    int quantity;
+    switch (investment)
+    {
+    case SaveGold:
+        break;
+    case InvestGrain:
+        quantity = town.getGrainPrice() > 0 ? budget / town.getGrainPrice() : GRAIN_PURCHASE_LIMIT; // prices can drift all the way down to nothing
+        if (quantity > GRAIN_PURCHASE_LIMIT) quantity = GRAIN_PURCHASE_LIMIT;
+        if (quantity > 0) town.buyGrain(quantity);
+        break;
+    case InvestLand:
+        quantity = town.getLandPrice() > 0 ? budget / town.getLandPrice() : LAND_PURCHASE_LIMIT; // prices can drift all the way down to nothing
+        if (quantity > LAND_PURCHASE_LIMIT) quantity = LAND_PURCHASE_LIMIT;
+        if (quantity > 0) town.buyLand(quantity);
+        break;
+    case SellGrain:
+        quantity = (town.getGrain() - MIN_GRAIN) / 2;
+        if (quantity > GRAIN_PURCHASE_LIMIT) quantity = GRAIN_PURCHASE_LIMIT; // same limit as buying
+        if (quantity > 0) town.sellGrain(quantity);
+        break;
+    case SellLand:
+        quantity = (town.getLand() - MIN_LAND) / 2;
+        if (quantity > LAND_PURCHASE_LIMIT) quantity = LAND_PURCHASE_LIMIT;
+        if (quantity > 0) town.sellLand(quantity);
+        break;
+    case InvestSoldiers:
+        quantity = town.getSoldierPrice() > 0 ? budget / town.getSoldierPrice() : SOLDIER_PURCHASE_LIMIT;
+        if (quantity > SOLDIER_PURCHASE_LIMIT) quantity = SOLDIER_PURCHASE_LIMIT;
+        if (quantity > 0) town.buySoldiers(quantity);
+        break;
+    default: // one of the asset investments
+        buyAssets(town, budget, static_cast<AssetType>(investment - InvestAsset));
+        break;
+    }
+}
+
+int policyAction(const Player& town)
+{
+    return BOT_POLICY[town.getDifficulty() - 1][policyState(town)];
+}
+
+void applyRelease(Player& town, ReleaseChoice release)
+{
+    if (release == MaximumRelease)
+    {
+        town.releaseGrain(town.maxRelease());
+        return;
+    }
+
+    thread_local ReleaseSolver solver; // keeps its buffers between turns
+    town.releaseGrain(solver.solve(town, releaseObjective(town, releaseHorizon(town))));
+}
+
+Player* invasionTarget(const Player& invader, const std::vector<Player*>& towns)
+{
+    thread_local AliasTable odds; // keeps its buffers between invasions
+    odds.resize(towns.size());
+    for (int i = 0; i < odds.size(); ++i)
+    {
+        const Player* town = towns[i];
+        bool attackable = town != &invader && !town->gameEnded();
+        odds.setWeight(i, attackable ? static_cast<double>(town->getLand()) / (town->getSoldiers() + 1) : 0);
+    }
+
+    if (odds.totalWeight() <= 0) return nullptr;
+    return towns[odds.draw(currentContext())];
+}
+
+#endif // BOTPOLICY_CPP
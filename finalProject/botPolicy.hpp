@@ -0,0 +1,80 @@
+#ifndef BOTPOLICY_HPP
+#define BOTPOLICY_HPP
+
+/*
+Bot policy details
+    - Bots make their economic decisions (purchases and tax rates) by looking up the best action for their town's current state in a table
+    - Town states are discretized into buckets along five stats:
+        - Grain per serf, gold in the treasury, tax level (average share of each tax's maximum), total assets owned, and years left before the ruler dies
+    - Actions combine one investment (save, buy grain, land, one of the four assets, or soldiers, or sell grain or land) with one tax level (low, medium, high)
+        - Searching bots (see botSearch.hpp) choose from the same actions
+    - The table is built offline by policyBuilder (see policyBuilder.cpp) and kept in botPolicyTable.hpp, one table per difficulty
+        - The builder plays through many towns with random actions to measure how actions move towns between states and change their score
+            - Towns start from states spread over every bucket as well as from the opening, and the few states none of them reach copy the nearest one that was
+        - Then runs value iteration on those measurements to get the action with the best expected long-term score for every state
+    - Grain releases aren't part of the table since the release solver already picks them exactly (see releaseSolver.hpp)
+        - Searching bots can also choose to release as much as they're allowed
+    - Invasion targets get picked at random, weighted towards towns with the most land per defending soldier (see weightedSampler.hpp)
+*/
+
+#include <vector>
+#include "parameters.hpp"
+
+class Player;
+
+/// actions
+enum PolicyInvestment {SaveGold, InvestGrain, InvestLand, InvestAsset, SellGrain = InvestAsset + NUM_ASSETS, SellLand, InvestSoldiers}; // one asset investment per asset type, in registry order (InvestAsset + AssetType)
+const int8 NUM_INVESTMENTS = InvestSoldiers + 1;
+const int8 NUM_TAX_LEVELS = 3; // taxes set to 0%, 50%, or 100% of their maximum rates
+const int8 NUM_POLICY_ACTIONS = NUM_INVESTMENTS * NUM_TAX_LEVELS; // action index is (investment * NUM_TAX_LEVELS + tax level)
+const int8 DEFAULT_POLICY_ACTION = SaveGold * NUM_TAX_LEVELS + 1; // save gold, medium taxes (what the builder starts every state at)
+
+/// states
+// upper limits of each bucket except the last (a stat goes into the first bucket whose limit is above it)
+const int8 GRAIN_BUCKETS = 8;
+const int16 GRAIN_PER_SERF_LIMITS[GRAIN_BUCKETS - 1] = {2, 4, 6, 8, 12, 20, 40};
+const int8 GOLD_BUCKETS = 8;
+const int GOLD_LIMITS[GOLD_BUCKETS - 1] = {0, 1000, 2500, 5000, 10000, 25000, 100000};
+const int8 TAX_BUCKETS = 4;
+const int16 TAX_LEVEL_LIMITS[TAX_BUCKETS - 1] = {25, 50, 75}; // average percentage of each tax's maximum rate
+const int8 ASSET_BUCKETS = 4;
+const int16 ASSET_LIMITS[ASSET_BUCKETS - 1] = {1, 4, 10};
+const int8 YEAR_BUCKETS = 8;
+const int16 YEARS_LEFT_LIMITS[YEAR_BUCKETS - 1] = {2, 4, 6, 10, 15, 20, 30};
+const int NUM_POLICY_STATES = GRAIN_BUCKETS * GOLD_BUCKETS * TAX_BUCKETS * ASSET_BUCKETS * YEAR_BUCKETS;
+
+int policyState(const Player& town);
+// pre: player object initialized
+// post: return the index of the town's current state (between 0 and NUM_POLICY_STATES - 1)
+
+void applyPolicyAction(Player& town, int action);
+// pre: player object initialized, game hasn't ended for the player, valid action index
+// post: set every tax rate to the action's tax level and spend up to half the treasury on the action's investment (never going into debt)
+// sales get rid of half of what the town has above the minimum it has to keep
+
+int policyAction(const Player& town);
+// pre: player object initialized
+// post: return the table's action for the town's current state and difficulty
+// constant time lookup
+
+/// full turn decisions
+enum ReleaseChoice {SolverRelease, MaximumRelease};
+const int8 NUM_RELEASE_CHOICES = 2;
+
+struct BotDecision // everything a bot decides in a turn (aside of invasions)
+{
+    int action; // policy action index
+    ReleaseChoice release;
+};
+
+void applyRelease(Player& town, ReleaseChoice release);
+// pre: player object initialized, game hasn't ended for the player
+// post: release the amount of grain picked by the release solver (planning for the score when the game can end soonest) or the most the town is allowed to
+
+/// invasions
+Player* invasionTarget(const Player& invader, const std::vector<Player*>& towns);
+// pre: player objects initialized
+// post: return a random town for the invader to attack, with odds by land per defending soldier, nullptr if there's nobody to attack
+// the invader itself and towns whose games have ended never get picked
+
+#endif // BOTPOLICY_HPP
@@ -0,0 +1,1047 @@
+#ifndef BOTPOLICYTABLE_HPP
+#define BOTPOLICYTABLE_HPP
+
+// generated by policyBuilder from 4000000 simulated years per difficulty (seed 2018), don't edit by hand
+// towns reached at least 100.0% of the states on every difficulty, the rest copy the nearest state that was reached
+// best policy action for every town state on each difficulty (see botPolicy.hpp)
+// only holds for the year-end rules and bot actions it was simulated with, so rebuild it along with any change to them
+
+#include "botPolicy.hpp"
+
+constexpr int8 BOT_POLICY[MAX_DIFFICULTY][NUM_POLICY_STATES] =
+{
+    { // difficulty 1
+        25,22,24,24,24,9,18,20,8,2,2,2,27,5,21,24,18,19,11,17,23,29,0,11,10,29,8,4,7,2,28,19,
+        22,20,20,25,25,24,17,4,8,9,17,5,21,6,4,14,17,20,22,11,29,23,8,2,7,29,2,11,28,8,8,16,
+        21,14,24,25,24,15,8,17,19,21,6,21,23,14,3,5,17,14,4,17,23,5,2,23,20,16,4,1,17,2,10,8,
+        29,23,25,15,23,11,20,11,7,17,2,6,20,6,23,11,28,24,13,20,11,6,2,19,29,17,14,1,4,20,29,7,
+        27,23,8,23,26,20,14,8,2,27,28,1,1,20,23,17,0,4,8,8,9,17,2,1,1,18,11,22,16,15,13,11,
+        4,26,17,11,29,1,20,11,6,21,20,28,11,2,28,23,19,13,11,1,17,1,20,28,22,12,29,23,4,28,19,19,
+        20,8,26,20,11,17,29,2,4,3,29,5,29,20,19,11,13,10,21,11,10,22,10,20,12,12,13,22,10,10,10,8,
+        18,11,26,8,14,3,23,23,20,22,5,28,28,23,20,17,0,1,11,8,1,7,23,14,11,12,29,1,13,7,4,23,
+        8,5,23,29,23,16,17,22,13,28,10,22,23,5,20,17,2,2,7,16,27,4,11,10,5,28,23,28,28,27,19,5,
+        5,14,23,2,20,26,20,4,15,9,22,4,12,11,10,17,15,10,8,13,5,28,5,5,22,0,6,28,28,7,10,19,
+        17,20,23,22,20,22,2,25,3,11,5,15,21,10,9,2,4,16,10,28,27,28,29,10,21,15,29,29,17,12,16,1,
+        7,20,5,2,23,13,14,14,14,0,29,11,10,11,10,17,13,9,5,5,16,4,29,5,21,15,8,28,28,19,16,29,
+        8,1,16,19,21,2,21,18,27,16,8,0,13,11,13,11,6,23,6,2,9,23,9,11,9,28,8,29,2,23,4,28,
+        6,5,18,20,19,21,26,15,12,17,4,18,6,29,9,12,3,0,9,5,18,28,11,10,20,28,0,20,28,17,28,28,
+        20,17,2,16,18,20,19,16,28,5,29,6,21,10,13,9,8,5,3,28,9,13,10,9,18,27,29,14,28,7,29,4,
+        6,15,21,2,23,23,7,15,0,27,21,0,2,18,10,10,10,29,29,0,1,28,10,13,4,6,14,28,28,2,7,28,
+        20,21,8,21,1,4,23,11,22,0,21,22,15,1,11,13,21,17,19,20,1,10,29,9,19,21,3,29,28,28,29,29,
+        27,1,17,21,22,8,23,11,6,28,18,3,14,14,16,10,21,11,13,11,14,10,10,12,16,29,29,28,29,11,13,8,
+        15,1,7,22,4,22,22,14,28,12,18,13,22,1,10,12,21,14,0,7,28,14,11,14,9,11,29,28,28,29,28,3,
+        17,3,4,7,6,2,29,23,6,3,3,21,6,12,9,13,20,10,28,14,11,18,10,14,19,18,5,28,29,28,29,27,
+        17,3,8,29,7,27,27,17,5,20,19,7,8,16,12,9,14,21,4,29,13,12,29,16,11,15,3,27,9,7,28,29,
+        8,6,5,6,21,0,3,16,11,27,5,3,27,27,20,5,6,16,4,29,19,18,9,19,27,16,27,15,28,16,13,3,
+        12,7,6,5,3,4,8,4,12,19,0,28,8,18,12,9,19,27,12,0,16,11,20,13,9,29,8,6,29,13,7,7,
+        15,6,28,6,0,23,27,15,27,22,3,22,5,19,18,20,13,6,0,19,28,29,18,19,13,14,27,16,27,8,27,4,
+        8,27,6,4,5,27,2,2,6,21,4,5,3,5,15,18,18,22,7,7,27,5,19,15,10,2,23,19,5,13,6,8,
+        22,6,29,3,0,27,29,6,13,23,29,7,8,28,6,13,11,9,16,4,29,7,12,15,8,1,5,4,8,8,16,12,
+        8,9,3,8,27,7,6,6,0,16,7,4,28,4,27,19,19,6,17,7,8,8,18,12,9,14,4,3,7,17,6,27,
+        28,0,3,7,5,26,3,6,18,15,29,5,7,2,3,6,8,16,12,28,6,5,20,19,20,29,19,7,15,7,17,18,
+        10,6,6,8,6,25,4,7,16,6,21,8,4,3,5,7,22,6,29,3,5,18,11,16,2,7,22,0,15,5,28,16,
+        14,23,5,21,4,0,4,6,1,7,21,5,29,27,3,8,7,14,26,9,24,20,15,18,26,7,6,3,3,23,7,4,
+        3,1,26,5,1,7,0,23,23,27,5,4,28,8,10,5,4,10,0,4,7,18,9,10,10,18,13,8,13,4,6,6,
+        7,29,27,5,6,6,6,29,19,15,2,3,7,4,20,4,6,7,9,3,18,16,12,16,6,16,20,12,15,7,25,15,
+        22,11,22,24,21,25,25,24,5,1,13,1,2,18,11,11,12,29,27,16,13,17,16,17,14,5,29,19,16,16,4,2,
+        23,0,5,22,24,25,25,24,2,24,2,15,3,27,5,2,9,19,11,7,20,20,20,14,24,8,11,20,4,7,19,29,
+        10,19,6,21,24,21,14,17,18,29,8,1,21,6,23,21,2,17,11,8,29,17,13,2,16,29,17,20,1,5,16,5,
+        3,18,22,22,22,23,24,21,23,25,24,11,16,14,11,26,28,20,11,0,13,16,20,17,13,19,13,11,11,2,13,14,
+        15,17,24,25,2,20,17,8,11,9,22,16,3,6,20,14,10,8,13,17,2,7,10,2,3,27,29,28,27,10,6,27,
+        5,15,16,17,17,26,5,29,12,26,1,12,5,3,5,14,6,27,2,1,2,19,29,5,8,18,15,5,5,16,8,10,
+        6,22,22,5,21,20,18,17,1,1,1,28,13,14,8,4,23,7,20,8,19,7,4,14,9,4,8,19,11,8,10,13,
+        29,12,11,21,19,24,24,5,29,23,11,5,3,2,27,17,19,4,9,11,17,0,1,17,21,9,2,15,29,6,17,7,
+        4,1,2,29,5,17,2,19,15,16,26,4,28,14,10,20,0,25,19,6,3,28,28,2,25,15,29,1,6,3,9,19,
+        13,14,23,17,13,17,20,20,6,6,29,16,28,14,2,17,6,5,17,6,9,10,5,0,7,10,7,14,28,11,10,11,
+        17,23,14,1,21,20,16,13,13,7,21,22,12,29,17,11,1,18,3,10,5,28,29,5,6,3,2,29,2,2,28,7,
+        23,3,14,16,8,5,2,17,11,23,15,15,28,5,10,20,1,14,28,8,29,8,6,19,7,6,12,28,5,2,14,3,
+        6,17,5,15,15,17,8,13,6,3,16,28,18,15,13,11,2,4,8,29,4,20,10,14,24,9,9,9,0,6,3,12,
+        18,0,19,16,19,18,0,5,26,3,5,6,16,20,11,9,7,9,10,6,13,12,13,29,3,6,18,0,4,8,4,15,
+        1,8,17,2,19,16,19,23,14,0,26,16,15,12,11,11,9,9,28,11,5,28,11,11,14,12,29,28,28,28,7,8,
+        2,15,6,16,20,18,8,7,24,10,12,16,18,11,11,17,17,1,1,28,18,2,10,1,1,28,9,28,27,9,15,8,
+        19,27,17,0,24,3,6,6,28,2,0,6,0,14,13,10,4,3,3,19,18,16,12,14,2,2,27,15,9,18,27,28,
+        14,16,4,8,1,21,16,29,3,26,29,6,8,9,20,12,5,28,14,18,3,28,20,14,14,7,6,28,12,27,3,9,
+        14,9,17,0,0,4,1,4,16,1,6,0,3,11,12,10,8,16,29,12,19,11,11,13,23,14,29,12,12,29,28,29,
+        27,24,3,5,6,4,6,6,18,12,1,1,20,9,14,11,12,29,28,12,1,29,10,11,19,15,29,28,29,28,27,13,
+        19,4,6,4,1,1,27,7,19,3,4,6,3,10,9,16,24,16,9,27,9,13,13,13,6,11,4,6,15,28,27,3,
+        27,21,4,7,4,3,7,17,29,3,8,28,6,9,13,19,25,9,3,14,15,12,18,18,26,3,1,6,13,18,12,4,
+        3,27,8,4,6,7,1,29,2,0,6,19,27,27,18,12,12,6,5,5,4,11,20,15,7,27,6,29,28,29,13,9,
+        17,23,22,5,28,6,3,8,20,19,7,1,29,7,19,14,5,10,27,7,12,16,18,9,7,17,28,29,16,28,28,15,
+        13,12,0,7,7,7,5,6,17,10,25,5,1,8,6,8,22,21,23,10,15,16,15,15,6,12,19,12,6,6,4,4,
+        8,1,19,8,6,0,6,6,17,28,29,4,5,19,4,6,22,12,29,0,6,12,15,16,0,4,22,5,4,3,6,5,
+        29,8,29,8,27,6,3,16,15,25,5,29,9,6,8,17,1,18,6,7,4,14,18,15,29,9,24,5,3,8,8,19,
+        8,15,7,24,6,6,6,6,7,24,21,6,4,15,6,4,7,23,23,3,3,4,6,12,7,17,8,5,6,27,4,3,
+        22,27,21,23,7,2,3,4,8,23,11,8,6,27,4,7,7,7,7,6,4,19,18,19,15,12,27,8,6,4,8,8,
+        22,29,20,0,3,3,28,28,9,28,1,7,4,29,8,4,25,15,6,10,9,3,9,20,4,14,4,3,16,6,19,5,
+        24,1,8,3,5,22,5,8,13,20,21,28,4,2,3,4,7,8,27,3,7,10,14,20,1,6,16,17,0,8,4,0,
+        27,3,28,8,3,4,7,5,4,23,20,7,1,4,28,28,2,18,15,0,15,14,12,12,6,0,10,12,27,8,7,5,
+        29,22,25,25,21,24,26,26,8,13,29,11,4,20,11,29,15,13,10,11,8,11,2,11,16,28,28,1,28,28,19,28,
+        17,23,26,24,26,24,26,26,15,7,28,11,28,5,2,25,18,11,29,11,5,20,2,2,25,17,5,20,28,8,29,20,
+        15,24,21,23,21,6,23,25,11,20,11,25,8,12,20,25,4,17,2,2,8,2,16,8,4,5,14,5,5,2,5,11,
+        1,26,2,24,24,25,25,24,23,20,2,16,19,2,11,27,9,17,17,17,14,4,11,17,21,11,14,20,2,7,20,13,
+        17,29,24,29,8,24,2,5,27,7,28,20,19,14,2,11,27,1,19,19,29,18,28,1,10,5,28,4,3,1,9,3,
+        24,16,20,14,29,11,14,11,29,16,2,13,19,11,20,17,18,11,29,10,14,19,13,14,12,9,20,28,9,16,16,17,
+        5,5,24,8,20,22,5,8,21,23,4,4,17,29,0,11,8,16,29,11,28,16,10,5,13,16,7,2,19,4,13,6,
+        24,23,17,14,14,25,20,26,4,1,18,10,19,16,20,16,6,13,17,4,16,29,28,7,16,28,16,28,28,1,28,1,
+        27,26,4,13,5,14,14,20,16,21,7,29,7,11,11,11,9,18,17,20,9,28,18,11,22,12,27,28,7,6,6,12,
+        24,17,2,1,14,2,19,16,14,10,13,19,16,11,11,11,21,16,3,10,5,28,28,29,9,9,2,1,16,7,27,10,
+        23,17,14,19,5,14,20,16,8,19,1,2,28,12,2,8,4,15,11,11,29,20,10,11,2,11,28,4,28,8,1,1,
+        23,17,14,1,14,14,17,14,17,23,13,13,16,29,11,2,0,2,7,11,4,28,9,17,12,8,8,5,6,5,13,29,
+        16,20,16,7,18,1,2,19,1,18,15,16,14,12,11,10,0,4,11,6,28,12,29,12,20,5,9,27,6,28,28,6,
+        1,18,1,7,15,16,8,8,1,4,2,8,15,10,13,10,25,21,7,28,28,29,9,14,7,23,28,28,28,29,13,28,
+        14,18,1,18,19,13,29,15,14,18,29,29,12,11,10,9,18,1,9,8,29,11,10,13,14,28,29,29,28,17,28,28,
+        20,27,1,16,5,19,8,8,25,15,17,7,14,14,11,11,14,12,3,29,29,28,11,9,11,29,7,4,9,29,28,4,
+        10,8,19,15,3,0,4,7,25,28,10,0,6,18,10,14,3,0,5,3,28,12,13,9,6,18,4,28,28,28,28,9,
+        2,5,1,2,1,3,8,7,20,22,4,16,12,10,10,10,0,6,14,29,29,29,19,10,16,28,28,28,28,29,27,28,
+        10,16,8,7,3,6,8,19,1,14,12,3,19,0,9,14,22,6,28,11,9,14,15,9,29,29,15,28,12,14,29,28,
+        26,6,25,16,16,0,3,5,4,3,18,1,6,10,10,10,15,1,8,9,28,29,9,29,29,28,29,29,28,28,28,28,
+        10,6,1,2,28,27,8,8,14,21,9,27,6,7,18,18,14,23,29,28,27,28,18,19,11,18,3,6,27,27,27,6,
+        5,6,1,5,6,8,7,15,1,27,15,27,6,6,12,19,13,15,29,28,18,6,18,13,28,18,18,27,18,3,27,27,
+        29,27,3,6,27,21,8,19,20,2,0,6,3,3,19,17,15,14,4,6,10,6,19,13,2,15,8,15,28,20,15,28,
+        18,29,5,1,3,7,6,15,28,7,6,3,6,3,6,16,23,15,6,27,29,19,15,19,3,27,3,27,27,18,27,27,
+        15,5,3,3,7,3,6,8,19,23,6,4,8,6,7,6,14,21,27,7,3,3,15,15,29,21,15,3,3,3,15,6,
+        4,7,28,6,6,3,6,6,10,22,27,6,7,5,6,6,23,21,7,6,6,7,6,6,9,0,4,6,6,3,6,6,
+        2,22,3,7,6,29,6,0,2,8,7,4,4,7,4,4,8,12,15,8,8,10,16,15,22,22,16,17,6,29,16,7,
+        1,7,6,4,6,6,6,8,1,7,7,6,4,6,7,8,27,23,16,6,6,6,16,15,28,21,3,6,6,6,6,3,
+        10,8,3,23,5,3,6,7,25,28,29,5,4,6,7,3,1,21,22,8,3,21,17,17,22,22,4,23,6,5,21,3,
+        5,25,8,2,21,23,3,4,2,23,23,8,27,7,7,4,23,12,1,22,21,8,15,17,27,21,10,22,21,23,4,5,
+        7,8,6,7,0,1,23,5,8,8,21,3,21,23,13,21,1,12,15,1,5,17,15,4,16,17,0,4,5,21,0,13,
+        10,23,7,2,24,6,3,3,23,7,22,5,5,5,4,3,28,23,22,21,22,20,12,15,22,29,21,21,7,6,4,3,
+        3,21,24,24,26,24,25,26,7,10,14,17,16,20,2,29,1,9,2,5,17,5,17,17,3,14,28,16,16,13,14,19,
+        9,22,26,26,25,24,24,24,20,20,29,5,2,18,9,25,22,5,7,8,13,11,27,29,13,29,8,12,2,2,27,28,
+        17,6,4,24,21,12,10,22,7,18,5,17,16,11,18,24,7,17,2,14,14,14,20,20,15,4,20,14,5,8,20,29,
+        21,5,24,27,24,25,24,23,29,7,3,10,20,11,25,26,20,8,28,4,4,10,9,29,27,2,28,4,19,10,20,16,
+        22,23,8,11,25,24,8,8,15,14,4,16,17,10,2,14,17,28,16,29,7,19,0,16,23,19,28,27,28,9,1,28,
+        5,29,10,26,29,28,14,11,18,27,9,25,16,8,29,11,8,20,20,20,13,4,8,20,18,20,9,16,2,13,17,13,
+        1,11,10,8,8,8,2,14,9,5,19,28,2,22,16,17,22,16,28,14,17,28,4,17,19,7,19,8,29,5,10,29,
+        29,17,1,2,25,11,11,23,23,5,5,13,8,5,27,25,11,1,1,28,12,28,14,20,19,10,5,1,14,28,28,8,
+        17,13,0,16,16,17,20,17,27,29,4,28,15,15,11,20,16,23,1,10,17,8,28,29,15,0,1,12,15,3,9,6,
+        16,17,16,17,19,13,2,14,0,1,10,16,19,11,10,11,17,1,14,6,3,0,7,2,27,9,20,5,6,12,4,10,
+        17,13,17,16,11,11,4,13,0,22,4,7,17,29,17,10,23,7,28,2,29,28,11,13,6,29,5,4,8,20,18,28,
+        23,14,2,1,14,20,2,16,11,21,14,12,17,20,11,11,2,9,12,2,19,14,16,2,3,28,20,1,14,5,28,29,
+        10,15,16,15,4,15,15,5,14,19,28,16,8,0,10,11,4,0,6,8,6,28,12,9,10,3,7,28,9,0,3,28,
+        5,18,0,16,18,17,17,8,1,12,15,0,14,12,14,9,19,3,29,29,28,28,11,9,19,6,0,5,3,3,10,28,
+        2,20,1,16,0,16,14,5,29,23,7,16,17,9,16,20,6,29,1,10,13,10,14,11,14,29,28,28,11,29,28,4,
+        10,0,17,2,19,1,8,4,9,17,18,6,18,29,11,10,1,19,9,19,29,29,9,9,17,29,29,29,3,29,9,11,
+        18,5,1,6,6,2,7,5,8,6,2,3,0,13,9,9,11,29,14,29,6,3,29,11,0,21,29,27,28,29,6,28,
+        17,0,4,5,6,5,0,14,0,29,17,1,15,10,11,11,18,29,28,12,10,10,9,9,19,28,28,28,27,28,28,28,
+        17,5,5,4,0,5,5,7,18,3,1,15,18,9,13,3,19,29,29,11,14,10,11,14,7,28,27,4,13,20,28,29,
+        10,0,21,0,15,1,8,6,15,3,2,4,0,19,11,10,22,29,13,29,29,29,28,9,14,29,28,28,28,27,28,29,
+        12,27,6,27,6,28,8,29,8,8,19,6,3,6,7,16,17,18,9,6,18,9,20,13,17,3,1,27,3,3,27,27,
+        14,5,6,6,28,3,28,5,22,12,6,0,6,7,13,3,16,29,19,6,28,11,18,17,28,23,11,6,27,6,27,27,
+        19,0,29,3,5,7,29,6,17,26,0,7,1,3,18,4,20,16,15,29,9,9,9,10,9,2,12,4,3,27,4,5,
+        13,3,23,3,28,28,7,18,2,27,7,7,3,15,27,12,28,3,18,29,6,27,28,18,29,29,16,3,28,27,3,27,
+        9,7,6,3,4,4,4,7,0,7,7,7,7,8,4,8,15,4,2,6,5,6,12,15,13,23,4,3,3,3,4,3,
+        27,6,7,6,27,3,6,5,26,6,21,6,8,29,6,4,26,23,1,6,6,4,17,15,26,21,6,6,3,5,6,3,
+        6,23,3,7,3,26,7,29,16,25,18,2,2,4,3,6,19,12,6,15,8,15,4,11,7,6,5,7,19,1,5,3,
+        17,3,7,7,5,8,8,8,12,23,4,4,7,3,5,7,10,23,19,4,6,10,15,3,18,14,27,6,27,6,3,3,
+        14,3,3,5,5,4,3,5,22,0,6,25,4,5,5,4,26,21,22,6,3,3,18,5,8,21,21,21,3,8,4,3,
+        28,23,23,26,4,3,5,5,5,21,27,3,5,4,4,3,15,23,1,3,3,3,5,3,23,1,9,21,4,3,4,4,
+        23,2,29,3,5,3,4,5,12,8,4,3,5,3,27,5,24,7,4,4,5,3,5,5,12,28,3,3,4,4,5,5,
+        10,22,6,5,3,5,5,5,15,22,23,4,4,4,5,4,28,17,4,7,3,6,12,3,27,23,21,4,3,7,4,5,
+        28,13,24,24,26,25,25,25,6,8,28,10,5,17,20,11,23,8,16,13,20,11,8,4,14,14,19,7,4,10,19,16,
+        12,25,24,24,25,25,24,26,18,2,2,11,3,20,1,14,1,16,5,29,27,2,14,8,27,8,29,13,4,20,11,28,
+        27,25,18,25,26,26,7,27,28,3,14,13,18,27,19,8,22,20,13,17,11,29,8,5,6,2,10,19,10,17,17,4,
+        22,11,25,26,24,24,26,24,27,29,29,13,18,20,8,25,10,2,29,20,0,20,17,11,12,2,11,16,5,11,11,5,
+        12,5,21,17,5,29,11,11,11,28,4,10,7,17,5,14,7,8,27,6,1,5,17,7,16,8,27,28,18,3,28,18,
+        8,24,29,14,20,11,20,11,14,16,4,29,7,5,13,14,2,3,14,10,7,17,2,17,14,27,13,2,2,28,16,16,
+        28,24,2,29,5,8,14,5,7,6,19,8,19,2,0,2,15,7,8,10,27,29,20,29,16,17,0,11,5,10,4,8,
+        3,14,21,4,25,26,20,17,20,0,29,19,2,1,17,20,8,16,20,29,14,14,8,11,17,3,2,28,5,13,1,20,
+        21,14,8,2,13,17,5,11,22,9,5,1,28,8,17,17,28,28,28,11,1,13,11,10,8,15,18,3,3,2,0,12,
+        22,20,14,13,14,20,17,20,28,8,13,19,1,17,11,11,17,28,11,11,29,7,10,5,4,11,11,13,8,2,28,4,
+        28,24,11,20,2,15,7,20,14,15,29,10,15,19,11,10,6,28,9,28,28,11,0,10,15,9,17,29,29,4,4,28,
+        21,13,17,8,14,14,20,17,13,15,2,1,16,17,11,2,6,3,8,19,12,10,11,10,14,4,10,20,8,8,4,16,
+        7,8,13,19,16,19,17,16,21,12,7,16,28,9,11,11,16,29,18,12,28,28,5,10,16,9,27,9,12,6,3,0,
+        13,20,8,5,18,0,19,4,19,18,15,20,4,20,11,11,14,28,3,17,29,29,28,29,13,18,6,29,28,29,28,28,
+        27,0,8,8,15,17,0,5,22,7,9,18,3,13,10,9,2,29,3,28,29,29,9,10,27,6,12,8,27,28,18,12,
+        22,16,19,2,20,2,17,8,22,29,2,18,29,20,11,11,28,9,3,11,29,17,10,11,13,7,27,11,28,28,28,29,
+        13,7,1,5,1,0,4,2,1,4,16,3,10,9,9,13,0,17,6,12,5,9,14,10,21,8,27,6,28,28,6,27,
+        18,15,3,1,6,5,2,8,12,5,29,6,8,9,14,11,23,2,28,10,28,29,29,9,23,28,0,27,29,28,28,28,
+        12,17,2,7,0,2,5,14,16,9,0,19,12,1,10,10,12,17,28,4,29,9,11,9,12,29,29,29,28,4,28,29,
+        23,5,1,7,8,8,0,0,4,5,12,8,9,9,11,10,21,9,6,27,9,13,28,13,13,28,28,28,28,28,28,28,
+        27,8,3,8,4,8,8,19,7,8,27,29,6,18,18,12,29,18,19,6,18,18,18,18,12,24,16,3,27,3,28,6,
+        7,2,5,3,7,7,3,8,15,27,27,6,6,7,15,13,28,28,3,6,15,18,6,18,4,10,27,6,27,28,15,27,
+        12,3,7,4,1,0,6,19,23,8,6,17,4,27,19,20,0,18,27,18,4,29,12,15,16,27,6,18,28,28,27,4,
+        22,27,28,5,28,7,6,29,20,6,0,2,8,7,18,13,29,3,9,6,18,19,18,12,23,19,12,3,3,3,27,18,
+        9,7,28,4,8,3,5,6,6,24,3,8,8,8,3,15,14,6,7,3,4,7,16,18,20,3,6,6,6,3,6,6,
+        2,6,3,7,27,3,8,6,16,6,27,6,6,8,6,6,21,22,6,6,7,17,16,17,7,3,4,6,3,6,3,6,
+        6,3,6,29,2,7,5,3,11,10,27,3,6,5,14,28,8,7,3,6,17,5,16,16,6,5,6,5,18,20,5,29,
+        12,28,4,7,3,6,8,6,27,23,8,8,3,7,4,3,16,21,6,3,4,7,6,17,11,21,6,6,6,6,6,6,
+        29,5,6,6,7,5,5,3,8,23,0,5,5,6,4,5,2,11,16,29,3,13,19,15,20,6,7,3,5,7,4,6,
+        8,6,8,8,8,3,3,3,17,17,7,8,3,5,5,4,12,19,22,3,4,15,19,20,22,6,26,4,4,5,3,6,
+        23,3,7,4,7,28,1,3,7,15,5,3,2,27,3,5,1,9,5,8,7,7,12,10,8,0,2,3,3,4,4,3,
+        26,5,3,5,24,5,4,4,15,0,8,3,27,4,4,5,29,22,23,4,4,3,19,17,22,24,2,4,3,3,3,3,
+        23,15,29,26,19,25,17,14,23,19,1,29,1,29,11,8,3,19,3,29,8,13,8,2,23,7,1,5,16,9,15,1,
+        23,23,25,20,5,24,24,26,23,24,11,11,28,11,29,14,21,14,29,4,5,5,20,16,23,13,14,13,11,11,5,20,
+        29,21,15,24,24,1,9,20,24,1,5,6,27,17,5,26,23,6,16,20,8,19,5,7,18,8,10,10,7,4,11,4,
+        16,22,15,4,27,26,24,24,21,1,9,26,1,19,18,26,22,14,8,29,5,9,2,9,27,28,10,10,17,1,3,16,
+        2,11,17,17,4,9,19,2,29,19,11,28,4,4,20,2,29,8,13,12,28,18,6,29,7,5,14,0,9,3,13,7,
+        14,4,25,29,13,5,20,5,23,0,1,8,5,11,29,14,8,8,20,28,13,8,8,20,23,17,6,8,5,29,28,28,
+        19,2,19,29,11,6,7,14,4,13,16,5,5,20,14,11,8,29,4,13,19,19,28,10,3,18,18,8,19,7,29,7,
+        17,19,4,24,9,26,8,14,28,28,28,16,13,10,5,19,15,12,1,15,7,12,4,10,21,5,29,4,4,2,4,19,
+        22,25,2,8,13,17,14,5,21,8,23,16,8,0,10,10,4,4,17,15,1,27,11,10,22,3,9,0,7,3,13,19,
+        15,8,20,20,17,14,14,17,22,25,4,14,17,2,11,8,1,29,28,17,27,13,12,0,12,28,18,29,2,18,28,28,
+        29,9,15,11,17,16,17,16,20,4,4,18,20,29,2,10,8,7,2,11,17,10,12,14,13,3,27,8,28,11,20,7,
+        12,22,1,20,2,1,17,1,23,7,18,16,13,13,13,14,0,28,5,28,28,3,9,15,16,28,29,8,2,7,4,7,
+        23,2,19,19,7,20,4,7,22,14,1,15,19,17,8,9,22,29,9,15,9,20,10,6,15,3,29,4,4,18,28,6,
+        18,8,20,4,17,17,17,8,11,22,9,1,8,2,8,11,22,29,11,18,29,6,29,11,28,29,9,15,19,28,15,5,
+        15,24,20,5,5,12,0,8,0,11,19,5,18,0,9,11,23,27,16,28,17,16,12,10,3,19,28,28,3,11,12,28,
+        10,25,12,1,2,19,17,2,5,10,17,6,4,29,16,10,22,9,14,28,29,0,10,9,21,16,20,9,29,10,8,29,
+        17,24,0,15,7,6,3,3,13,28,10,28,18,18,16,10,25,22,2,18,29,4,13,11,23,21,1,28,18,18,6,12,
+        16,9,0,8,15,4,5,7,5,11,2,4,6,10,9,17,21,3,28,15,19,6,28,9,21,18,9,0,27,29,27,6,
+        9,21,7,0,16,3,6,12,17,14,2,15,3,18,10,14,8,15,18,19,28,15,11,13,19,3,29,28,28,28,29,10,
+        9,6,0,5,5,0,8,12,23,2,6,10,3,1,10,10,21,16,17,28,16,14,10,13,21,22,3,3,27,29,12,28,
+        8,0,6,29,4,7,4,13,23,7,7,6,6,7,20,16,23,7,7,6,17,18,15,13,2,5,4,15,3,3,6,4,
+        22,4,6,29,23,5,8,28,6,29,12,5,18,5,15,15,21,16,17,19,6,19,9,9,21,19,4,27,15,6,8,3,
+        13,6,29,27,3,6,28,15,10,5,0,18,3,12,13,9,16,25,12,1,12,8,14,13,9,13,19,16,8,9,12,6,
+        22,21,11,2,3,4,8,12,11,15,27,15,13,19,8,6,21,19,1,6,11,29,18,13,21,21,27,3,28,3,15,28,
+        17,7,7,3,7,7,3,5,8,21,8,6,6,7,7,4,21,23,15,8,5,6,10,11,23,22,8,3,6,9,4,27,
+        22,27,8,0,25,8,8,5,23,23,8,3,4,6,3,3,7,23,6,6,4,8,6,15,21,21,27,15,5,4,6,8,
+        29,0,5,7,0,29,0,27,27,13,14,3,27,4,1,17,1,20,14,6,26,12,9,10,28,9,6,5,3,16,4,18,
+        21,28,3,4,7,8,6,8,12,22,6,27,5,3,8,6,7,21,28,3,28,4,6,19,23,22,3,6,3,3,7,15,
+        6,4,6,3,23,28,7,8,21,11,28,0,3,5,23,4,8,21,22,23,3,23,5,15,22,6,23,5,7,6,17,8,
+        21,26,28,3,1,5,5,21,21,21,0,1,6,4,6,5,23,23,5,5,17,18,20,14,23,23,23,3,7,5,7,4,
+        28,3,7,6,0,25,8,2,3,2,28,3,3,27,17,7,8,11,8,7,6,8,7,18,8,5,6,14,7,3,3,6,
+        22,6,27,1,7,5,4,7,22,8,21,3,7,3,4,6,8,23,22,3,4,3,13,15,23,21,1,4,3,28,5,5,
+        12,24,14,22,24,14,0,5,13,0,6,8,15,28,27,24,19,0,20,10,7,16,5,20,25,14,2,11,5,20,14,7,
+        29,26,19,22,27,26,0,9,19,5,20,10,20,9,29,9,14,11,20,10,19,4,5,17,29,29,2,13,11,11,27,10,
+        3,25,21,20,21,6,29,11,23,13,0,17,20,2,11,20,20,27,13,28,13,1,11,1,18,7,14,16,16,28,20,1,
+        4,3,25,25,17,24,17,10,20,2,24,26,2,7,20,14,9,17,11,13,16,13,27,14,6,4,17,28,7,20,2,28,
+        13,11,18,29,29,2,5,17,11,2,16,7,12,17,2,2,23,28,28,1,3,0,28,16,8,29,17,19,19,4,16,3,
+        12,5,17,2,21,29,8,2,2,9,2,13,9,4,2,14,29,16,15,10,28,19,19,13,27,29,0,5,13,7,4,9,
+        11,22,14,20,11,4,13,20,11,10,19,4,29,19,28,2,29,1,20,28,19,19,7,4,12,20,0,29,11,4,28,28,
+        22,14,1,17,5,29,21,4,16,0,5,1,14,29,13,27,0,20,19,10,7,4,28,10,15,5,29,28,13,11,7,4,
+        7,7,19,20,14,29,14,2,13,19,20,1,2,11,10,29,5,7,2,4,1,28,4,28,13,29,29,28,28,28,15,0,
+        3,24,16,13,14,3,16,20,10,23,1,17,17,10,29,5,0,23,5,1,12,19,16,10,3,12,18,14,0,8,29,8,
+        15,21,22,14,2,2,2,20,10,13,7,2,5,17,19,10,24,2,11,12,16,16,9,7,1,28,6,27,9,27,5,12,
+        13,17,7,20,17,14,15,7,21,11,1,12,17,4,11,13,6,10,7,15,17,7,28,20,10,28,0,29,0,3,14,3,
+        5,8,0,17,16,1,20,25,7,11,29,19,18,11,14,20,22,2,19,28,4,29,29,10,3,6,20,28,28,5,18,8,
+        18,17,5,8,1,18,15,14,14,26,11,2,18,18,10,11,9,12,15,28,19,28,9,12,21,3,29,5,9,8,29,4,
+        29,10,9,5,5,16,20,1,14,0,19,18,14,15,14,9,23,8,28,6,4,14,9,19,27,3,29,17,20,29,15,4,
+        23,20,0,20,1,2,5,20,19,7,14,17,5,11,18,9,9,18,17,28,16,28,14,9,17,12,5,27,9,7,0,7,
+        29,22,0,3,7,8,4,12,4,12,1,15,13,9,14,15,12,3,6,29,27,28,28,28,17,15,14,29,29,28,6,29,
+        9,1,6,4,1,3,4,10,23,8,5,9,8,20,9,11,20,3,29,19,11,29,14,19,6,29,28,17,20,28,28,8,
+        15,13,0,4,16,1,28,9,1,28,0,3,6,13,11,10,17,1,15,6,4,29,9,9,29,3,29,28,29,15,6,28,
+        10,22,2,0,7,5,3,13,23,13,4,2,28,11,9,1,0,3,6,29,4,28,10,20,9,12,29,7,28,27,3,29,
+        2,2,1,28,4,7,26,10,22,27,6,3,3,19,9,9,6,29,28,15,6,29,14,17,20,21,9,12,4,28,4,15,
+        22,5,3,2,28,28,5,8,23,3,27,6,6,13,15,13,11,12,9,15,16,4,13,7,21,10,12,29,19,29,19,15,
+        11,6,1,4,7,2,8,19,28,19,20,27,19,27,15,10,14,29,6,13,18,8,11,14,20,19,1,7,7,4,3,3,
+        28,5,8,3,7,6,1,4,16,3,8,20,12,14,18,11,4,28,4,13,19,12,17,12,1,16,9,4,6,15,13,3,
+        1,8,7,29,29,21,5,26,27,3,24,29,0,19,2,6,17,22,23,4,7,21,15,7,6,14,0,8,4,15,4,4,
+        15,22,7,8,29,6,8,21,23,23,3,8,6,0,5,16,11,17,12,5,3,18,19,18,15,6,17,20,7,11,7,10,
+        29,8,22,27,27,7,22,6,4,21,24,22,8,16,7,17,8,23,18,15,4,4,16,7,15,11,29,27,27,6,5,5,
+        14,2,8,8,0,5,7,26,22,23,0,1,4,25,26,15,27,28,26,4,7,2,19,18,13,2,21,6,6,17,8,16,
+        22,21,24,4,25,22,4,6,4,23,21,4,22,8,12,10,25,10,28,10,6,27,24,19,26,0,11,14,4,24,4,4,
+        7,28,0,3,0,7,6,21,14,29,7,6,3,28,27,13,9,18,25,10,13,20,17,17,27,16,9,9,10,9,5,15,
+        10,25,5,25,3,23,23,26,6,8,21,25,3,29,18,19,1,28,18,3,5,15,28,9,7,7,15,29,3,4,7,7,
+        20,22,7,7,22,7,3,22,25,6,8,1,29,5,8,3,23,18,8,12,3,15,13,3,20,27,21,10,17,6,13,3,
+        29,1,25,5,21,25,14,5,21,15,28,11,10,2,29,20,18,9,7,18,11,4,7,11,11,11,29,1,14,19,1,7,
+        16,28,11,21,24,22,26,14,17,25,19,17,17,2,5,17,21,11,20,29,14,20,29,11,3,11,17,7,19,2,8,1,
+        5,20,0,25,23,20,12,20,5,15,9,27,14,29,17,24,21,8,14,11,4,5,2,14,5,4,29,29,8,2,2,19,
+        22,9,19,15,25,20,29,27,21,12,28,11,28,4,5,25,2,21,11,5,20,10,14,20,18,29,5,13,28,14,11,20,
+        29,10,8,20,21,10,29,2,23,12,0,7,17,20,27,29,23,27,13,17,29,19,0,14,9,2,5,11,14,2,28,8,
+        20,2,17,11,14,17,2,11,21,8,13,10,27,11,8,16,29,28,17,28,5,19,10,1,11,8,7,17,12,28,10,18,
+        27,5,29,8,2,24,13,5,9,22,29,17,8,13,4,2,8,6,14,28,27,19,8,19,18,20,0,17,18,3,16,3,
+        13,24,23,14,5,1,2,21,11,15,20,1,19,8,20,10,12,4,16,5,13,28,20,8,11,1,5,4,16,8,4,9,
+        18,0,15,2,2,19,5,10,23,0,5,15,11,11,14,19,7,28,8,6,1,4,4,13,21,29,10,29,17,4,13,28,
+        0,4,23,8,17,17,17,8,16,13,14,19,13,20,11,10,27,6,2,29,9,8,4,1,8,22,20,2,9,10,3,27,
+        23,8,19,14,2,4,20,20,23,5,14,17,12,1,10,29,17,23,7,28,19,7,7,10,8,18,1,8,17,18,4,29,
+        11,17,22,2,20,20,17,11,26,14,20,1,10,20,10,1,22,17,2,11,28,10,16,19,24,24,29,28,18,9,28,3,
+        7,17,0,5,2,8,19,12,19,2,12,18,10,10,10,14,2,15,10,15,1,14,4,9,1,17,10,2,29,28,10,6,
+        15,2,16,1,20,0,13,18,1,14,5,4,18,18,11,17,9,4,15,14,7,3,13,18,0,29,17,29,7,28,3,20,
+        14,1,19,17,5,20,16,14,3,26,29,0,20,4,10,11,0,6,16,13,12,29,9,11,8,29,28,28,20,28,19,29,
+        1,8,18,19,8,17,7,18,21,29,19,9,13,10,10,11,11,15,3,28,9,29,14,14,3,8,11,20,27,4,7,18,
+        21,8,4,5,5,3,8,14,29,17,0,18,5,12,13,11,28,18,28,11,9,9,29,9,16,29,12,29,13,9,28,28,
+        11,2,24,4,1,4,7,3,18,0,5,2,1,16,10,11,3,19,3,15,20,29,18,20,15,6,3,20,19,20,28,18,
+        17,15,1,8,16,2,4,3,15,4,0,1,6,15,9,20,6,18,15,7,17,6,10,9,3,29,28,28,5,11,28,27,
+        4,5,3,2,1,1,7,6,4,16,15,5,9,12,10,10,2,12,10,9,4,17,9,13,28,6,6,28,17,19,28,29,
+        19,29,7,7,4,28,3,7,1,18,12,28,18,6,18,19,25,22,18,2,12,5,19,19,12,12,19,28,20,10,12,7,
+        7,22,1,28,4,5,6,6,9,23,3,5,29,16,18,20,8,26,18,6,16,28,9,13,4,20,9,18,28,13,5,8,
+        2,7,7,2,7,26,3,19,25,9,2,27,4,15,18,9,20,16,9,8,11,28,14,12,20,1,9,27,8,12,15,29,
+        15,8,5,0,5,5,28,7,5,6,5,4,17,7,19,18,0,10,12,5,4,18,11,16,6,6,28,8,18,27,29,17,
+        29,7,5,4,5,5,29,8,0,7,12,29,29,21,15,16,0,16,0,28,27,9,17,15,0,17,6,29,8,4,16,28,
+        13,28,4,0,28,3,29,5,9,14,22,4,1,3,16,17,18,27,28,26,5,18,6,3,11,5,29,6,7,3,3,3,
+        4,26,7,4,0,28,27,8,8,0,18,29,29,21,11,17,9,14,0,13,2,28,19,19,4,9,19,9,14,10,4,28,
+        6,7,5,3,25,24,24,25,4,26,27,8,4,29,9,15,24,4,6,9,28,19,7,14,10,8,4,3,10,8,4,7,
+        10,6,22,22,2,0,6,1,29,22,6,8,8,2,3,18,7,21,27,6,5,9,20,20,28,7,7,12,28,0,16,3,
+        7,3,1,4,5,6,5,8,6,18,28,7,4,29,8,3,5,3,5,9,27,11,18,18,27,6,13,7,10,5,28,3,
+        16,28,1,4,3,7,7,7,18,28,24,6,8,21,5,4,18,14,21,12,17,19,13,4,7,6,14,15,8,3,7,4,
+        10,21,21,4,4,0,8,2,20,7,0,4,5,7,9,12,12,10,22,19,6,27,10,10,0,28,11,15,20,4,17,3
+    },
+    { // difficulty 2
+        12,8,6,28,17,19,11,16,18,17,19,16,19,14,10,9,0,11,1,12,11,10,13,7,7,14,13,4,28,19,2,12,
+        13,7,13,0,23,5,29,17,22,11,6,12,8,21,20,28,16,17,10,21,14,2,7,17,2,29,10,4,22,10,10,6,
+        21,9,1,2,12,23,17,23,27,14,27,19,14,6,28,8,8,13,6,22,23,9,17,14,7,29,11,1,16,4,13,5,
+        23,3,23,4,3,13,10,8,25,2,23,13,23,8,17,20,5,23,14,21,29,23,28,27,15,2,20,11,19,10,17,12,
+        13,29,1,18,25,9,2,22,8,0,14,8,23,22,28,11,1,28,18,5,11,13,14,22,5,0,15,20,12,16,28,18,
+        12,29,23,8,9,5,14,2,2,13,14,24,10,18,22,8,18,15,2,1,10,13,20,1,10,19,21,20,4,23,12,21,
+        9,20,5,7,3,14,2,20,20,9,23,8,8,28,22,20,2,20,13,2,3,3,2,4,16,5,1,27,14,16,3,2,
+        21,11,19,28,12,16,15,19,0,5,22,26,3,12,28,0,9,19,22,28,27,27,13,4,4,0,28,2,21,10,2,8,
+        6,5,16,7,11,2,28,6,17,20,23,29,8,16,22,19,2,4,8,10,20,14,13,17,1,28,12,15,18,10,3,23,
+        19,11,19,17,10,5,22,7,23,27,23,2,21,16,23,16,13,13,6,29,2,19,7,15,11,19,12,6,28,16,22,16,
+        23,5,5,11,2,22,2,23,4,2,10,19,23,19,22,19,17,16,22,13,5,0,17,23,4,9,18,7,10,10,22,20,
+        21,5,3,6,3,4,29,22,21,2,4,2,1,13,19,20,19,4,28,29,18,0,9,20,11,18,13,16,15,19,22,23,
+        25,14,22,14,14,23,12,18,29,18,9,13,9,19,7,20,0,10,28,29,27,22,6,15,4,15,1,27,9,6,12,29,
+        11,5,7,16,9,20,10,12,11,10,13,29,5,19,1,6,27,9,0,11,0,19,13,11,14,3,20,9,6,13,0,11,
+        8,16,5,9,12,9,15,20,7,0,23,27,5,29,16,16,27,4,9,19,22,22,19,0,22,9,0,28,20,18,20,29,
+        7,22,3,9,1,2,3,18,4,10,8,28,19,17,4,5,13,6,29,5,20,16,11,14,20,0,13,11,11,6,0,0,
+        11,21,16,27,22,16,15,3,16,14,11,16,10,23,1,4,15,19,21,6,9,21,11,20,0,16,16,21,5,17,18,29,
+        10,20,3,19,12,17,16,22,8,9,2,23,10,19,13,29,18,9,16,22,5,11,7,5,6,17,21,3,22,16,16,29,
+        16,11,5,10,1,12,22,0,9,12,20,19,13,13,19,9,11,10,10,22,14,11,0,3,21,13,1,1,4,12,19,19,
+        15,20,14,15,10,9,22,19,16,3,23,1,21,12,22,4,1,21,21,22,14,2,14,20,19,21,7,7,4,4,8,10,
+        0,7,0,7,4,4,10,28,3,15,17,16,9,19,18,27,8,9,6,6,7,11,17,16,6,10,7,28,3,15,19,13,
+        1,15,8,7,12,12,16,1,12,3,14,19,13,0,4,18,12,3,27,17,23,15,17,9,15,9,6,3,7,15,15,20,
+        1,5,4,17,13,14,7,6,9,22,17,19,6,17,20,6,4,19,6,12,7,27,1,21,27,18,19,7,8,22,6,8,
+        29,1,16,8,28,17,21,6,6,21,13,13,10,0,28,9,12,23,19,15,4,28,9,28,9,21,18,29,13,10,8,6,
+        6,7,7,26,19,7,27,7,19,8,16,21,6,18,1,23,21,12,11,10,29,29,22,20,8,6,29,22,6,16,6,7,
+        15,6,8,9,15,1,5,17,7,13,7,29,16,7,16,29,2,7,15,1,11,7,28,16,20,28,7,8,28,1,6,17,
+        21,8,9,20,13,15,17,7,27,13,11,8,11,9,8,18,6,16,14,18,19,7,8,19,25,7,10,27,22,7,27,6,
+        23,15,14,29,7,21,6,21,13,16,17,21,16,12,23,7,8,7,7,10,7,13,23,16,10,27,6,12,6,2,6,8,
+        8,20,13,8,19,10,11,20,6,6,11,0,8,2,27,6,22,23,9,28,17,7,8,6,14,20,12,7,8,6,8,26,
+        13,6,8,18,20,11,23,8,15,18,7,17,16,8,17,14,7,7,7,12,16,9,20,9,8,8,8,6,21,7,8,28,
+        8,2,7,17,9,16,6,8,28,20,6,15,8,7,19,7,7,28,7,7,29,9,10,19,23,6,6,7,8,6,7,14,
+        7,6,8,28,9,10,8,2,7,1,2,13,14,10,9,28,8,0,12,7,7,19,13,7,8,6,23,7,9,6,0,7,
+        10,12,22,6,23,29,13,21,2,29,13,10,20,27,29,21,20,29,5,10,23,22,14,1,13,1,8,29,16,4,7,6,
+        17,15,16,18,27,22,21,21,0,23,23,1,6,29,4,0,17,14,23,11,8,21,10,23,16,8,0,21,15,12,15,5,
+        2,23,14,22,22,22,22,14,8,23,18,22,23,21,8,15,6,10,10,22,9,23,6,7,21,4,21,16,21,21,21,21,
+        3,2,21,9,27,27,23,22,22,19,15,0,11,3,21,2,16,5,23,19,11,18,14,27,18,15,3,11,19,4,23,20,
+        13,11,17,23,10,29,23,23,8,22,28,23,12,21,8,21,8,21,21,1,22,18,12,16,3,14,2,23,9,3,3,23,
+        9,22,18,22,11,22,29,21,27,16,3,17,14,18,9,28,2,21,10,29,21,1,18,11,7,3,28,22,23,10,21,17,
+        4,17,8,5,8,16,11,6,18,17,13,11,29,21,7,28,12,9,23,11,8,15,28,13,2,22,18,23,18,7,6,21,
+        0,5,23,19,22,29,21,20,28,14,11,22,7,29,22,17,10,27,1,21,21,21,21,28,18,22,16,0,14,4,6,23,
+        0,7,2,0,23,23,0,0,1,14,10,23,20,18,1,8,9,21,11,4,21,22,9,4,3,14,0,29,17,21,19,18,
+        14,28,20,19,20,21,23,11,6,21,23,14,15,19,18,22,28,8,1,16,28,10,14,7,6,21,23,2,22,22,17,3,
+        7,17,19,21,10,0,27,22,10,14,21,4,29,13,5,16,8,16,19,27,22,12,1,12,11,10,22,0,23,28,12,3,
+        15,15,20,11,21,19,16,3,4,4,17,10,20,18,11,21,22,12,19,28,15,1,22,9,1,15,6,5,18,16,5,6,
+        14,17,4,23,8,20,15,21,29,3,1,5,11,22,21,4,28,0,9,21,12,21,16,18,0,3,5,17,27,27,21,9,
+        16,22,12,10,4,22,15,11,4,12,10,17,12,4,1,5,9,18,15,23,29,9,0,15,0,1,21,17,7,21,27,12,
+        17,22,10,22,14,22,23,1,0,0,23,21,0,23,15,15,24,9,14,19,0,23,22,6,4,6,9,3,23,18,7,2,
+        13,20,0,28,14,12,12,14,10,22,21,10,11,0,4,2,18,2,29,29,13,16,22,12,11,28,1,13,28,9,7,18,
+        20,18,9,20,9,11,10,13,11,22,5,10,9,20,7,0,2,12,5,10,12,22,12,6,16,10,17,17,1,21,12,6,
+        3,1,20,11,16,8,16,3,27,20,9,4,7,7,4,29,21,6,21,21,12,3,11,6,18,4,13,28,28,29,29,0,
+        21,15,2,11,14,16,1,1,20,0,11,22,11,10,27,11,9,23,2,9,15,18,11,19,22,17,4,18,18,22,12,9,
+        1,9,18,8,19,19,19,22,4,22,6,2,10,2,28,20,29,7,21,20,21,16,20,5,29,9,22,13,2,14,6,7,
+        21,17,15,16,10,6,16,7,21,29,10,6,19,12,4,8,21,9,8,13,13,1,21,19,19,21,23,10,13,15,21,23,
+        6,28,7,14,10,14,15,4,14,18,15,5,0,17,6,22,28,3,18,18,17,10,23,14,3,10,6,16,11,8,21,10,
+        23,16,7,9,15,15,29,14,6,11,13,14,20,9,23,11,7,1,13,19,9,14,29,9,2,4,9,20,11,8,21,21,
+        18,29,16,14,20,12,9,23,5,19,1,16,20,14,6,14,22,23,14,7,27,2,23,8,4,10,14,7,2,10,6,19,
+        6,21,7,23,10,18,11,23,7,10,21,26,17,20,4,23,9,7,6,23,8,19,14,11,17,12,12,6,8,23,10,23,
+        8,18,19,7,19,8,27,16,6,12,22,22,9,27,6,6,23,14,16,8,9,8,29,6,13,22,7,8,20,7,27,8,
+        28,18,12,17,6,2,18,9,11,11,10,16,16,17,7,2,7,11,0,12,8,11,6,21,2,18,28,27,20,29,12,22,
+        15,7,8,10,6,17,11,16,8,10,8,13,8,18,6,21,23,16,11,6,14,16,6,16,0,6,11,20,7,13,14,22,
+        6,7,7,15,6,19,22,8,23,6,29,6,7,7,7,8,22,23,21,6,7,17,12,7,7,7,10,27,22,20,6,8,
+        19,6,17,28,15,27,7,6,8,13,15,9,7,7,15,12,8,4,22,7,16,7,13,23,28,12,16,8,7,21,6,1,
+        23,21,6,19,17,7,16,1,16,8,20,13,19,10,20,16,17,8,23,23,16,12,27,6,22,8,8,8,22,6,8,7,
+        7,6,21,12,7,13,8,12,8,18,11,17,11,12,29,9,0,8,13,19,15,15,9,15,6,7,22,6,6,7,13,8,
+        7,15,6,18,1,27,21,0,20,0,17,23,23,15,23,14,1,21,3,8,21,2,22,17,23,29,21,6,1,10,22,11,
+        22,7,17,18,15,22,15,7,18,22,13,23,29,23,19,22,21,3,20,1,23,23,23,8,10,5,21,21,7,10,23,23,
+        18,21,21,23,7,21,1,15,21,21,23,12,1,23,22,21,28,21,12,23,23,12,22,23,22,29,22,23,27,16,22,4,
+        8,10,22,22,22,22,6,23,19,12,28,21,22,23,23,3,10,5,21,20,1,21,23,23,21,17,23,29,18,15,22,27,
+        29,21,22,22,21,11,8,23,18,13,13,13,24,21,4,23,27,18,21,22,21,18,21,21,13,9,20,22,27,22,13,22,
+        16,22,29,12,17,21,14,0,8,22,29,28,2,5,17,21,21,15,10,2,22,23,23,10,15,21,15,8,23,23,22,23,
+        12,17,22,19,12,21,9,21,13,6,3,23,20,22,21,21,23,23,21,15,0,22,21,23,14,15,0,15,23,22,21,4,
+        8,9,5,8,21,21,8,22,22,21,23,23,23,21,3,21,21,9,21,6,11,5,22,21,3,15,21,21,21,5,21,21,
+        22,23,23,21,21,23,17,23,22,23,4,23,21,21,9,15,23,2,6,22,23,22,27,2,22,23,21,21,29,19,22,21,
+        29,22,17,23,23,29,10,6,20,10,23,22,22,9,14,27,11,21,16,21,22,23,22,4,17,17,23,23,15,9,19,22,
+        8,23,23,23,21,23,27,0,6,11,14,28,4,21,28,10,6,21,6,22,0,23,23,21,7,2,21,23,23,7,3,15,
+        18,9,22,21,13,7,0,23,5,29,23,29,0,13,22,20,16,21,21,23,21,15,22,15,16,17,2,23,22,23,23,21,
+        23,22,27,13,4,13,22,22,8,5,14,10,22,22,13,14,11,12,9,21,0,13,5,0,8,21,21,15,12,12,19,9,
+        21,21,17,10,23,27,23,23,9,6,9,22,29,15,12,8,0,11,4,17,14,20,29,21,28,3,6,21,23,8,9,23,
+        28,22,23,23,10,22,16,22,23,23,18,13,11,28,23,17,9,27,22,21,21,21,23,9,5,21,23,16,11,22,9,23,
+        15,21,23,11,1,0,7,15,9,0,23,14,22,23,23,27,23,4,7,9,1,21,13,21,5,14,3,20,16,22,21,17,
+        13,14,0,9,11,0,16,21,20,22,23,9,7,14,1,23,20,21,14,14,23,0,21,3,2,21,0,14,21,13,21,22,
+        2,21,17,21,21,20,16,12,16,21,23,22,6,6,16,10,23,22,23,9,3,26,17,23,29,22,22,13,21,3,22,23,
+        14,22,14,17,12,23,16,27,17,13,11,21,13,29,23,21,5,9,21,11,22,27,11,12,27,3,23,2,17,5,2,3,
+        13,23,2,22,18,23,22,18,29,10,10,9,23,2,16,23,21,29,21,13,23,12,23,15,21,13,6,9,11,15,23,18,
+        19,21,11,12,12,16,15,27,23,16,18,21,19,11,21,13,5,12,7,6,9,28,7,2,8,22,3,23,15,8,6,9,
+        28,4,21,5,22,3,23,21,24,1,23,11,11,2,23,3,21,22,0,14,10,9,14,21,11,29,27,21,20,0,7,27,
+        22,8,5,23,16,9,2,21,21,10,21,20,16,12,15,21,3,8,22,22,21,10,20,10,7,23,7,3,21,17,23,16,
+        21,23,8,17,9,22,9,21,22,29,18,20,10,11,12,15,13,13,22,17,11,12,12,21,9,23,8,17,4,11,21,23,
+        8,6,6,23,18,15,21,22,23,21,18,10,16,15,15,0,1,23,18,23,0,3,19,15,28,21,7,28,22,21,22,23,
+        22,23,23,21,6,23,14,8,22,7,13,23,21,23,0,1,27,10,6,22,6,7,20,21,23,21,7,12,6,1,12,28,
+        22,23,21,10,21,19,22,8,8,8,29,13,12,12,4,22,22,18,20,22,8,9,23,21,14,7,18,10,21,11,23,22,
+        23,6,21,14,21,7,14,22,14,6,21,12,6,14,15,7,21,8,12,10,18,10,11,8,23,5,23,6,22,23,22,21,
+        10,21,9,23,8,21,22,8,11,17,23,18,8,17,7,7,22,1,8,13,22,22,11,6,29,22,6,7,23,7,23,6,
+        18,27,21,13,21,19,22,0,13,6,22,12,19,20,21,8,15,8,8,9,29,6,16,22,7,28,7,22,8,6,20,22,
+        22,22,7,11,6,7,12,21,23,13,23,20,12,22,6,8,13,17,21,7,7,7,8,22,6,22,23,22,21,22,21,21,
+        20,27,23,21,8,6,11,6,23,22,14,20,9,7,23,4,1,23,23,6,6,18,17,0,7,15,29,23,29,6,22,7,
+        22,21,22,21,9,12,23,15,11,19,23,21,22,4,5,22,2,6,22,23,21,22,21,18,10,21,27,22,23,11,21,21,
+        23,19,23,22,23,23,2,19,20,23,13,10,16,29,21,23,0,15,17,22,23,21,9,21,20,21,23,23,4,19,6,19,
+        17,23,14,11,22,23,23,28,21,23,22,7,23,22,21,21,23,6,20,23,17,22,0,23,27,20,25,22,21,18,21,9,
+        23,23,10,15,22,15,23,21,18,21,23,11,22,22,21,7,21,23,16,15,15,0,23,0,16,20,19,22,22,23,23,13,
+        21,23,23,11,23,15,22,21,7,21,21,28,21,22,23,22,15,23,15,22,25,21,22,1,15,21,21,27,18,21,21,3,
+        12,21,23,9,22,23,21,18,8,16,23,29,15,4,1,23,22,21,23,21,22,5,23,20,22,6,11,21,23,29,23,23,
+        21,23,23,23,21,10,23,16,29,22,20,21,2,11,27,5,0,23,28,23,21,22,11,21,23,7,22,18,23,15,9,1,
+        27,23,22,12,23,8,21,21,22,23,20,5,21,5,15,15,21,21,22,21,4,23,22,20,9,21,14,23,9,13,22,23,
+        23,22,23,12,11,20,21,23,29,10,23,7,21,22,22,21,8,6,21,28,27,11,21,21,22,21,23,8,21,23,27,21,
+        6,21,22,22,22,21,22,17,21,8,23,17,21,22,22,22,23,4,22,22,1,12,14,22,6,21,27,3,2,21,6,21,
+        16,21,11,22,16,23,21,17,17,23,21,23,11,3,14,23,23,21,11,23,14,5,22,22,23,23,27,23,13,22,14,22,
+        21,23,0,23,21,23,22,22,23,11,12,21,13,22,9,22,28,22,13,11,21,23,22,9,9,2,23,11,16,28,21,23,
+        20,2,23,21,23,21,21,18,15,9,10,21,12,4,28,3,23,5,9,22,4,16,22,2,21,21,21,23,12,23,27,22,
+        23,23,22,15,15,23,21,23,14,22,23,2,22,13,21,21,5,9,22,21,23,22,21,21,23,21,23,29,19,23,7,3,
+        5,22,21,0,14,13,22,3,22,9,23,21,21,22,22,23,10,22,21,21,23,12,21,28,17,21,23,11,21,0,9,12,
+        3,29,21,3,10,5,22,12,0,4,23,21,21,23,6,21,17,22,29,21,21,22,8,2,6,21,23,23,15,27,23,21,
+        20,21,13,12,21,7,23,16,15,22,21,12,23,22,22,13,21,27,21,21,22,22,24,23,0,6,13,21,22,22,0,23,
+        22,22,22,2,19,27,22,23,21,22,22,22,8,23,23,21,23,10,5,2,21,9,15,21,17,29,9,22,21,22,23,29,
+        5,28,0,14,14,28,23,21,22,6,28,14,3,22,2,23,11,29,5,21,13,22,22,21,14,21,23,22,22,29,13,9,
+        23,23,23,23,14,21,23,8,27,21,3,23,10,10,6,22,21,27,23,14,9,21,23,16,29,21,29,0,15,8,8,23,
+        6,23,23,9,23,9,21,22,22,13,10,17,21,2,18,21,21,21,22,23,12,9,9,21,2,21,14,29,8,22,22,10,
+        7,22,15,21,22,21,22,18,21,21,18,23,11,22,21,22,4,22,13,22,7,22,8,23,23,21,22,8,12,22,7,21,
+        21,23,8,10,17,15,22,4,23,10,18,20,21,21,22,14,22,13,23,21,18,0,18,8,22,21,6,21,2,23,23,23,
+        7,21,23,21,21,11,3,4,22,21,12,23,10,21,10,5,15,16,7,7,3,12,22,29,12,27,22,1,11,18,21,6,
+        23,23,8,9,11,22,18,23,17,16,29,13,22,12,17,21,12,12,6,21,22,21,23,22,6,8,7,22,23,23,18,0,
+        8,17,21,14,22,8,22,23,19,21,23,22,9,21,21,22,10,6,22,9,15,8,22,21,3,9,23,10,21,8,21,21,
+        21,21,18,29,13,20,6,21,7,21,12,12,23,12,10,28,6,8,19,23,22,13,22,8,8,7,22,23,22,9,23,2,
+        8,22,22,11,11,21,21,21,23,21,7,8,27,1,11,23,14,22,22,23,21,22,22,15,2,2,21,22,21,0,24,6,
+        21,21,23,21,18,7,13,23,27,22,21,21,18,23,23,7,7,21,23,20,15,22,27,27,6,23,7,22,13,15,7,21,
+        6,22,21,13,13,22,10,23,21,21,22,13,17,16,6,13,21,22,16,0,21,29,23,7,22,27,19,23,23,8,22,21,
+        6,5,21,13,27,18,21,28,11,22,9,7,16,7,12,23,22,17,22,9,22,29,15,19,7,21,8,11,21,8,8,23,
+        20,6,12,14,21,28,22,7,19,11,14,6,15,19,23,7,28,7,10,23,20,21,8,13,22,8,12,23,22,21,21,21,
+        22,23,21,22,22,22,23,21,13,22,22,22,21,21,21,21,22,23,23,21,23,23,23,22,12,21,23,23,21,21,21,21,
+        11,22,21,23,23,21,23,21,21,23,21,23,21,21,23,21,6,5,23,23,23,21,21,5,23,21,22,22,1,22,21,23,
+        25,29,14,2,6,12,9,23,14,10,22,12,16,17,21,18,14,21,20,23,23,16,19,23,17,17,10,23,23,0,21,22,
+        15,21,23,7,21,21,21,23,22,23,21,23,5,22,19,21,23,23,22,21,23,22,21,23,18,21,22,22,21,22,21,21,
+        3,14,23,20,16,21,22,23,1,21,23,23,23,22,23,23,7,23,22,22,23,22,21,21,5,21,21,11,23,21,21,23,
+        29,11,22,23,23,23,22,21,23,23,23,23,22,22,22,22,21,9,23,23,7,23,22,23,23,22,22,23,22,23,23,22,
+        22,23,28,23,20,14,4,12,22,22,5,2,22,20,23,3,21,5,22,2,21,15,22,20,21,23,23,22,23,23,6,14,
+        21,17,4,22,23,16,22,21,8,22,17,23,9,21,21,22,27,23,22,22,22,18,21,16,21,13,6,10,20,19,22,6,
+        22,2,15,9,23,25,10,21,23,1,23,6,6,6,23,22,1,22,22,23,22,23,21,22,21,22,21,23,23,23,23,23,
+        22,21,8,18,21,23,23,21,22,21,21,23,21,0,22,21,1,23,23,22,22,21,23,16,21,0,23,23,22,28,5,21,
+        14,17,5,29,23,12,8,22,19,10,0,11,21,23,5,22,22,20,1,22,23,11,21,22,21,19,23,21,3,29,21,16,
+        14,23,22,21,23,21,21,21,1,21,1,22,23,23,21,21,22,22,21,21,22,22,22,23,7,12,22,22,29,22,21,23,
+        21,21,23,23,23,21,22,29,23,22,4,22,22,21,23,22,13,21,22,21,21,23,23,22,22,22,2,15,20,21,23,22,
+        26,22,23,1,18,21,22,22,1,21,21,23,23,23,12,23,3,23,21,21,22,21,23,21,23,22,23,13,22,22,21,23,
+        21,21,10,0,23,29,22,3,23,21,23,2,20,22,8,8,4,23,23,23,23,22,23,17,8,22,8,22,21,21,28,13,
+        16,21,23,10,22,23,23,22,21,22,21,23,22,22,22,11,18,22,23,21,21,23,11,23,23,22,23,23,21,18,22,21,
+        9,7,22,11,21,0,8,5,9,21,10,22,21,5,22,23,29,22,21,23,22,7,23,16,6,23,12,23,18,22,6,22,
+        21,23,10,20,21,23,21,22,6,22,23,9,21,23,21,23,22,23,22,22,21,22,22,21,23,21,23,23,22,21,22,21,
+        18,18,0,22,23,23,13,1,21,13,21,21,9,22,6,21,17,16,22,6,21,15,20,21,22,22,20,25,0,6,11,3,
+        0,23,23,11,28,21,22,12,8,8,23,23,21,20,21,16,28,22,21,21,23,22,22,6,17,23,23,23,22,21,29,21,
+        14,18,12,22,12,1,4,22,3,3,19,14,11,18,23,29,23,22,22,8,20,14,23,23,3,24,22,0,20,17,21,23,
+        22,28,23,4,14,8,10,22,2,9,22,9,21,22,8,27,22,19,16,9,17,21,23,22,2,23,22,21,22,21,17,23,
+        7,23,12,10,23,23,23,21,6,23,9,22,21,20,3,27,0,19,0,21,5,14,22,22,14,4,10,21,23,15,22,8,
+        27,22,11,23,15,23,22,23,22,9,21,9,15,0,29,23,23,22,22,23,23,22,23,23,21,15,23,21,22,23,22,21,
+        23,22,22,14,21,21,23,22,23,23,23,21,18,22,11,22,22,22,23,22,13,23,23,23,8,22,22,23,22,21,21,21,
+        21,23,8,23,22,22,22,22,23,21,23,21,16,21,23,21,23,6,23,23,23,21,21,23,6,23,23,21,22,21,21,21,
+        21,28,5,16,17,21,23,23,6,21,20,23,15,15,22,23,23,23,19,18,12,6,10,11,20,23,22,24,7,27,20,7,
+        21,22,23,8,6,23,21,22,22,23,21,21,8,9,23,22,21,21,23,22,23,21,21,23,14,21,22,21,21,21,22,22,
+        16,6,22,18,21,23,22,22,21,6,23,8,20,8,23,21,21,23,21,23,22,23,23,22,21,23,22,22,21,22,22,23,
+        9,21,9,23,23,23,23,23,29,2,23,12,18,1,23,22,7,22,21,22,22,17,22,23,23,22,6,21,7,22,23,22,
+        6,0,21,13,23,21,9,1,0,8,23,20,15,9,23,19,22,21,23,23,10,3,20,10,6,14,6,13,22,8,21,21,
+        6,22,23,9,6,6,22,6,13,21,21,14,22,22,8,23,6,8,22,23,7,7,21,15,8,21,22,21,22,22,22,6,
+        23,21,23,23,21,23,23,23,23,23,23,23,21,21,21,22,23,22,21,23,23,23,23,23,22,23,22,23,23,23,21,23,
+        23,21,23,22,22,21,22,22,21,21,22,23,21,22,22,22,22,22,23,22,22,23,23,21,22,23,21,21,23,22,21,23,
+        15,14,19,23,18,28,10,9,23,21,21,7,23,28,3,28,21,19,22,22,22,23,21,27,9,20,21,11,1,22,4,8,
+        22,22,22,21,23,23,21,23,21,23,22,23,23,23,23,23,22,22,22,22,21,23,22,22,21,21,21,23,23,21,23,23,
+        22,21,22,21,23,21,23,23,23,21,22,23,23,21,23,23,21,21,21,22,22,23,23,23,23,21,23,22,23,23,21,21,
+        23,22,21,23,23,21,23,22,23,22,22,21,23,22,21,23,21,23,21,23,21,23,23,21,24,23,9,22,21,22,22,23,
+        14,22,29,27,21,5,18,5,12,11,3,29,23,8,4,7,22,22,23,28,22,1,14,22,15,21,24,15,0,7,1,21,
+        22,21,23,21,23,21,23,23,21,21,22,23,22,21,23,22,23,23,23,21,21,23,23,22,21,2,22,22,23,21,21,22,
+        5,14,22,21,23,23,21,23,23,22,22,22,22,22,22,21,22,21,21,22,23,23,23,21,22,21,21,23,23,23,22,23,
+        22,22,18,21,22,23,21,23,21,23,22,22,23,23,23,22,23,21,22,21,23,22,22,23,23,23,22,23,23,21,21,23,
+        17,6,23,18,11,9,23,21,29,28,3,29,22,21,15,23,2,8,23,4,21,22,22,18,20,21,3,22,28,22,18,0,
+        23,23,21,23,23,23,23,23,23,22,22,23,23,21,21,22,22,22,23,23,22,23,22,21,22,22,21,21,21,22,22,22,
+        22,21,23,23,10,22,23,21,21,22,21,23,22,23,21,23,17,21,23,22,22,22,21,21,21,22,23,23,21,21,23,21,
+        21,21,23,22,23,22,21,21,21,23,21,22,23,22,23,23,22,22,22,21,21,23,21,21,22,23,21,23,21,21,23,23,
+        9,5,22,1,21,27,22,10,12,22,23,23,9,22,19,14,27,4,21,10,21,23,6,23,27,3,2,21,5,7,29,23,
+        22,22,23,21,21,21,23,23,22,23,23,22,21,23,21,22,21,22,22,22,21,21,21,21,23,22,21,22,22,23,23,21,
+        23,17,21,23,22,21,23,23,23,22,23,22,23,22,22,21,23,21,22,21,22,22,22,22,22,21,21,22,23,21,22,21,
+        23,12,6,22,21,21,23,22,22,23,21,23,22,23,23,22,21,21,21,21,21,22,23,21,23,22,22,23,21,21,21,21,
+        17,22,23,23,18,10,15,9,23,23,3,12,14,22,20,2,11,21,23,1,1,23,21,3,17,23,23,3,26,2,20,11,
+        22,23,21,22,21,23,21,22,22,22,23,23,23,21,23,21,22,21,21,21,21,23,21,22,23,21,22,22,22,23,21,23,
+        23,21,21,28,22,21,23,21,23,21,21,21,22,22,22,21,8,22,22,23,23,23,23,23,21,23,23,23,23,23,22,23,
+        22,23,11,23,9,23,23,23,21,21,23,22,22,22,23,22,22,23,23,22,22,21,21,23,23,22,23,23,21,22,22,22,
+        9,22,12,18,22,17,27,6,15,15,18,20,12,11,9,21,14,23,19,23,23,8,23,18,2,16,21,11,0,8,2,21,
+        12,21,21,22,0,21,21,23,23,23,22,23,22,23,23,21,22,22,23,22,23,22,21,22,23,21,23,23,22,23,22,21,
+        22,21,22,23,23,23,22,23,22,23,21,23,21,23,21,22,23,22,22,23,23,23,23,21,23,21,23,23,21,23,21,21,
+        23,23,21,23,23,21,21,23,23,23,21,21,21,23,23,21,22,22,22,23,23,23,21,22,22,22,21,21,23,21,23,23,
+        2,2,22,20,12,0,3,23,5,20,11,17,9,17,21,13,17,20,23,4,21,7,23,22,27,9,8,27,22,28,7,22,
+        23,22,21,23,21,23,23,23,22,23,22,23,23,21,22,22,22,22,22,21,22,22,21,22,22,21,22,23,22,21,21,21,
+        22,21,22,21,23,22,23,23,22,23,21,9,22,22,23,21,22,21,22,21,22,22,23,22,21,21,22,23,22,21,23,23,
+        22,21,21,20,21,23,23,23,22,23,23,21,23,22,23,23,22,23,22,21,23,21,23,22,22,23,22,23,22,21,21,21,
+        27,21,0,9,19,6,6,2,17,23,22,9,19,24,22,6,0,21,23,18,28,10,15,27,9,8,22,23,6,27,10,6,
+        22,22,23,23,21,21,21,23,6,23,21,23,21,23,23,22,23,23,22,21,22,23,21,21,22,22,21,22,22,21,22,22,
+        21,23,21,23,23,22,22,23,22,21,23,22,21,23,23,23,21,23,22,23,23,23,23,23,21,23,22,23,21,23,23,23,
+        21,17,23,21,21,21,22,22,23,21,21,22,22,23,22,23,22,21,21,21,22,22,21,21,21,23,23,22,22,21,23,22,
+        16,1,16,24,13,28,11,21,19,6,20,19,21,21,10,23,19,11,7,6,9,8,24,3,8,23,14,2,21,26,21,21,
+        21,23,22,21,22,22,23,23,22,21,21,23,22,22,23,22,21,23,21,22,21,22,23,23,2,21,25,22,23,21,22,6,
+        23,21,21,21,21,21,22,23,23,23,23,23,23,22,23,23,13,23,22,21,22,22,21,23,21,23,22,25,23,23,22,23,
+        21,23,23,22,18,22,22,22,23,7,9,22,22,21,23,21,12,22,10,21,21,19,21,23,15,22,22,22,21,5,23,21,
+        7,0,22,4,7,14,15,19,17,23,9,2,20,20,22,11,21,27,21,23,21,1,23,21,13,21,0,15,23,22,22,3,
+        23,22,23,28,23,22,23,23,21,21,22,21,22,22,22,22,0,22,22,22,23,21,21,23,23,23,16,23,28,19,9,3,
+        23,22,23,5,22,21,22,22,19,20,23,18,22,21,21,27,28,23,23,21,23,22,21,21,21,23,22,23,21,21,22,21,
+        22,0,29,13,9,21,23,21,9,22,29,23,21,22,22,23,23,22,23,21,22,21,21,23,10,22,22,22,21,18,21,23,
+        18,18,8,23,0,2,21,5,14,9,19,9,29,21,16,28,18,23,12,11,24,17,26,22,20,23,25,6,7,5,22,3,
+        0,21,22,21,23,21,22,23,23,23,28,23,21,21,21,23,4,22,21,21,23,21,22,23,23,22,22,3,23,21,22,25,
+        5,0,8,18,9,23,22,22,1,21,23,22,22,21,21,22,20,23,17,23,23,23,21,23,22,23,22,22,23,21,22,22,
+        22,21,7,13,5,22,21,23,2,21,18,21,23,7,21,21,23,23,21,2,21,23,22,23,22,23,21,22,23,22,22,21,
+        23,5,6,7,13,14,21,1,11,4,17,22,17,29,6,23,28,22,24,27,14,18,10,0,2,12,23,15,19,15,22,23,
+        21,21,22,23,21,21,23,22,21,23,21,22,23,22,22,22,22,23,23,23,22,21,21,22,10,22,9,21,23,21,22,22,
+        24,5,22,23,5,21,21,22,1,23,21,14,7,22,23,23,27,21,22,21,23,22,23,22,23,23,22,22,21,22,22,21,
+        15,21,16,12,23,1,21,23,28,22,21,5,23,21,22,23,10,23,22,21,23,17,22,23,23,22,21,21,23,22,23,21,
+        16,11,29,24,16,22,2,22,1,13,20,11,9,27,18,3,19,22,22,15,11,18,17,21,9,23,23,3,10,1,23,12,
+        21,28,0,16,7,23,22,22,8,22,23,23,12,22,22,21,15,22,21,22,23,21,22,23,21,21,23,22,23,21,21,23,
+        24,22,3,22,21,21,21,23,16,23,15,19,21,22,21,21,22,22,23,23,22,23,21,21,23,23,21,23,21,21,22,22,
+        15,23,21,22,21,22,23,21,23,22,23,23,21,21,23,22,21,22,23,21,22,22,23,22,21,21,23,21,22,22,21,21,
+        23,13,19,1,20,19,12,16,6,6,16,23,13,23,18,17,6,10,11,19,19,9,4,16,22,20,22,4,22,21,21,9,
+        27,22,9,14,19,23,22,23,28,21,12,15,23,22,23,23,21,23,23,23,22,23,21,21,21,22,21,21,21,23,22,22,
+        22,23,23,19,21,22,21,23,21,21,21,23,23,23,23,22,21,22,22,21,22,23,23,23,22,23,22,21,22,22,22,23,
+        22,21,22,23,22,21,22,22,23,23,23,23,21,23,23,22,22,22,23,22,22,23,21,22,23,23,21,23,22,21,22,23,
+        0,20,19,23,8,5,18,8,13,21,16,9,12,23,20,29,7,23,12,18,17,24,19,27,0,5,20,3,13,26,12,12,
+        23,23,23,23,21,21,22,22,23,21,21,10,22,21,21,23,22,22,21,23,23,21,21,21,22,23,23,21,23,22,21,23,
+        23,22,22,21,21,21,22,23,7,22,23,23,22,21,23,21,21,22,22,23,21,23,23,23,22,23,21,22,21,21,22,23,
+        23,22,22,19,23,21,23,22,22,22,20,22,22,21,23,23,23,22,22,23,23,23,22,22,21,22,21,21,22,21,23,23,
+        10,19,5,14,16,19,21,18,27,16,7,9,19,1,11,29,10,28,27,26,18,11,14,8,0,7,16,21,8,14,5,11,
+        22,22,28,19,23,23,21,22,21,22,21,22,23,21,21,22,22,23,21,23,23,22,22,22,21,23,23,22,21,23,22,23,
+        23,27,17,3,1,17,3,27,2,29,6,24,4,6,7,13,1,16,9,29,16,7,21,0,23,21,26,3,20,15,6,20,
+        29,24,1,15,14,7,16,28,9,22,18,5,0,13,20,20,13,26,15,11,21,15,25,19,29,0,0,17,24,21,14,18,
+        3,21,9,4,2,5,12,29,14,23,6,2,19,24,8,27,12,24,3,4,22,0,24,29,25,23,24,21,14,16,0,9,
+        28,0,20,21,5,1,7,13,5,19,23,12,20,0,2,0,23,7,4,9,13,22,22,20,10,13,11,14,2,22,1,9,
+        0,29,4,29,9,21,19,22,21,1,7,6,17,19,10,20,4,5,29,18,23,28,15,8,22,6,1,27,16,10,26,7,
+        15,23,19,1,10,5,23,18,13,10,20,26,29,19,10,7,2,4,12,22,12,24,27,21,12,29,26,24,25,5,23,22,
+        26,18,8,9,7,25,2,19,4,27,8,9,16,0,2,23,5,22,25,6,28,20,29,3,25,20,9,24,15,1,7,4,
+        4,1,29,27,8,21,28,20,1,11,28,11,26,8,28,9,17,1,23,8,12,22,11,10,5,23,16,23,11,14,14,12,
+        8,13,11,16,29,21,6,8,16,27,25,3,6,18,25,24,19,4,27,17,27,2,25,1,23,20,23,21,12,14,22,29,
+        12,12,16,28,4,17,3,23,15,23,27,9,15,8,9,11,8,2,25,19,27,23,3,22,12,27,19,16,22,23,12,26,
+        11,3,17,7,9,0,5,19,12,28,22,8,18,29,21,1,1,10,19,18,9,24,22,8,22,3,13,20,16,28,7,9,
+        20,26,14,16,12,8,15,14,18,3,9,17,10,25,8,7,24,10,15,1,27,8,21,1,14,21,5,0,14,25,12,0,
+        2,18,20,10,29,9,18,29,16,21,8,19,9,5,22,18,27,13,23,26,29,8,29,21,9,17,28,23,26,11,20,17,
+        13,3,22,25,10,29,15,23,14,14,19,27,29,14,4,2,10,16,13,27,27,22,27,15,23,23,0,9,13,1,6,1,
+        6,14,6,26,29,2,5,23,12,4,26,21,7,22,15,29,22,20,25,23,9,3,3,4,22,12,3,19,28,13,18,2,
+        1,7,8,25,10,5,29,16,1,11,6,16,28,27,4,17,17,5,20,11,11,0,9,17,4,0,7,6,29,8,25,9,
+        29,20,1,14,18,4,20,8,25,27,22,10,29,5,22,28,8,7,6,7,29,25,21,10,15,11,11,26,23,16,24,16,
+        7,1,3,7,19,3,4,5,0,18,16,1,17,25,12,12,21,28,8,26,29,25,0,24,17,24,2,23,7,21,18,1,
+        10,9,25,11,15,11,6,27,22,6,5,21,28,16,22,10,26,0,10,5,7,13,0,20,8,4,29,22,1,19,26,25,
+        12,2,12,19,10,23,6,22,25,19,8,10,19,23,10,3,23,0,1,25,9,8,27,16,22,16,11,0,13,14,24,21,
+        24,23,5,17,17,12,5,22,10,16,11,21,23,23,8,23,11,21,14,17,4,19,5,22,7,9,11,11,0,7,12,10,
+        21,24,2,1,7,10,27,22,23,17,29,2,19,9,18,0,2,7,22,20,9,12,8,8,16,26,10,15,16,6,29,14,
+        19,10,6,13,7,21,21,3,23,22,3,11,10,17,1,8,24,4,12,16,20,23,9,13,29,29,19,8,5,0,2,16,
+        24,10,0,15,17,17,0,2,1,24,21,15,9,5,10,12,17,27,18,2,9,12,17,7,20,27,10,4,27,19,9,21,
+        14,8,10,16,27,3,8,5,12,23,14,23,19,19,1,15,28,4,14,10,11,27,6,14,6,1,14,3,8,0,27,29,
+        4,25,11,15,27,2,24,17,13,2,19,20,18,1,16,19,29,2,10,7,24,24,2,25,28,10,0,10,29,29,29,23,
+        17,5,12,25,17,23,21,15,24,1,18,4,11,22,12,16,25,14,5,22,6,17,4,24,22,3,15,29,17,23,24,9,
+        29,13,23,15,9,14,25,11,1,7,15,6,7,25,16,6,11,28,10,5,13,18,3,18,12,7,2,26,22,1,17,16,
+        2,26,1,19,20,18,17,24,4,19,14,6,21,21,13,7,13,13,25,3,14,20,5,8,22,14,7,1,12,11,20,17,
+        14,21,27,7,17,8,5,18,8,9,28,16,12,1,28,27,3,6,11,8,21,22,16,26,1,29,6,21,13,19,3,28,
+        23,27,21,18,28,22,12,12,3,1,9,11,2,28,16,7,23,12,28,23,1,8,2,29,20,28,23,8,6,25,27,23,
+        6,17,5,23,13,22,15,16,11,17,20,18,28,15,9,7,1,13,0,29,27,2,10,12,18,21,14,5,11,12,29,20
+    },
+    { // difficulty 3
+        2,17,19,10,2,7,8,20,1,2,19,14,6,8,4,18,13,3,21,19,24,8,22,16,5,4,5,12,28,18,4,12,
+        7,20,20,11,6,23,4,8,5,5,3,28,14,23,17,13,4,17,5,8,8,21,12,16,19,10,22,3,25,13,13,3,
+        14,3,14,2,9,21,7,19,14,24,14,0,11,17,0,20,22,20,5,2,24,23,7,22,9,15,4,9,12,23,11,23,
+        22,19,7,0,15,19,20,23,16,17,0,10,10,28,11,11,9,18,2,9,14,23,27,1,3,16,18,24,10,2,22,8,
+        12,13,11,11,8,18,13,0,19,28,6,18,5,20,4,19,20,21,27,17,17,8,13,4,17,6,21,6,16,19,7,9,
+        28,26,14,23,14,16,4,20,0,20,17,20,29,29,15,13,9,12,11,29,16,29,24,22,27,12,19,29,23,17,26,13,
+        29,22,18,18,14,11,5,0,12,14,20,29,13,16,26,13,0,0,13,25,10,22,4,13,15,0,24,29,7,10,6,26,
+        21,6,14,10,23,20,16,2,11,8,10,16,2,8,26,10,19,26,21,14,2,1,4,28,3,23,12,24,1,14,22,18,
+        12,2,2,10,16,13,19,1,27,5,6,29,16,29,18,12,2,9,18,23,19,7,0,15,8,9,14,7,15,19,13,2,
+        23,23,5,5,29,13,4,16,3,15,15,2,12,6,29,7,21,27,20,29,17,12,23,0,0,19,3,1,10,9,14,22,
+        29,19,10,15,22,15,6,1,12,21,22,9,5,9,0,24,15,29,15,21,16,4,21,9,3,22,26,28,4,11,19,0,
+        12,1,8,5,12,13,27,6,2,13,22,8,12,8,24,21,13,20,14,29,14,19,21,22,0,3,17,25,1,23,24,12,
+        12,8,9,21,21,23,20,23,7,29,9,6,0,16,0,0,14,9,23,6,2,8,19,4,8,8,17,22,29,4,9,15,
+        8,5,7,5,3,22,14,23,5,25,9,9,18,7,17,21,15,8,11,29,17,20,4,12,6,12,11,16,13,17,8,0,
+        1,10,7,9,3,29,14,23,21,6,0,29,9,25,20,20,18,24,17,5,7,29,7,13,0,21,1,13,16,2,19,9,
+        8,13,29,12,20,16,14,11,22,0,1,21,12,19,17,14,11,2,9,8,4,29,7,1,20,10,15,22,13,11,17,13,
+        17,20,15,6,9,29,23,11,4,2,11,11,19,15,18,13,16,8,12,0,10,3,22,1,18,20,6,13,0,0,7,6,
+        7,22,27,29,11,22,18,16,20,0,10,14,12,9,21,17,20,29,16,9,7,21,15,9,5,3,21,13,21,15,13,12,
+        20,2,17,9,15,9,11,9,4,15,9,29,6,11,15,8,3,29,17,1,1,12,9,16,7,26,5,0,9,8,1,12,
+        14,12,10,19,10,10,17,19,7,23,19,10,6,1,15,11,19,29,10,23,12,6,21,9,15,1,21,7,23,8,2,7,
+        19,23,3,21,3,6,13,18,9,17,3,9,10,19,20,13,10,7,15,29,14,3,6,28,21,15,18,23,0,12,15,9,
+        12,17,17,27,13,28,18,17,1,8,17,9,5,15,21,15,6,18,4,7,22,8,3,2,11,9,11,19,9,19,13,9,
+        20,13,18,16,13,6,5,11,6,7,16,21,19,9,21,10,17,18,21,21,18,16,18,1,4,15,22,2,21,1,12,0,
+        28,29,20,11,16,6,5,15,5,28,9,9,19,22,3,20,16,9,16,15,10,3,10,6,9,10,21,23,21,12,16,0,
+        13,6,18,15,7,10,12,2,0,9,14,16,16,15,29,17,7,10,11,18,11,11,27,18,22,7,22,0,8,23,10,8,
+        23,19,20,6,29,8,15,7,8,18,29,18,13,7,7,11,13,18,5,14,8,2,8,7,9,7,3,7,6,13,6,17,
+        12,11,17,27,7,28,18,16,28,8,5,13,7,20,10,6,6,10,21,12,8,4,28,23,8,9,12,15,27,6,27,0,
+        13,23,17,6,8,19,13,16,16,13,4,9,16,9,3,0,7,16,8,16,18,3,2,6,27,6,3,18,22,16,29,23,
+        8,6,27,20,13,28,19,11,23,8,9,9,8,29,9,13,10,14,28,20,29,2,23,8,10,8,7,22,7,7,11,13,
+        18,28,18,9,7,7,9,20,8,19,15,20,6,2,12,10,6,16,8,6,7,7,7,8,19,8,11,20,13,18,29,1,
+        7,6,10,7,17,11,15,11,7,8,20,15,20,0,8,14,13,1,20,23,15,8,8,28,7,13,26,14,6,23,8,7,
+        9,18,12,6,20,10,18,8,22,4,13,10,17,1,0,15,16,29,16,4,2,23,27,11,1,8,29,14,5,8,6,2,
+        1,15,4,22,5,5,14,22,28,14,12,20,27,21,29,1,19,23,4,22,21,15,21,22,9,21,23,17,23,21,22,21,
+        1,23,11,16,22,16,8,22,28,15,20,23,15,22,2,22,2,11,20,3,18,23,21,22,16,21,21,0,4,5,21,6,
+        16,27,21,19,15,5,22,20,22,3,1,4,23,22,2,22,21,20,4,8,6,29,23,13,27,0,13,21,9,22,22,21,
+        10,6,12,12,9,21,23,3,29,20,8,14,21,23,26,8,17,4,22,15,23,21,21,19,13,18,21,22,23,21,6,22,
+        27,10,13,21,29,23,21,23,9,3,0,22,17,22,21,4,5,14,28,5,22,22,23,22,16,15,23,23,10,23,22,21,
+        7,22,8,17,14,28,19,4,8,5,27,19,23,23,23,23,22,28,1,8,16,22,21,21,10,3,10,23,7,11,23,21,
+        2,5,9,14,8,29,15,9,10,25,4,10,23,21,23,22,23,27,23,23,21,22,21,11,7,12,28,21,28,26,22,21,
+        7,20,7,17,21,9,29,22,4,14,12,10,23,23,22,22,29,5,22,28,22,21,21,23,8,7,2,22,1,23,23,21,
+        18,23,8,13,1,13,4,21,9,27,21,3,23,23,12,21,21,6,17,22,23,21,21,21,13,1,21,10,9,7,0,21,
+        7,20,22,22,10,12,23,23,23,20,21,8,23,22,22,21,28,14,23,23,21,23,18,17,22,18,4,10,23,8,22,22,
+        2,17,24,24,10,22,21,12,21,18,1,7,21,21,9,29,1,12,29,10,23,19,21,22,13,9,21,21,13,21,21,22,
+        6,19,21,22,17,9,3,28,20,5,8,4,5,23,10,23,2,10,17,0,10,1,1,18,12,8,3,13,0,2,1,23,
+        23,5,20,22,21,22,0,14,20,11,23,9,9,21,16,15,27,12,2,13,14,7,21,28,23,25,15,21,6,5,22,18,
+        22,9,7,22,0,1,20,20,13,29,21,22,23,22,15,21,21,5,1,20,20,0,10,1,1,18,21,16,7,17,22,12,
+        3,21,15,21,21,15,23,14,11,5,9,29,18,18,9,6,2,23,23,18,23,0,4,23,2,18,0,22,21,21,4,25,
+        5,7,21,8,23,22,2,20,1,23,22,6,0,0,15,2,22,1,29,10,21,18,23,19,10,10,21,7,23,1,23,21,
+        20,0,22,1,17,18,14,10,20,29,22,18,13,9,1,5,5,23,16,4,21,10,12,17,23,10,24,4,8,16,22,21,
+        1,4,10,9,0,17,2,18,7,0,22,11,20,13,11,5,27,21,8,1,8,13,12,19,8,1,17,29,4,29,23,11,
+        10,23,21,9,21,12,2,18,12,4,23,22,21,18,20,4,22,19,13,5,2,21,14,18,22,21,1,21,0,22,23,21,
+        4,23,6,23,17,29,2,2,8,29,13,23,4,12,12,19,5,9,15,8,4,22,17,18,21,9,23,29,2,23,26,21,
+        22,13,9,1,8,20,5,13,15,1,13,12,18,12,23,10,4,13,20,6,9,8,21,8,0,13,7,25,15,23,12,12,
+        23,10,27,18,11,23,13,13,29,10,13,15,10,18,9,12,23,5,18,18,1,18,0,0,22,10,20,0,19,29,10,10,
+        1,13,19,15,13,5,12,0,10,2,1,1,4,9,9,23,28,8,15,10,6,9,8,7,18,2,6,8,0,29,11,21,
+        7,7,28,10,1,7,14,5,12,13,18,10,9,3,22,12,6,17,2,7,15,23,14,8,8,18,10,13,6,18,14,6,
+        2,11,6,12,8,7,14,22,11,18,18,16,3,17,11,18,9,18,0,12,9,8,29,6,22,7,6,18,19,28,15,12,
+        0,2,6,0,15,13,3,11,29,8,13,20,9,14,6,8,27,27,8,18,21,23,5,9,8,10,8,0,8,19,7,22,
+        27,14,17,4,21,6,27,15,29,4,6,3,20,6,27,7,1,9,9,10,16,7,17,20,1,19,6,12,28,6,6,18,
+        8,11,10,27,5,8,11,18,13,14,15,1,8,28,9,9,6,19,17,27,18,4,15,11,22,1,0,26,18,29,16,16,
+        22,19,14,20,20,9,8,20,22,13,14,16,8,5,13,15,1,8,7,18,8,11,8,23,7,10,23,6,7,29,2,10,
+        8,1,11,11,17,20,9,12,7,17,16,14,7,17,15,27,21,9,21,14,8,7,7,22,14,13,26,14,9,4,6,3,
+        23,21,11,20,17,16,18,19,20,8,11,11,18,28,14,6,29,8,5,2,3,2,7,10,11,4,11,6,7,11,22,22,
+        14,1,8,3,11,29,9,13,12,3,18,11,23,23,21,28,6,19,7,20,7,28,7,23,6,7,17,10,22,22,8,6,
+        18,22,23,13,29,22,22,18,12,3,22,22,7,28,22,23,23,23,21,8,23,22,23,16,12,21,21,21,23,11,23,23,
+        14,10,15,11,2,7,22,21,8,6,23,13,6,5,20,21,20,0,26,21,22,23,21,23,9,16,21,23,23,21,23,2,
+        23,16,4,22,20,0,8,17,22,15,23,23,22,8,22,22,7,22,23,8,22,22,21,23,29,6,22,21,21,3,5,23,
+        10,13,2,1,15,8,22,3,23,7,11,21,22,9,21,23,21,14,22,18,22,23,22,21,23,3,23,21,23,23,22,2,
+        6,22,23,21,19,5,15,29,5,27,22,13,14,14,14,28,28,27,22,2,16,21,21,22,21,20,22,23,19,13,23,21,
+        27,22,4,17,20,4,4,6,21,17,22,12,21,21,4,22,18,13,13,21,23,22,23,22,22,3,21,21,22,22,23,21,
+        23,23,19,17,17,21,5,23,22,8,22,20,10,22,23,21,23,13,22,23,21,22,6,23,23,9,22,21,19,21,7,22,
+        22,21,7,17,29,17,19,8,16,23,21,15,21,21,23,21,21,8,28,21,22,21,21,21,21,7,22,23,28,21,23,3,
+        12,11,21,16,27,6,14,3,28,20,10,23,18,23,23,4,7,22,16,12,19,13,19,21,17,5,23,22,12,15,21,22,
+        11,14,19,23,14,6,29,15,7,0,6,5,22,22,23,18,22,7,11,21,14,7,21,21,23,21,21,23,22,9,21,23,
+        11,11,12,11,15,13,28,29,13,19,28,22,22,29,21,21,17,23,22,22,14,4,23,21,20,23,21,23,23,22,23,21,
+        10,14,19,19,21,18,23,19,3,12,7,15,9,23,21,22,23,21,21,15,23,22,22,23,21,9,22,23,1,22,22,23,
+        20,12,21,12,22,13,28,12,12,21,23,23,0,6,23,10,14,23,7,15,10,15,0,22,22,23,21,16,10,23,22,3,
+        23,21,22,9,22,3,22,23,19,12,22,7,18,21,23,2,11,16,8,21,8,2,16,12,23,15,23,1,21,7,28,0,
+        2,21,10,20,22,21,15,16,9,22,1,3,22,18,14,23,11,17,29,22,29,15,16,23,22,22,21,19,10,4,21,18,
+        19,5,10,29,23,23,7,23,22,12,15,21,1,22,1,22,2,6,21,23,17,21,23,21,2,23,21,21,21,2,22,23,
+        10,22,5,12,2,10,14,11,17,12,21,15,7,9,15,10,11,8,23,28,9,15,21,6,9,12,1,7,19,23,16,6,
+        21,16,22,3,13,19,5,12,22,5,12,19,2,6,21,21,8,5,23,16,10,22,16,18,15,4,21,21,23,23,15,11,
+        7,1,5,9,0,12,15,11,11,16,12,11,15,9,23,12,5,6,13,3,23,3,21,22,21,9,5,4,8,19,22,6,
+        8,18,2,8,17,10,1,16,23,14,12,22,23,19,17,11,23,2,17,22,22,0,22,0,15,10,0,21,22,1,1,22,
+        4,27,11,12,2,7,17,7,16,12,9,9,17,21,15,18,23,23,16,11,13,15,8,21,9,22,16,9,9,9,23,12,
+        8,19,20,1,29,2,22,12,22,23,29,13,14,8,8,8,17,23,14,10,17,12,23,8,21,23,15,0,23,15,13,18,
+        28,10,22,9,22,9,5,3,22,20,14,23,19,9,7,16,22,29,15,0,9,11,13,22,12,21,7,9,11,23,21,22,
+        4,0,21,9,27,9,18,10,22,23,13,12,18,12,18,18,2,13,13,7,11,18,23,20,9,7,14,19,0,9,23,11,
+        21,23,16,20,5,6,11,18,0,23,16,14,19,11,9,10,29,4,23,3,16,20,20,20,22,7,20,6,1,22,7,29,
+        9,7,15,10,16,9,15,12,21,1,16,17,16,20,6,27,21,8,13,6,20,23,6,22,8,6,28,6,27,7,15,2,
+        21,2,8,10,8,8,9,13,8,8,8,10,9,10,10,11,22,16,8,6,19,4,22,1,8,5,8,23,3,27,21,22,
+        22,10,14,18,5,29,20,15,21,28,10,18,18,22,10,8,21,6,9,11,4,0,8,6,19,10,23,20,15,7,6,22,
+        22,21,7,20,5,22,14,8,8,7,23,14,23,7,15,9,7,11,22,23,14,8,8,8,29,7,8,22,14,7,22,19,
+        21,8,6,8,6,16,7,8,23,14,17,17,23,11,22,8,10,8,11,17,23,1,23,6,23,1,29,6,7,15,19,22,
+        17,21,15,17,12,3,13,20,21,11,8,19,10,7,21,23,8,7,23,18,18,23,22,29,22,2,7,6,7,29,6,6,
+        19,6,6,9,8,9,9,14,14,20,23,23,14,6,22,21,6,10,14,12,19,6,6,23,22,8,29,9,12,8,23,13,
+        18,5,9,19,3,19,14,17,21,17,2,8,18,28,21,19,21,16,21,23,17,21,21,23,6,21,22,18,21,21,21,5,
+        23,15,28,16,2,21,23,18,21,10,3,8,23,23,23,21,22,23,21,22,12,20,21,21,22,23,16,9,21,21,22,22,
+        14,1,21,3,5,28,23,22,23,21,12,8,15,2,22,21,0,8,2,23,14,19,21,21,23,22,23,22,22,11,21,21,
+        10,23,18,23,29,7,16,22,23,20,12,13,6,3,22,22,21,23,23,21,5,22,23,12,21,15,22,22,21,22,23,22,
+        21,21,20,24,6,3,22,4,22,0,6,22,20,11,21,22,19,7,22,10,21,20,21,21,21,23,23,23,21,23,28,22,
+        0,0,15,5,2,27,26,10,27,10,21,22,10,23,22,22,20,3,12,23,22,22,21,22,21,21,23,21,10,21,23,22,
+        17,22,22,4,15,6,23,23,22,29,21,28,8,14,23,4,20,23,12,23,22,22,16,23,23,25,23,4,15,21,21,23,
+        22,28,6,11,17,10,23,23,11,23,23,16,14,23,11,22,10,9,22,23,23,23,4,9,22,22,23,21,10,21,23,23,
+        23,3,23,20,13,10,22,21,23,20,19,21,22,23,4,23,13,18,21,23,2,22,23,23,23,23,22,21,22,19,22,22,
+        12,23,20,1,23,1,23,21,22,12,22,16,29,29,12,23,28,10,23,13,27,23,23,1,5,22,23,19,21,9,22,22,
+        21,21,13,0,17,4,8,23,5,23,1,22,23,28,29,22,29,23,22,3,14,29,22,14,20,23,21,23,21,22,23,23,
+        21,11,15,17,16,9,22,21,21,6,4,23,8,28,21,21,28,17,20,29,2,11,21,22,23,22,23,21,13,3,23,22,
+        4,22,28,21,4,3,11,2,21,0,21,6,22,23,16,9,23,5,23,0,11,12,21,23,11,23,21,23,19,21,10,29,
+        23,21,21,7,0,22,17,9,22,6,28,21,0,23,21,19,23,19,23,21,23,0,22,26,17,21,23,3,23,22,22,22,
+        14,16,6,4,3,17,18,2,20,22,19,22,23,3,21,6,16,22,22,23,20,21,21,22,22,21,22,22,13,22,23,22,
+        23,10,4,9,29,29,3,21,23,11,23,0,23,19,20,1,7,20,21,21,29,14,1,23,7,4,23,23,16,25,21,15,
+        21,1,13,6,15,20,16,16,22,21,23,21,13,7,26,1,29,5,23,8,9,15,2,19,19,23,23,4,22,21,21,23,
+        20,23,6,19,29,7,20,23,23,9,12,10,12,28,21,19,22,23,11,0,18,23,23,23,21,18,11,2,15,22,21,22,
+        19,2,22,23,13,10,13,0,22,3,29,9,13,22,19,11,23,22,16,12,16,3,19,11,29,15,16,22,16,16,22,21,
+        23,18,24,22,13,1,14,22,22,5,19,22,9,18,22,10,23,10,23,14,11,18,25,3,2,23,22,15,21,23,22,22,
+        18,4,9,7,8,4,17,8,7,19,11,16,28,6,13,6,23,22,11,2,2,0,6,21,22,10,6,23,0,23,3,23,
+        17,23,3,12,16,9,5,14,4,21,17,0,0,18,10,23,21,6,22,23,15,3,11,12,0,9,23,19,21,2,23,9,
+        21,18,0,10,9,6,21,22,22,22,20,15,13,11,14,9,23,22,23,10,8,29,23,3,5,10,21,5,6,22,27,29,
+        3,3,12,12,2,3,29,15,21,2,21,0,20,12,23,20,11,9,23,22,13,3,21,23,6,23,23,23,11,21,23,20,
+        21,21,14,28,13,12,7,15,22,7,11,23,15,22,23,13,23,8,26,14,17,7,18,23,23,12,16,27,6,22,5,13,
+        23,9,15,12,29,10,12,11,8,12,8,20,18,18,1,10,8,23,23,10,7,29,7,6,7,21,12,1,15,6,6,3,
+        6,15,14,6,8,1,5,7,22,16,10,12,16,18,21,11,22,9,6,20,8,11,22,6,22,22,6,23,8,10,0,23,
+        12,13,7,8,9,19,15,9,22,6,23,10,7,16,27,16,22,14,16,17,23,2,22,16,22,23,14,23,10,8,23,15,
+        22,23,22,19,26,16,22,22,22,11,21,14,10,6,23,22,16,7,11,17,19,23,21,22,2,21,21,21,21,7,21,22,
+        10,17,6,10,8,13,22,13,21,21,21,10,1,16,6,23,9,2,22,22,12,17,8,23,22,23,21,9,28,29,6,22,
+        23,18,20,9,11,18,12,7,6,23,16,20,10,22,20,10,23,23,10,28,14,23,21,6,1,14,15,4,21,23,20,22,
+        10,11,6,13,19,8,15,18,29,8,19,16,10,10,23,22,23,25,22,15,18,18,21,22,9,29,7,8,23,8,6,22,
+        9,21,19,5,17,10,13,23,21,13,17,22,18,17,23,3,28,15,22,25,17,22,15,20,7,1,23,17,22,10,21,21,
+        7,10,15,10,5,9,20,17,21,4,0,3,15,14,5,23,22,12,23,23,20,22,22,21,22,2,22,23,22,22,23,16,
+        29,21,13,23,12,12,28,29,17,12,7,23,20,29,22,22,23,28,21,21,15,29,24,21,23,25,1,23,21,0,18,21,
+        29,18,13,17,2,19,6,15,22,6,20,22,3,12,14,24,17,5,29,18,13,23,25,9,5,28,15,23,24,21,22,22,
+        4,21,11,8,13,23,26,24,29,22,23,15,5,26,14,23,15,23,23,18,23,11,15,22,2,21,25,21,5,1,21,22,
+        23,17,7,7,5,18,0,23,4,3,22,3,1,18,25,21,22,23,23,7,17,14,21,22,23,23,22,21,24,22,22,23,
+        22,17,1,2,3,2,5,21,21,17,4,15,29,2,23,0,22,10,21,11,24,17,22,21,28,12,23,23,13,23,23,23,
+        7,1,2,8,8,4,22,6,16,0,0,21,23,28,8,2,28,22,8,22,23,22,21,21,21,23,21,23,22,21,11,23,
+        23,17,22,0,16,29,22,19,21,21,1,17,23,1,3,22,10,11,1,22,21,22,14,23,6,21,23,21,7,22,21,22,
+        18,14,3,1,17,10,7,13,18,2,23,12,22,15,24,21,27,14,23,12,0,23,21,23,13,4,17,11,19,21,21,23,
+        16,2,23,2,6,1,16,22,1,17,17,12,22,21,23,28,11,9,12,4,27,22,23,19,2,21,21,16,4,23,22,21,
+        23,2,12,15,27,23,22,29,9,0,22,7,12,21,13,12,21,21,22,4,23,13,16,23,14,17,23,4,1,16,28,29,
+        19,10,4,19,28,18,6,1,23,9,21,22,9,23,1,21,16,11,21,21,18,4,20,1,9,20,22,21,7,7,21,23,
+        23,3,0,23,9,19,12,5,22,12,4,2,16,23,12,19,22,27,21,22,20,22,0,16,23,20,26,22,21,21,22,22,
+        19,21,15,9,29,19,18,23,22,9,21,9,6,27,2,23,23,10,22,23,11,18,22,15,21,23,21,23,4,23,21,23,
+        1,8,18,10,15,5,13,17,5,23,23,9,23,12,2,21,22,19,8,25,3,19,22,29,20,10,23,18,23,23,23,22,
+        22,14,3,23,12,17,21,6,24,0,10,11,17,25,26,18,23,21,23,29,2,20,10,28,23,23,23,13,22,1,23,12,
+        22,21,10,22,17,25,1,15,1,9,13,29,16,14,10,23,2,14,17,21,22,16,22,26,22,21,23,23,10,22,16,21,
+        3,1,12,0,2,28,29,18,0,13,9,9,11,23,21,20,13,22,23,4,16,12,23,23,16,0,22,12,13,21,21,26,
+        22,9,29,13,17,27,2,23,21,22,22,12,23,22,0,25,23,1,16,16,0,19,16,23,22,17,11,23,10,17,1,5,
+        21,0,0,1,5,27,16,23,11,13,14,18,19,14,22,14,11,15,10,13,14,28,8,16,22,10,19,1,17,2,21,21,
+        1,21,9,12,8,18,18,22,23,1,12,20,11,14,22,6,7,12,21,26,9,13,20,7,21,6,13,0,12,25,20,15,
+        18,7,14,13,16,6,8,18,11,23,10,13,12,6,20,6,0,19,18,4,9,27,21,21,12,15,11,1,4,16,20,10,
+        21,4,21,16,17,27,8,11,23,26,3,18,2,10,12,14,17,9,11,7,12,16,9,29,13,29,23,11,3,27,15,24,
+        23,11,4,16,8,24,29,10,16,12,6,16,11,22,28,22,23,16,27,15,9,5,7,19,19,13,23,13,15,0,2,28,
+        23,13,7,10,17,13,17,6,12,10,18,9,14,20,8,7,10,29,21,2,4,20,14,2,21,23,6,1,13,10,20,19,
+        14,14,28,13,9,0,6,8,21,3,14,13,4,21,14,7,22,23,22,15,8,4,15,7,22,19,23,7,7,17,7,0,
+        6,6,28,17,8,18,9,17,8,1,17,20,4,17,1,28,23,24,15,28,11,15,13,6,27,3,28,14,9,27,29,15,
+        6,21,19,14,9,22,10,27,17,8,11,6,16,14,26,14,2,3,4,4,28,8,12,21,13,18,27,13,23,22,23,6,
+        21,29,7,19,6,2,19,8,23,23,11,14,21,16,28,22,8,16,3,6,12,7,27,8,29,21,23,21,12,27,22,0,
+        19,20,20,10,6,15,9,22,28,8,11,21,21,22,21,17,12,21,19,20,12,6,20,29,22,8,22,7,21,7,10,19,
+        8,13,17,10,14,22,15,17,21,21,6,14,12,23,15,10,23,15,20,28,5,7,21,8,22,22,28,23,7,6,22,17,
+        22,21,17,21,5,15,23,23,21,6,29,4,2,0,22,22,29,23,27,23,17,16,23,1,19,22,22,21,23,23,22,22,
+        7,22,27,14,21,16,22,22,28,11,16,18,9,18,22,23,16,23,9,25,21,24,21,1,22,4,27,24,21,12,22,24,
+        7,7,11,18,28,24,11,22,18,19,11,22,2,12,23,10,17,4,12,21,22,18,23,22,5,11,24,21,22,21,4,22,
+        7,21,1,17,8,22,23,23,27,8,2,23,23,23,23,23,3,27,28,7,7,17,25,20,7,21,11,23,22,19,23,22,
+        28,9,16,21,21,7,21,22,29,22,0,3,9,25,22,23,3,23,22,9,18,17,27,13,16,22,22,17,8,29,20,8,
+        22,1,8,5,11,28,6,7,5,6,6,7,17,3,21,23,2,28,21,14,13,17,23,26,17,7,21,21,11,22,25,21,
+        7,11,22,20,24,18,18,29,23,23,20,12,23,17,23,19,22,16,13,23,9,4,22,21,16,14,26,26,10,22,10,8,
+        7,13,29,18,24,9,22,23,13,12,8,16,12,1,24,23,28,21,15,14,21,21,22,4,12,8,16,4,21,22,14,24,
+        21,7,13,19,12,17,21,18,22,18,22,6,7,25,6,15,27,6,22,20,21,9,27,18,9,17,23,23,24,21,21,10,
+        19,4,7,18,9,23,22,23,4,2,18,4,4,23,25,5,6,2,22,2,26,22,14,18,20,18,21,20,9,12,22,17,
+        22,5,29,10,7,1,26,28,22,15,22,22,12,22,13,9,23,28,28,19,1,18,15,24,5,23,29,8,22,22,21,13,
+        5,22,21,1,9,22,23,22,13,8,21,13,21,23,21,22,27,12,21,6,4,23,23,10,8,6,21,21,22,18,23,29,
+        20,14,23,22,13,12,18,22,14,1,15,5,22,10,21,26,2,12,19,14,18,11,18,2,14,10,22,26,8,24,23,20,
+        23,10,21,4,7,16,24,14,22,22,23,25,2,15,2,4,15,8,0,22,23,12,12,24,22,16,20,0,19,6,11,23,
+        9,12,22,20,25,3,6,21,27,10,22,23,26,25,23,16,21,23,11,28,21,2,11,22,2,18,27,24,17,14,27,22,
+        6,27,15,23,7,12,22,5,10,23,21,22,3,3,18,21,26,18,11,7,17,6,21,18,0,22,0,22,10,5,23,0,
+        0,7,28,8,18,5,21,18,22,19,2,0,3,21,26,23,2,6,18,17,1,9,8,14,18,11,22,15,6,21,13,2,
+        0,1,17,12,2,21,2,0,11,12,28,4,28,17,9,27,8,21,13,8,26,20,15,8,22,7,22,19,18,22,23,23,
+        28,5,1,24,20,15,16,20,0,11,11,16,19,22,23,18,29,10,16,23,17,11,21,27,3,19,16,15,19,1,19,3,
+        22,19,28,18,4,13,7,1,1,18,10,9,10,18,0,23,6,10,28,23,22,0,18,15,23,9,22,8,21,1,8,17,
+        23,19,24,1,28,21,20,6,6,21,13,13,13,23,11,19,15,8,20,12,13,8,5,23,23,2,11,17,3,13,8,17,
+        23,2,18,29,5,2,12,11,6,6,20,10,14,27,9,8,6,22,0,16,10,7,10,8,22,22,22,17,29,24,12,23,
+        20,1,8,13,8,19,5,14,22,4,20,15,8,2,9,10,17,21,17,17,16,7,18,22,3,15,12,19,22,22,19,1,
+        23,24,22,28,1,28,9,19,10,4,13,11,17,19,12,12,22,22,10,9,5,11,8,23,16,27,2,5,1,21,11,25,
+        22,10,17,18,6,7,15,14,1,8,0,20,8,6,9,7,10,1,1,0,15,6,8,7,12,21,8,6,7,13,22,8,
+        7,21,15,20,8,9,16,16,21,6,9,20,10,7,15,14,8,22,23,8,19,16,10,0,23,20,8,23,17,9,2,19,
+        11,12,21,3,8,7,18,19,7,11,14,7,28,12,29,20,8,1,11,14,11,27,10,0,22,22,0,1,10,21,12,6,
+        23,16,12,13,25,8,13,11,23,6,16,1,22,6,14,15,16,6,22,19,23,28,7,8,18,7,19,26,22,22,14,23,
+        20,28,6,19,5,20,9,14,23,18,18,14,29,7,6,11,8,22,28,15,23,29,21,29,14,16,7,8,7,1,1,20,
+        22,11,19,19,6,8,9,14,8,4,0,3,11,7,17,9,10,12,23,21,11,22,8,6,7,23,3,23,0,7,23,6,
+        14,21,11,22,8,21,6,0,7,12,21,17,6,19,7,10,28,17,21,16,18,7,22,14,8,21,22,21,24,28,6,0,
+        23,7,21,15,16,12,9,20,2,9,20,18,13,7,13,9,20,25,20,23,8,14,21,23,21,7,16,8,6,21,21,29,
+        23,21,22,8,17,22,23,23,22,21,22,21,21,22,21,22,23,23,22,22,22,23,23,21,22,22,22,22,23,23,23,21,
+        22,23,21,23,17,23,23,23,0,23,23,21,22,21,22,23,22,23,23,21,22,21,23,21,21,21,25,22,23,23,22,23,
+        3,12,2,4,20,2,24,10,6,28,17,7,19,17,4,13,4,21,21,1,23,21,23,14,23,16,8,24,9,26,22,2,
+        21,21,16,22,17,22,22,23,22,21,23,5,23,22,22,22,1,22,0,21,21,21,22,22,24,27,9,22,21,23,22,22,
+        21,23,21,23,22,29,22,23,23,23,19,21,23,23,23,21,0,8,3,2,21,26,23,23,21,19,21,23,23,23,21,22,
+        27,28,1,23,9,6,22,22,21,10,0,7,15,23,21,22,22,22,22,21,21,21,2,21,21,23,21,23,23,15,22,21,
+        19,3,1,14,19,24,29,11,27,16,0,5,26,13,22,4,14,9,4,5,23,14,28,29,11,29,24,2,10,14,22,24,
+        16,21,16,15,20,22,22,22,7,8,23,12,21,19,22,22,6,23,16,23,21,23,22,21,25,21,4,28,23,22,23,23,
+        26,26,7,29,27,0,21,2,23,21,22,22,1,23,28,21,21,19,21,22,19,6,22,22,21,22,22,23,20,21,21,21,
+        2,23,29,13,27,21,22,23,21,8,12,22,22,25,21,29,7,22,23,17,23,21,22,23,12,22,22,21,22,22,22,23,
+        6,1,3,29,27,27,23,3,13,0,9,1,12,13,26,21,17,21,21,24,22,21,0,1,12,1,23,15,15,9,27,21,
+        23,1,18,27,29,21,22,22,8,22,23,29,21,21,22,22,21,22,22,22,22,23,23,23,23,23,22,23,23,23,23,23,
+        9,19,21,15,9,20,1,10,21,23,13,22,17,4,23,21,23,5,11,22,21,18,20,22,23,4,17,7,14,9,17,22,
+        11,3,12,23,19,5,2,19,18,6,4,28,22,21,23,23,22,21,21,7,22,4,23,22,23,19,21,21,23,22,21,23,
+        16,29,6,10,1,0,26,23,27,19,10,29,28,22,20,5,15,2,18,23,17,28,23,20,25,17,23,27,0,15,18,8,
+        7,10,27,24,24,22,13,21,15,23,27,21,26,13,21,21,23,23,27,22,22,22,22,21,22,22,22,21,23,21,23,23,
+        5,15,11,6,15,22,16,13,5,18,27,19,4,16,23,11,22,22,22,21,2,15,22,21,11,16,23,22,2,22,1,16,
+        9,23,10,9,0,2,15,12,23,3,21,10,22,22,20,11,22,22,23,19,12,23,23,21,21,23,22,22,22,21,22,22,
+        21,8,1,22,26,2,18,10,19,0,2,11,19,20,8,4,4,13,8,15,2,7,15,14,10,9,1,0,5,3,4,17,
+        2,29,24,25,17,27,14,10,21,21,22,23,4,15,21,19,21,22,23,22,21,21,22,22,28,21,22,23,22,22,22,22,
+        12,4,2,13,2,1,8,11,7,21,11,22,22,17,11,23,22,23,9,20,10,1,22,21,22,21,15,22,23,23,21,23,
+        18,18,23,21,19,7,10,11,14,23,9,9,2,9,23,10,22,2,23,23,22,1,23,21,23,23,17,20,22,9,10,21,
+        21,22,21,16,10,22,28,14,23,7,10,7,12,13,0,2,14,11,28,12,26,28,22,13,14,23,19,0,7,13,21,15,
+        21,10,20,22,2,7,11,13,11,21,10,10,0,15,10,9,22,22,18,2,23,23,23,6,21,23,22,22,22,1,21,23,
+        21,22,18,6,10,7,10,14,22,23,13,14,20,7,15,9,23,22,8,21,10,8,6,6,23,21,22,23,8,23,22,23,
+        6,9,14,12,16,8,17,14,23,11,13,16,20,7,10,11,22,23,22,11,13,6,8,23,21,21,22,13,8,22,23,22,
+        21,23,8,19,11,17,16,28,22,27,20,12,22,15,5,1,19,17,8,2,28,27,2,5,23,19,17,21,8,22,18,9,
+        23,6,23,12,6,13,10,11,21,6,14,12,13,11,6,14,22,23,23,9,16,6,6,8,23,7,22,21,7,8,8,8,
+        8,8,17,10,9,6,15,9,23,9,16,15,14,19,6,17,8,22,23,21,17,23,8,6,21,23,23,23,23,21,22,22,
+        23,23,11,9,16,8,9,11,8,19,16,23,8,7,7,8,23,22,21,8,21,8,6,8,23,22,23,14,8,22,23,22,
+        6,12,12,16,12,26,20,12,24,28,8,0,28,9,16,17,15,19,17,7,29,16,0,0,14,26,18,7,22,8,20,26,
+        23,15,12,19,6,8,17,10,21,16,18,17,10,17,7,7,22,23,21,22,18,8,7,8,22,22,8,21,8,6,23,8,
+        21,27,11,0,20,1,29,23,21,2,5,15,28,15,23,23,8,21,0,4,20,28,5,12,20,17,18,16,28,22,23,14,
+        15,11,12,1,18,6,22,23,29,18,17,20,8,18,21,18,5,23,16,21,22,25,28,19,10,29,0,21,22,26,24,22,
+        13,6,20,6,4,8,19,9,28,10,6,25,28,25,19,27,0,4,25,24,28,26,21,9,2,9,20,21,14,10,21,3,
+        7,28,20,28,13,0,21,23,21,27,17,7,14,2,14,17,7,12,12,26,12,26,6,22,9,26,14,17,8,1,21,10,
+        22,27,22,0,5,5,7,23,27,29,8,10,16,23,28,6,17,13,19,8,19,15,26,25,0,19,7,16,21,23,14,3,
+        19,17,16,19,28,29,9,23,27,25,22,22,17,11,20,14,26,8,29,24,10,6,22,5,5,25,20,21,10,3,19,7,
+        24,3,20,5,21,5,18,17,28,26,1,23,25,20,23,16,12,23,22,28,6,0,17,15,14,21,10,9,8,5,7,22,
+        9,29,27,15,23,12,16,22,16,3,11,15,11,19,16,23,16,12,29,9,22,4,27,8,16,8,29,23,26,10,16,12,
+        9,6,27,12,1,15,1,16,22,5,22,2,19,22,21,2,2,3,10,13,14,23,21,21,11,5,17,13,25,11,15,18,
+        18,16,18,9,27,5,23,22,4,20,0,11,9,12,1,11,14,26,29,25,15,26,5,11,22,12,15,10,15,5,29,2,
+        20,26,25,1,19,28,13,18,8,26,0,18,23,10,4,27,23,7,19,4,22,26,12,12,4,3,28,12,2,9,23,11,
+        12,27,9,12,13,9,23,21,10,28,23,0,18,28,22,21,20,27,23,3,3,10,25,1,3,16,18,24,27,25,21,22,
+        22,6,28,14,2,15,3,23,20,28,9,26,28,25,21,19,8,27,3,15,19,21,22,9,0,17,2,17,15,23,1,0,
+        0,29,15,18,6,27,11,14,3,20,29,14,24,1,2,5,16,2,5,19,2,26,9,8,17,18,2,14,24,29,18,5,
+        23,2,20,28,3,15,12,9,17,27,16,6,25,29,8,6,13,12,3,3,0,19,15,20,9,7,7,19,17,26,0,22,
+        22,5,26,29,22,29,4,0,25,28,20,19,18,18,12,26,2,24,18,21,16,16,8,5,20,10,4,1,4,1,15,1,
+        14,3,13,18,0,11,23,12,8,13,22,5,8,17,20,5,25,8,1,19,9,26,22,5,3,26,4,25,7,7,26,6,
+        27,28,10,18,29,17,12,16,22,15,8,2,20,20,21,22,23,18,12,21,18,24,7,10,21,5,2,26,15,9,13,12,
+        16,15,29,27,13,6,12,23,24,8,1,27,15,11,12,28,16,16,12,8,16,5,10,12,15,5,21,21,14,15,12,19,
+        20,7,14,2,19,26,8,18,28,6,22,19,17,28,2,9,21,20,17,0,0,18,2,8,29,3,17,18,26,15,13,2,
+        12,17,19,25,19,27,7,1,15,14,23,1,9,19,12,19,6,7,27,21,21,23,26,1,28,9,17,14,1,21,20,6,
+        27,5,20,18,28,1,8,22,6,25,7,24,22,20,14,20,22,24,18,12,9,3,1,13,29,13,5,9,1,28,26,0,
+        3,6,14,14,8,5,22,12,3,14,16,22,13,12,8,5,3,16,4,6,3,10,8,15,28,1,18,23,2,0,6,29,
+        3,27,0,6,3,18,15,26,28,17,6,5,18,5,15,22,13,29,24,1,27,14,26,27,18,12,16,4,22,17,26,9,
+        14,11,22,8,7,0,18,11,7,7,6,9,18,18,8,24,6,2,26,2,14,17,21,28,12,7,4,8,4,11,5,22,
+        21,18,17,27,4,18,9,15,10,28,9,7,19,1,26,29,7,8,2,24,14,7,11,16,17,25,29,6,15,27,13,15,
+        29,19,4,28,10,16,27,0,25,7,18,17,14,2,27,18,9,29,22,6,13,10,22,17,7,11,9,2,22,14,14,11,
+        29,27,2,27,20,6,10,19,23,18,12,7,23,0,5,3,28,27,16,0,21,16,9,13,25,18,16,19,12,14,5,16,
+        15,17,4,21,28,13,0,10,11,21,17,15,7,12,16,19,27,17,11,8,11,19,14,3,21,2,14,12,26,22,6,1,
+        13,26,11,4,18,3,23,4,24,16,9,3,24,4,20,1,23,2,17,12,21,6,15,8,10,10,10,17,23,3,16,21,
+        11,20,16,18,15,18,20,16,7,11,12,19,28,4,17,26,28,10,25,29,21,8,2,8,5,23,2,18,1,9,11,10,
+        20,21,2,3,25,7,14,8,16,3,26,8,24,7,16,4,15,29,15,0,17,21,29,22,27,7,24,16,0,10,29,15
+    },
+    { // difficulty 4
+        12,0,17,0,17,6,3,3,6,2,10,28,20,9,0,27,20,8,11,27,1,27,20,2,15,16,3,10,23,17,8,14,
+        7,3,12,10,1,29,22,20,18,1,15,10,2,22,16,28,12,8,18,9,15,15,8,1,5,8,0,9,24,18,27,23,
+        16,4,2,25,17,21,15,18,12,19,20,6,14,27,0,5,2,14,9,17,15,5,29,13,14,21,21,5,4,0,7,22,
+        7,28,21,9,29,16,1,20,29,0,4,1,13,1,23,9,0,20,8,29,2,15,22,22,23,5,22,10,5,26,11,23,
+        25,16,3,10,3,27,17,29,11,15,27,22,9,1,0,11,28,16,12,18,15,20,2,7,16,8,18,25,21,26,18,25,
+        9,18,22,17,3,15,4,10,27,12,4,0,28,24,15,27,15,2,10,6,11,11,23,24,5,16,3,27,12,26,22,29,
+        5,8,13,16,29,8,17,11,19,19,27,7,24,22,5,28,5,29,3,20,21,25,8,26,0,20,16,18,7,13,23,24,
+        17,21,3,10,3,1,29,14,10,7,14,21,28,19,12,14,15,12,8,15,5,15,23,1,13,12,15,28,26,9,15,17,
+        17,21,28,11,22,2,1,17,5,17,23,1,7,20,12,10,21,4,6,12,13,23,28,5,17,11,6,0,16,21,29,14,
+        13,4,1,22,18,13,13,14,19,12,18,21,20,23,0,10,22,1,7,23,18,5,8,2,15,28,28,28,25,27,15,21,
+        23,16,17,8,25,29,19,10,6,27,29,12,4,17,8,14,2,8,17,17,14,26,20,1,13,3,22,0,14,25,19,19,
+        10,19,16,29,13,29,2,13,17,15,25,6,22,20,5,22,3,23,18,10,1,15,1,17,10,27,23,9,2,7,22,29,
+        11,18,11,10,29,0,18,22,22,13,6,15,8,7,11,19,0,20,24,11,1,19,23,14,8,23,1,8,29,26,29,25,
+        11,11,5,9,27,21,10,9,14,22,10,10,0,8,6,9,15,13,4,10,8,23,7,14,11,7,12,14,12,7,26,22,
+        9,6,5,5,12,29,18,16,3,22,11,26,28,7,1,13,23,21,18,17,10,5,13,2,6,0,6,6,16,1,1,18,
+        18,9,8,23,7,11,12,19,14,10,8,12,4,5,5,2,17,20,19,29,17,8,12,5,11,21,23,1,16,6,15,16,
+        29,17,17,3,22,4,2,19,20,11,20,15,11,9,22,9,7,12,14,13,1,8,15,12,2,4,2,23,23,17,2,22,
+        7,14,15,21,17,17,18,12,5,19,22,3,13,13,15,5,16,18,0,27,15,26,21,17,7,10,27,17,2,12,16,10,
+        20,19,22,21,29,23,14,2,10,0,13,3,23,10,21,21,14,28,8,20,22,2,23,4,6,20,20,18,20,29,16,29,
+        5,16,28,21,29,13,6,12,16,14,14,10,12,16,18,22,8,4,11,9,5,12,0,10,21,9,23,14,16,8,13,0,
+        29,22,6,29,1,3,5,20,8,22,19,7,4,10,23,28,16,11,7,16,3,14,15,12,7,8,11,22,4,2,17,18,
+        23,4,19,3,3,16,29,14,14,17,11,7,2,9,1,17,19,9,9,12,9,18,12,1,15,16,9,13,19,11,18,4,
+        13,5,7,2,26,3,23,6,1,27,19,11,2,18,17,19,8,17,16,10,23,3,11,16,7,20,10,16,21,17,14,9,
+        0,16,15,1,6,14,17,4,12,20,7,8,15,1,8,6,6,5,29,19,18,19,11,18,20,10,20,8,29,2,11,6,
+        7,21,7,7,0,14,10,20,21,11,15,9,0,10,12,28,6,3,1,19,12,8,6,1,6,14,10,0,16,20,19,6,
+        8,22,13,15,29,27,14,17,6,27,6,8,6,23,6,14,7,13,7,15,14,28,21,11,15,7,23,18,10,2,7,0,
+        15,8,6,19,1,27,17,11,23,6,2,1,10,1,1,9,9,0,10,0,8,14,28,29,18,8,3,8,2,11,7,0,
+        19,19,6,17,12,29,13,19,7,14,2,9,0,0,24,19,13,16,0,14,2,8,15,20,8,11,4,0,22,7,6,7,
+        22,9,10,8,11,10,8,16,6,11,7,17,25,3,15,1,19,13,12,6,2,15,7,20,12,21,14,27,14,24,18,21,
+        8,7,7,14,10,16,22,10,7,18,17,12,17,11,16,29,19,23,17,28,17,8,5,6,13,21,6,7,7,6,0,17,
+        7,2,5,14,13,7,14,28,28,7,14,19,2,17,18,28,23,23,2,6,27,7,7,8,22,7,7,8,0,18,8,18,
+        20,1,7,15,17,10,0,22,1,6,12,9,22,11,24,22,6,27,22,20,15,2,18,8,1,8,20,28,11,11,7,1,
+        19,16,6,2,12,21,15,15,14,14,27,18,22,1,3,21,0,29,13,21,0,21,21,21,15,11,23,22,23,23,23,22,
+        23,21,23,23,6,27,23,21,0,23,29,23,21,21,19,19,4,2,23,7,15,0,3,21,23,8,28,21,13,22,28,22,
+        12,2,8,22,1,29,23,21,11,13,2,3,3,23,21,3,1,15,22,0,0,21,22,6,2,21,23,22,23,27,22,21,
+        18,0,9,9,16,13,3,12,16,15,16,19,6,17,3,17,11,2,22,28,21,23,21,0,8,7,21,23,12,21,22,23,
+        10,11,23,13,20,22,21,22,7,23,23,19,23,19,23,22,0,29,17,21,21,22,23,23,0,9,22,21,23,23,23,25,
+        26,4,22,16,11,5,19,18,22,19,28,22,23,21,0,6,23,19,23,22,22,23,22,21,13,14,22,21,23,23,23,21,
+        4,22,0,22,19,5,23,23,10,16,21,11,13,23,8,11,20,22,11,5,9,8,21,21,0,21,27,21,23,22,23,22,
+        10,27,13,23,23,29,12,21,15,19,14,21,21,23,13,21,23,2,14,23,8,22,21,17,14,22,21,23,22,19,22,23,
+        3,22,21,20,17,20,23,23,5,10,20,22,20,5,23,21,23,22,21,29,17,21,14,0,21,29,23,21,21,9,21,23,
+        28,27,14,2,23,2,22,22,6,17,19,21,14,17,10,22,4,5,20,3,5,21,16,23,19,21,29,27,23,21,21,23,
+        20,9,11,21,11,23,22,29,20,11,7,14,8,11,21,10,22,10,22,23,23,23,23,19,13,2,22,22,25,21,22,23,
+        4,16,14,22,17,29,13,21,14,22,10,2,5,22,17,17,22,26,12,22,10,21,11,22,20,1,2,23,22,22,23,22,
+        14,14,4,8,23,19,9,11,29,16,29,8,8,18,22,18,22,11,4,8,14,23,12,8,6,4,10,17,21,16,21,22,
+        3,15,4,10,16,22,22,10,29,14,22,7,21,21,17,21,23,14,15,0,20,15,11,15,7,22,21,21,22,23,21,23,
+        16,2,23,15,23,5,9,9,1,23,8,12,23,21,22,13,22,5,3,2,15,12,22,22,0,22,13,22,13,22,21,25,
+        8,23,23,22,19,10,15,10,15,6,15,8,22,8,22,20,23,11,23,6,23,21,10,22,0,10,1,19,22,23,21,22,
+        15,16,2,1,15,20,13,20,22,10,6,21,10,2,7,10,23,2,3,12,10,5,20,1,0,14,21,1,21,21,13,23,
+        10,14,16,23,25,15,11,9,11,13,9,3,16,9,0,18,22,21,16,16,1,14,17,21,0,7,16,9,21,12,1,17,
+        11,22,16,23,16,23,13,11,19,12,22,21,18,22,3,21,6,16,12,15,17,0,2,2,10,10,21,22,29,22,16,21,
+        16,16,9,19,22,12,13,0,15,4,23,22,19,2,14,12,0,3,20,1,0,19,15,1,23,13,17,2,22,23,5,1,
+        8,17,8,16,0,6,13,9,21,17,13,3,8,5,11,12,14,28,2,14,3,8,7,11,1,20,13,13,1,17,11,17,
+        12,20,16,3,4,22,9,11,1,3,0,12,19,6,8,15,17,29,8,27,13,6,3,2,12,22,9,15,18,20,7,2,
+        15,18,7,1,15,23,28,10,22,4,14,17,9,2,19,1,7,14,6,8,9,22,0,20,14,18,16,19,13,6,17,17,
+        23,0,16,15,5,15,18,9,17,11,1,13,13,14,10,2,11,16,27,2,9,18,11,6,1,19,17,1,1,15,1,11,
+        29,9,3,22,6,6,13,0,2,4,14,23,27,12,20,6,21,22,16,13,13,6,0,28,16,21,10,29,7,21,17,23,
+        23,7,20,19,7,21,5,20,0,29,15,3,11,9,29,29,21,14,18,16,20,16,29,6,19,21,2,12,9,1,7,0,
+        7,21,11,5,1,21,10,6,11,13,23,18,20,0,17,12,22,10,13,12,8,16,13,2,7,11,22,8,6,11,4,2,
+        28,11,29,6,1,3,9,19,18,14,15,10,10,9,7,22,7,7,7,0,7,21,8,23,6,7,11,6,23,7,9,8,
+        0,11,18,8,6,22,11,19,22,11,14,17,28,23,6,12,23,12,6,16,6,27,13,8,8,8,6,8,6,7,7,23,
+        20,21,21,5,13,7,20,8,22,0,7,11,6,8,6,8,10,26,16,17,18,8,4,7,20,15,8,25,6,8,29,8,
+        7,13,27,15,17,8,29,18,8,14,12,16,6,12,22,21,19,9,20,6,7,22,7,7,23,11,8,8,3,23,21,22,
+        5,13,18,8,15,27,15,10,22,12,14,16,27,16,10,7,19,7,6,8,17,5,21,3,11,16,2,8,8,6,8,17,
+        22,28,13,23,6,8,22,21,10,28,21,27,21,21,21,15,23,11,23,21,27,9,23,21,18,21,22,19,23,22,21,23,
+        21,22,23,27,27,22,15,9,28,22,12,23,21,21,28,29,3,13,5,23,21,21,13,22,21,23,21,21,23,22,23,21,
+        22,28,29,19,17,28,27,18,21,22,21,2,6,23,21,22,11,4,18,3,23,3,23,21,9,18,22,22,21,21,22,22,
+        3,22,12,14,21,3,22,22,13,8,22,22,22,23,22,0,8,15,17,22,21,21,21,23,3,17,16,22,22,22,21,23,
+        1,13,22,20,17,19,22,17,21,18,23,23,23,21,23,2,22,23,21,23,22,22,9,21,18,21,22,23,21,22,22,21,
+        4,5,11,22,2,0,21,23,4,29,9,23,22,23,22,23,22,16,24,22,23,23,23,23,27,6,23,21,21,21,21,21,
+        21,22,17,21,2,11,23,22,21,2,4,22,23,21,14,22,13,22,22,21,20,21,21,23,27,15,22,21,21,22,23,21,
+        21,9,23,22,27,13,6,17,17,22,19,29,21,22,23,4,16,17,22,22,21,22,21,22,2,14,22,23,21,21,22,22,
+        21,21,11,16,19,23,27,21,15,19,16,23,14,22,13,17,9,21,23,5,21,23,22,21,21,2,23,21,23,23,23,22,
+        14,7,23,2,5,13,21,21,2,21,10,21,17,11,5,5,8,22,20,23,19,23,21,23,0,1,22,21,23,23,23,23,
+        19,5,20,17,11,16,22,14,2,11,1,11,20,13,2,22,2,10,20,8,23,23,20,21,2,23,29,21,10,22,21,23,
+        6,17,18,17,17,22,22,21,23,23,1,11,22,22,1,2,0,19,22,8,21,22,23,23,19,16,22,22,22,21,23,22,
+        23,4,23,20,8,19,2,11,23,4,28,21,15,22,23,22,22,23,12,23,12,17,22,18,22,21,18,16,12,23,21,21,
+        21,8,5,20,10,0,22,23,23,8,18,15,12,22,11,21,21,23,19,22,21,22,21,18,23,23,21,21,21,23,21,26,
+        6,22,8,15,22,18,21,23,21,16,21,8,0,18,23,2,4,6,18,21,21,23,21,22,19,0,22,14,21,22,24,17,
+        28,22,5,17,8,1,22,21,4,2,7,5,5,21,5,11,27,9,0,12,22,23,23,22,2,11,22,21,23,21,22,21,
+        22,8,16,5,0,2,3,4,29,23,12,18,1,21,23,16,8,18,14,0,0,13,22,13,21,21,22,0,6,22,23,21,
+        21,17,16,7,8,3,21,11,23,19,22,9,12,12,11,9,23,7,17,20,8,23,17,3,1,0,21,15,21,0,19,22,
+        10,21,2,17,18,7,18,10,21,21,11,10,6,23,7,23,12,21,1,12,18,13,23,22,3,24,1,15,1,22,0,22,
+        6,8,20,1,19,2,11,15,23,18,1,15,18,16,18,9,22,8,28,22,15,17,17,14,6,19,23,18,17,21,22,11,
+        5,27,5,2,16,7,5,6,5,16,14,11,1,20,8,14,18,1,23,11,6,23,0,17,23,2,2,12,13,6,15,21,
+        21,8,17,2,4,1,4,18,11,9,1,17,9,15,11,10,21,21,4,14,12,5,5,6,14,20,23,18,17,17,15,13,
+        23,5,15,3,0,7,17,9,21,22,6,18,3,6,21,14,23,13,17,14,18,0,19,1,23,4,16,14,2,18,14,7,
+        15,13,6,15,6,20,3,7,19,29,19,20,3,16,21,20,22,20,2,18,18,7,8,8,22,5,21,17,23,19,15,6,
+        16,5,16,18,13,6,20,16,6,13,15,14,0,19,7,20,22,21,10,9,14,6,10,22,4,14,23,11,24,10,28,16,
+        22,21,28,20,9,8,21,5,23,15,16,23,15,7,6,16,22,21,6,20,17,0,2,3,15,10,22,28,1,10,16,23,
+        22,5,7,7,18,18,14,18,19,10,14,29,10,6,18,9,23,28,17,15,19,23,20,22,14,20,19,27,12,13,18,7,
+        21,0,7,5,5,1,1,19,17,13,14,13,12,28,17,17,9,28,14,19,7,0,8,22,12,17,14,6,9,4,27,23,
+        9,23,9,23,6,6,8,16,12,17,17,11,8,15,3,8,7,28,8,7,12,23,23,22,8,21,1,23,10,22,28,8,
+        22,29,8,6,18,13,22,10,19,22,15,12,15,6,29,22,1,0,13,8,21,23,8,16,11,6,18,7,2,7,22,21,
+        22,21,18,18,6,16,15,16,23,11,9,7,8,7,19,6,18,0,6,7,12,7,21,23,23,3,8,7,22,23,6,21,
+        7,21,13,13,8,1,7,23,21,12,17,23,11,17,21,15,21,15,7,21,17,12,2,8,15,16,8,22,15,8,6,6,
+        18,17,15,11,13,9,9,21,21,7,12,7,12,2,0,15,10,6,22,22,1,12,7,3,23,0,23,21,26,9,23,23,
+        23,4,15,11,18,3,17,21,22,16,21,12,26,12,10,28,20,22,6,29,19,23,3,26,22,6,21,23,21,16,23,9,
+        10,23,2,18,20,4,3,22,22,19,8,14,3,18,14,29,8,24,21,23,19,3,1,27,23,23,23,28,21,21,3,7,
+        22,4,25,9,3,3,27,21,23,23,16,22,2,2,18,13,7,7,22,14,9,11,11,1,22,29,23,19,22,27,11,23,
+        22,5,2,29,25,1,16,10,23,22,23,14,20,12,21,22,21,14,21,14,28,16,4,20,4,22,23,8,23,21,23,1,
+        8,26,21,2,15,10,20,3,17,26,23,8,21,17,21,23,21,9,20,19,20,13,29,8,21,29,21,21,22,26,22,23,
+        8,13,9,29,17,14,13,14,22,23,19,20,7,2,3,16,22,22,21,0,0,21,20,22,23,4,23,23,21,22,23,11,
+        22,16,21,4,14,5,23,28,23,8,23,7,18,23,23,10,21,21,23,23,5,22,13,23,22,23,26,21,21,22,21,12,
+        5,21,21,17,14,5,8,17,28,20,11,7,6,16,10,13,13,23,4,11,22,23,23,21,12,23,26,21,21,21,21,21,
+        10,29,14,19,19,15,12,5,2,11,22,11,17,14,29,11,21,16,2,19,8,14,21,9,21,23,23,22,21,14,22,26,
+        20,14,14,25,20,28,5,23,22,10,20,11,17,8,14,2,22,21,20,7,7,23,14,23,27,14,23,24,23,23,23,15,
+        23,28,3,14,13,14,21,18,12,21,16,14,17,14,2,8,6,2,21,29,7,10,23,16,5,14,21,22,4,25,23,22,
+        25,21,6,2,20,7,21,18,21,21,12,8,18,5,20,11,23,19,22,29,8,12,15,5,23,23,21,23,23,23,21,6,
+        19,14,16,2,14,12,9,1,9,8,2,5,12,5,15,22,21,23,21,15,18,13,5,19,23,12,9,15,21,22,22,14,
+        21,21,15,8,2,5,22,16,23,8,0,8,21,8,7,2,21,7,23,25,23,18,20,15,12,12,21,3,23,23,22,23,
+        4,0,21,14,2,28,11,20,23,28,0,13,5,20,4,23,21,22,22,28,22,15,11,15,23,8,9,22,22,17,0,2,
+        21,19,12,8,5,9,2,11,22,21,28,17,18,3,18,23,13,3,2,22,13,11,6,20,0,21,9,18,23,11,17,29,
+        22,20,20,5,18,3,0,18,14,17,3,1,6,15,6,20,21,17,9,5,10,12,22,22,4,10,22,16,21,21,16,16,
+        29,20,9,8,1,1,20,18,8,21,8,3,12,9,22,0,23,3,22,3,18,19,17,6,22,2,23,1,20,0,17,16,
+        22,1,4,13,12,3,22,20,21,18,0,6,3,16,16,6,22,1,3,18,18,16,19,19,12,28,0,18,16,21,19,6,
+        22,7,8,2,0,8,19,21,11,12,12,10,12,10,17,19,6,16,8,2,2,7,12,9,23,6,23,13,21,11,10,10,
+        21,1,2,7,4,9,16,1,23,7,15,14,7,8,15,18,21,1,5,2,27,9,22,11,23,23,23,16,0,19,7,1,
+        21,16,8,2,19,4,9,9,22,21,10,12,10,18,16,20,23,14,14,5,23,2,15,8,0,10,23,16,15,16,8,22,
+        23,15,3,11,7,19,1,24,22,16,11,4,11,26,2,12,9,21,23,17,3,8,13,8,23,24,22,17,2,5,13,10,
+        15,23,16,8,0,7,14,29,21,23,7,16,11,28,4,20,12,27,22,28,11,8,7,0,2,16,29,11,8,9,26,9,
+        23,23,13,29,17,13,20,16,9,8,10,10,16,2,23,23,13,4,22,5,17,15,13,6,21,21,17,14,22,3,13,15,
+        12,12,4,27,8,14,11,16,22,4,6,14,8,13,18,7,22,14,17,11,14,0,8,22,3,29,21,0,23,13,17,8,
+        22,18,28,7,7,18,16,10,13,22,14,18,9,26,28,5,21,1,20,15,19,4,14,27,23,18,23,18,22,9,11,8,
+        17,4,21,10,9,18,21,10,23,21,9,18,4,21,6,9,21,23,21,23,3,7,27,22,21,22,15,8,17,21,8,4,
+        23,10,17,7,8,23,23,22,17,18,23,10,15,6,8,27,1,22,6,4,29,21,7,7,22,7,21,22,23,12,23,23,
+        21,20,6,8,13,7,23,6,20,22,22,27,18,6,6,6,22,17,22,21,21,20,21,23,23,21,23,11,8,23,8,6,
+        23,16,23,7,15,27,22,9,21,11,15,10,9,7,21,8,23,25,9,18,7,13,21,23,13,23,22,22,23,17,6,6,
+        29,20,4,1,14,18,9,29,21,0,3,17,12,10,5,20,16,6,28,17,16,13,23,21,0,27,19,23,4,24,16,6,
+        0,6,4,3,24,11,9,6,23,9,22,28,22,23,19,19,2,19,11,25,22,28,18,2,19,6,21,2,7,22,12,11,
+        12,7,12,1,14,16,23,9,22,22,23,19,9,5,24,22,20,11,2,14,23,22,28,22,17,3,23,15,25,21,23,17,
+        4,22,19,4,21,3,0,11,1,22,14,27,16,8,28,24,13,25,10,27,25,13,6,0,15,11,24,5,22,11,3,15,
+        20,20,6,22,20,10,2,23,5,14,19,25,2,21,3,7,21,9,0,14,22,10,28,22,20,29,18,19,21,13,6,21,
+        15,23,15,7,8,2,2,12,23,7,1,14,4,15,23,26,21,0,23,7,5,27,21,21,23,23,23,15,14,24,6,21,
+        10,13,5,1,11,17,21,22,21,22,19,15,8,4,24,1,16,22,22,21,22,29,17,1,9,23,21,23,28,23,22,23,
+        22,22,21,5,10,18,6,15,25,22,14,20,16,20,19,14,13,21,2,19,2,18,21,21,22,22,13,21,3,22,26,4,
+        23,14,20,11,24,1,4,3,15,23,20,8,1,17,12,25,20,11,27,28,23,29,7,0,20,23,22,21,27,10,14,0,
+        23,17,11,20,17,6,26,19,21,6,5,2,17,20,0,14,21,3,5,22,17,27,10,17,8,21,12,16,24,11,23,23,
+        2,11,18,20,20,19,28,23,28,23,16,0,21,14,13,21,22,10,8,6,23,5,11,21,21,2,27,26,21,21,22,3,
+        8,8,21,17,16,4,10,21,23,22,5,19,19,26,13,7,2,26,8,29,12,1,21,28,14,8,3,18,1,1,22,19,
+        23,18,18,5,20,12,14,25,22,11,14,9,29,26,22,20,22,2,17,21,17,0,10,22,2,25,5,27,17,16,26,21,
+        27,22,4,17,16,3,28,6,17,25,10,28,0,17,9,2,21,21,16,2,27,25,11,2,28,23,22,24,13,9,18,21,
+        23,19,8,11,8,16,1,9,21,23,11,12,12,10,5,9,28,8,1,13,0,2,4,22,23,12,23,20,22,22,25,19,
+        23,0,18,11,2,23,27,13,21,18,19,23,2,11,23,21,21,8,9,3,17,5,11,20,13,12,1,27,6,22,17,24,
+        19,1,15,19,9,13,4,21,19,16,12,10,6,5,25,6,10,25,28,5,14,15,18,13,22,3,17,29,14,0,24,21,
+        22,1,17,1,5,1,14,13,7,22,15,2,0,26,20,5,23,5,21,16,0,1,17,19,22,3,7,20,20,0,1,17,
+        23,17,20,16,6,0,20,29,14,17,21,26,1,2,6,0,22,11,4,18,21,20,17,8,22,9,21,21,22,21,22,23,
+        21,19,2,8,1,5,6,17,22,20,22,12,16,6,6,17,14,22,21,4,6,10,14,25,23,23,21,11,27,28,19,0,
+        22,15,8,6,19,16,3,22,22,0,4,19,6,6,10,25,6,23,17,28,24,13,0,22,23,26,23,24,6,21,2,11,
+        10,14,17,5,2,4,10,14,26,7,15,10,21,1,9,8,22,23,11,11,18,22,28,11,6,20,5,27,23,0,17,9,
+        22,10,17,2,2,5,13,29,21,10,5,10,7,14,1,12,22,21,7,19,21,2,2,22,23,17,5,21,15,7,7,25,
+        25,17,19,2,15,9,12,15,21,6,21,15,27,15,16,11,21,19,10,9,21,28,2,22,25,17,19,25,9,20,9,23,
+        20,22,6,9,14,2,17,7,0,6,15,7,2,6,5,7,23,22,15,22,6,3,14,26,8,3,11,10,18,17,14,19,
+        21,15,19,0,29,7,23,6,23,13,10,4,13,11,23,23,2,29,16,9,10,1,17,15,25,14,9,5,1,16,10,21,
+        6,4,15,29,13,4,20,27,1,0,17,9,19,8,8,18,12,21,7,19,29,15,6,27,22,0,6,17,22,5,7,17,
+        0,13,13,5,14,16,8,10,29,5,28,3,7,9,23,6,17,19,29,9,9,8,27,2,20,3,4,28,6,23,16,17,
+        6,21,21,8,9,24,1,28,20,22,8,12,24,10,3,25,0,0,8,11,8,23,0,25,28,1,10,17,21,27,15,20,
+        13,17,27,19,29,18,3,18,22,17,17,28,13,14,2,10,28,19,17,17,15,11,1,7,12,5,8,22,22,1,5,8,
+        23,19,7,15,12,8,6,8,9,22,23,22,21,21,13,22,21,0,21,21,16,14,4,7,13,14,7,6,22,21,6,21,
+        28,23,18,7,11,11,29,29,9,14,23,23,13,27,27,17,18,0,19,12,2,16,15,4,18,13,22,26,14,7,7,13,
+        8,22,17,23,28,4,21,15,5,21,13,18,1,9,9,27,1,21,27,23,7,13,12,22,4,26,4,22,26,15,29,24,
+        22,8,13,3,13,16,10,21,5,14,6,23,14,27,24,3,28,26,1,5,8,22,7,29,23,18,9,7,26,4,18,6,
+        28,7,21,11,17,5,18,20,3,16,21,14,8,4,1,6,22,9,12,27,29,12,4,18,21,2,21,27,1,17,20,22,
+        20,17,5,26,22,6,29,17,9,11,29,14,20,20,22,21,12,29,29,16,11,16,6,29,14,29,15,29,14,17,22,19,
+        20,16,20,3,5,10,19,8,20,3,14,17,6,4,7,17,25,23,22,3,16,15,2,21,25,17,1,3,19,12,19,7,
+        22,28,12,4,3,8,10,23,7,18,21,2,20,7,27,17,19,29,1,20,13,25,4,15,28,25,24,11,0,18,22,21,
+        23,26,4,2,17,8,16,9,27,22,23,11,27,11,28,20,1,21,4,14,18,21,19,18,3,2,7,26,18,23,23,21,
+        11,19,29,21,13,23,19,21,9,25,20,14,1,15,21,29,4,29,1,3,23,3,8,19,4,27,11,28,2,19,23,3,
+        1,29,6,21,12,9,16,13,9,10,3,11,7,10,15,23,20,26,21,21,7,2,11,22,6,4,19,3,5,11,28,22,
+        19,20,11,11,14,0,24,27,13,11,6,6,2,25,11,1,14,8,11,2,15,15,3,23,14,6,2,22,3,29,27,10,
+        22,11,14,14,2,2,9,25,1,28,27,17,28,1,6,14,8,23,22,26,28,21,23,14,8,10,23,21,23,23,18,22,
+        4,15,2,9,7,16,20,0,23,20,16,1,17,8,6,19,12,12,8,8,18,17,12,16,9,10,21,21,3,18,18,22,
+        14,23,21,25,0,3,11,18,11,0,12,13,8,29,12,22,23,12,8,29,12,12,3,17,1,22,12,25,16,19,6,27,
+        20,29,17,14,15,21,24,7,5,8,4,15,6,5,3,15,21,1,2,23,18,16,18,11,23,2,13,15,9,1,25,18,
+        23,21,4,14,14,6,12,23,23,8,0,11,0,16,5,8,12,21,22,18,15,20,22,2,2,13,28,23,26,9,22,12,
+        22,29,20,20,24,18,17,6,9,8,18,17,5,15,13,15,14,22,11,28,23,10,22,12,24,4,26,2,23,19,20,2,
+        17,8,1,15,29,18,1,19,17,29,7,2,29,13,1,7,25,13,23,25,25,24,4,11,5,13,7,23,12,21,20,3,
+        23,1,12,14,8,17,14,8,19,17,23,14,8,28,6,17,6,2,13,12,12,8,1,2,17,18,0,23,28,29,12,7,
+        23,29,0,0,18,13,7,22,4,19,6,1,18,19,5,28,15,6,14,29,1,10,19,2,22,28,9,24,15,0,0,16,
+        29,29,13,5,6,7,23,13,7,15,29,8,7,0,6,21,1,22,11,19,12,1,7,14,10,22,2,20,3,4,27,14,
+        20,14,7,23,12,14,6,6,7,10,17,18,8,12,14,5,13,11,18,8,8,16,5,6,19,22,8,0,13,5,17,11,
+        20,5,12,20,26,10,21,1,13,23,7,2,7,22,2,10,21,6,6,9,17,4,2,7,14,24,1,8,29,4,16,19,
+        19,1,5,2,13,5,2,2,20,23,10,26,4,21,1,13,7,10,2,14,16,12,2,16,19,27,18,14,11,0,8,16,
+        22,15,27,15,25,28,4,17,11,17,20,19,21,8,3,5,20,21,8,2,22,23,24,23,7,4,13,14,1,18,11,10,
+        11,2,5,13,19,4,28,16,15,3,9,28,20,21,19,23,15,23,14,2,5,0,7,23,21,25,9,5,9,16,12,26,
+        9,16,16,17,26,15,19,16,22,11,21,3,23,23,17,27,13,20,27,11,2,11,23,18,28,8,24,6,21,24,8,13,
+        3,3,11,13,4,22,26,12,22,22,29,16,4,7,18,24,21,28,10,15,1,8,4,15,22,10,19,22,16,19,9,11,
+        23,27,15,12,20,7,13,17,8,28,28,10,9,24,16,9,15,11,18,1,12,13,28,19,0,0,5,24,6,14,28,16,
+        22,18,0,29,5,26,11,22,23,10,8,23,19,7,1,24,26,4,27,0,14,3,19,6,2,7,3,28,6,1,16,7,
+        23,21,12,22,4,6,17,2,2,20,15,17,15,18,2,23,23,24,12,0,26,8,21,15,12,23,9,27,12,4,20,7,
+        21,27,20,16,28,1,22,12,6,14,5,21,13,22,9,6,21,0,3,21,10,21,23,10,19,22,11,18,17,5,21,18,
+        23,27,15,16,7,14,17,6,10,23,14,14,24,8,14,0,10,25,29,26,16,12,7,24,9,14,7,28,0,7,20,16,
+        22,22,25,21,19,8,21,21,21,3,13,15,20,28,23,21,22,22,29,11,23,21,23,21,21,23,21,25,26,22,22,23,
+        23,11,4,26,17,29,21,21,21,29,28,22,19,22,21,6,15,21,8,20,22,23,20,23,10,11,25,21,23,21,21,22,
+        19,20,21,8,26,9,29,12,23,9,15,16,15,27,21,15,3,19,3,26,22,13,21,11,22,16,28,11,8,21,5,4,
+        7,22,18,23,17,21,21,23,29,22,16,17,22,16,29,22,23,14,9,11,22,21,23,21,23,0,21,22,8,22,23,21,
+        2,23,14,7,20,12,17,14,3,19,13,19,7,29,7,8,15,14,23,6,11,11,25,17,3,23,23,7,28,25,18,9,
+        5,5,6,14,20,14,21,21,7,23,7,14,7,27,18,22,2,0,2,14,22,5,22,23,1,1,16,29,13,24,18,21,
+        22,7,23,17,5,9,2,5,3,17,10,9,4,2,29,15,11,4,23,16,19,24,26,6,2,23,26,8,7,21,10,18,
+        14,6,7,27,14,29,20,21,20,16,0,17,13,7,6,21,22,22,26,2,2,18,23,0,21,14,8,25,23,3,11,3,
+        13,6,13,0,13,20,5,14,21,21,28,10,7,19,12,23,7,22,0,12,14,2,13,5,10,27,5,13,8,2,20,23,
+        8,12,10,11,25,10,18,26,21,20,16,5,6,17,8,4,4,28,23,2,17,26,23,21,10,3,22,24,11,21,10,24,
+        13,7,29,20,10,6,14,19,21,11,20,7,25,23,13,29,20,1,19,26,14,0,11,2,10,27,17,11,9,23,6,10,
+        22,15,25,11,8,14,21,23,18,11,17,11,6,21,3,8,27,5,4,24,17,4,26,14,9,21,11,8,16,1,21,23,
+        0,16,14,14,22,23,23,0,10,2,4,27,23,20,14,16,18,11,11,17,20,21,12,17,2,18,24,26,20,21,24,21,
+        7,0,17,26,18,18,13,0,16,14,1,5,12,19,12,14,23,0,13,18,17,22,22,17,21,9,9,28,2,23,2,28,
+        18,22,19,17,7,16,6,21,23,28,24,8,15,23,1,19,29,14,22,13,13,22,13,8,12,14,9,0,14,19,2,15,
+        21,2,21,1,5,12,22,10,22,2,22,15,19,14,21,5,6,17,2,17,4,1,23,22,27,22,27,12,23,19,21,23,
+        26,21,11,9,7,27,13,11,23,26,10,0,9,20,15,8,17,23,19,22,14,11,16,16,16,17,0,17,17,12,19,4,
+        2,6,21,5,16,3,11,10,14,4,12,23,6,9,20,20,14,16,20,21,14,7,1,16,16,7,14,0,26,0,7,16,
+        3,20,8,19,16,6,12,18,13,2,6,3,28,8,1,10,11,22,10,3,16,23,6,0,22,0,18,8,15,17,19,1,
+        11,7,16,12,17,1,21,12,7,19,14,17,22,0,2,19,14,3,25,18,2,14,21,16,10,22,20,10,0,20,22,2,
+        19,20,6,22,19,7,9,8,14,10,10,6,6,2,11,20,20,7,4,17,22,22,21,2,22,19,20,22,8,17,10,14,
+        21,0,9,0,6,7,10,10,4,4,10,18,15,10,13,10,21,10,2,20,14,6,8,23,22,16,15,1,2,19,21,16,
+        12,8,25,19,1,2,26,5,9,16,10,11,19,1,12,11,16,20,10,19,9,1,1,1,10,4,10,27,0,21,17,21,
+        2,7,12,3,17,22,10,10,3,6,1,5,29,9,11,19,7,11,2,2,2,9,6,17,15,13,0,21,9,6,1,17,
+        12,15,26,8,4,7,20,16,23,23,7,19,17,7,7,10,22,22,8,9,15,6,8,8,29,10,23,6,28,6,16,6,
+        23,4,16,27,8,6,19,19,7,9,18,29,6,9,17,14,29,8,29,7,18,0,8,7,21,10,11,9,11,28,6,9,
+        26,3,0,23,13,8,14,17,18,23,15,18,7,10,13,15,25,7,10,5,20,17,1,28,2,25,24,6,1,27,29,6,
+        29,18,9,8,6,7,16,19,7,10,10,20,10,18,8,10,2,19,17,18,2,19,7,7,22,19,0,10,16,16,8,6,
+        23,27,11,15,6,7,11,13,10,18,22,17,8,20,7,8,21,28,7,7,23,8,7,7,10,23,8,8,6,7,7,23,
+        19,5,18,17,7,29,15,16,15,29,23,8,9,29,8,7,14,23,9,6,7,20,8,6,7,15,20,7,6,23,22,6,
+        19,27,14,16,4,20,23,6,21,20,7,1,8,7,12,22,18,23,3,0,8,7,3,14,11,18,15,3,24,26,9,12,
+        22,13,29,28,18,16,17,16,23,9,12,15,6,6,7,28,13,14,9,17,22,18,6,7,23,23,23,21,9,20,22,6,
+        7,6,1,27,8,2,21,23,29,19,21,23,23,8,21,16,28,14,13,29,21,24,29,22,23,23,23,25,24,22,23,21,
+        8,28,23,5,19,7,21,21,22,29,4,17,18,23,23,22,0,8,18,22,21,22,22,17,21,22,4,21,22,23,9,9,
+        16,20,16,2,27,7,29,19,8,20,13,12,19,21,13,14,16,21,21,4,22,23,23,25,10,24,4,23,9,5,17,21,
+        8,23,18,8,8,19,22,23,7,15,21,4,3,21,21,12,7,4,23,5,9,23,22,2,14,29,22,6,28,15,27,5,
+        17,12,0,22,12,10,17,17,22,29,21,29,29,4,21,23,21,20,21,10,20,29,18,17,10,21,16,5,22,25,26,21,
+        20,22,15,6,7,2,21,21,15,10,16,10,12,13,19,28,5,23,16,18,29,8,22,0,0,28,16,16,13,24,14,18,
+        11,16,26,27,11,18,12,19,23,3,18,5,2,5,5,0,23,18,18,27,25,8,4,20,0,9,27,8,13,0,26,0,
+        28,29,6,23,1,16,22,23,23,2,19,29,21,10,9,1,14,13,2,14,4,1,13,23,23,27,18,0,5,7,21,13,
+        4,13,14,0,17,5,0,26,29,2,10,13,8,29,20,14,9,22,23,19,17,14,2,1,1,28,22,12,8,12,0,21,
+        15,15,28,26,11,15,10,3,20,13,20,20,14,10,3,29,8,3,1,23,25,8,16,0,28,17,4,10,23,0,22,29,
+        16,15,6,26,16,21,0,1,10,4,8,11,0,2,28,13,13,5,5,21,6,14,16,13,16,1,10,6,12,19,27,11,
+        13,10,11,7,11,2,23,22,14,12,6,17,17,11,15,20,22,22,27,15,22,10,8,3,22,24,16,26,21,15,15,18,
+        10,13,11,9,4,7,18,10,29,29,22,19,6,12,13,2,23,4,7,2,4,17,20,1,11,3,1,20,0,20,10,21,
+        19,0,9,23,8,12,29,11,9,23,8,5,10,1,11,0,20,28,22,9,16,23,14,8,21,4,5,13,24,1,11,9,
+        0,23,5,20,18,15,15,20,8,11,18,18,23,19,20,9,12,20,0,19,20,2,8,18,6,13,7,10,18,14,10,18,
+        5,10,21,1,10,15,7,0,22,11,19,18,18,14,9,5,4,27,21,14,21,17,4,21,10,0,7,14,12,13,23,21,
+        7,22,7,11,16,20,20,11,7,25,2,11,19,15,11,17,13,13,19,19,16,6,2,13,18,19,21,21,17,1,13,21,
+        8,18,20,2,7,18,18,1,23,14,2,22,17,21,8,19,4,2,26,19,11,2,2,15,17,23,0,22,23,15,19,21,
+        18,10,10,1,6,27,14,14,12,3,8,27,28,12,16,14,10,14,7,15,22,29,22,14,12,25,8,17,18,2,21,0,
+        23,2,6,16,14,4,13,9,21,13,13,3,6,17,13,15,28,1,16,6,23,20,18,4,5,12,6,17,17,15,23,21,
+        7,29,2,9,6,8,20,20,6,14,10,14,16,9,15,20,21,10,9,23,22,7,8,13,7,21,2,6,15,7,20,13,
+        8,23,21,8,7,1,14,10,9,10,16,15,12,2,10,9,11,23,22,12,19,5,16,16,23,22,13,22,10,19,11,2,
+        1,8,12,11,23,19,21,9,28,6,0,15,1,5,21,15,17,20,12,24,21,16,16,18,19,2,8,7,14,14,0,24,
+        6,12,10,12,7,7,9,13,18,9,1,8,9,0,9,10,7,19,16,20,15,0,23,1,22,21,10,7,22,1,13,25,
+        8,3,2,7,15,6,17,19,2,20,13,7,12,6,20,11,23,8,7,21,28,2,6,2,23,7,2,2,0,7,18,13,
+        6,8,15,5,9,7,17,16,6,6,14,6,15,6,12,8,23,6,18,19,7,7,8,23,8,21,6,29,6,16,10,16,
+        14,28,3,13,15,29,0,23,23,25,19,6,28,10,1,27,23,13,3,11,23,27,22,2,0,14,4,0,0,17,18,15,
+        7,19,11,7,17,6,20,11,13,14,8,7,17,13,19,10,15,6,15,15,9,8,6,7,7,15,21,6,10,29,8,17,
+        29,7,1,7,21,17,6,13,10,22,23,17,7,27,8,13,22,12,2,29,7,0,8,7,8,23,7,27,21,6,8,8,
+        28,23,18,5,13,1,12,13,22,20,14,28,7,9,28,6,8,10,8,22,22,7,6,8,10,10,9,20,16,23,21,6,
+        0,16,18,3,15,25,0,22,8,15,25,7,11,1,21,17,21,26,19,4,15,26,4,18,23,22,17,23,14,8,12,10,
+        21,15,2,5,8,8,15,10,23,8,15,16,8,28,6,13,14,21,6,9,28,7,7,7,23,21,22,7,16,6,29,22
+    },
+};
+
+#endif // BOTPOLICYTABLE_HPP
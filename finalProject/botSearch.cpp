@@ -0,0 +1,272 @@
+#ifndef BOTSEARCH_CPP
+#define BOTSEARCH_CPP
+
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <climits>
+#include <stdexcept>
+#include "botSearch.hpp"
+#include "player.hpp"
+#include "helperFunctions.hpp" // random numbers, muting output
+
+/// hashing
+
+namespace
+{
+    // every stat that affects how a town plays out (prices as the town sees them), and its queued world events
+    enum HashField {GoldField, YearField, YearsLeftField, RankField, DifficultyField,
+                    SerfField, MerchantField, ClergyField, NobleField, SoldierField,
+                    GrainField, LandField, ReleasedField, GrainPriceField, LandPriceField,
+                    AssetField, SalesField = AssetField + NUM_ASSETS, IncomeField, CustomsField, HarvestLossField,
+                    EventTypeField, EventYearField, EventMagnitudeField, DepthField}; // one asset field per asset type (AssetField + AssetType)
+    const int NUM_HASH_FIELDS = DepthField + 1;
+
+    // random keys for every byte value of every byte of every field
+    struct ZobristKeys
+    {
+        uint64_t keys[NUM_HASH_FIELDS][4][256];
+
+        ZobristKeys()
+        {
+            // fixed sequence (splitmix64) so hashes are the same on every run
+            uint64_t state = 0x5A6E7A5061726176ull;
+            for (auto& field : keys)
+                for (auto& byte : field)
+                    for (uint64_t& key : byte)
+                    {
+                        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+                        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                        key = z ^ (z >> 31);
+                    }
+        }
+
+        uint64_t operator()(HashField field, int value) const
+        {
+            uint32_t bits = value;
+            return keys[field][0][bits & 0xFF] ^ keys[field][1][(bits >> 8) & 0xFF]
+                 ^ keys[field][2][(bits >> 16) & 0xFF] ^ keys[field][3][bits >> 24];
+        }
+    };
+    const ZobristKeys ZOBRIST;
+
+    // key for a single queued event, mixed so the fields of different events can't cancel each other out
+    uint64_t eventKey(const WorldEvent& event)
+    {
+        uint64_t z = ZOBRIST(EventTypeField, event.type) ^ ZOBRIST(EventYearField, event.year) ^ ZOBRIST(EventMagnitudeField, event.magnitude);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+}
+
+uint64_t townHash(const Player& town)
+{
+    // events get added up rather than XORed, so the same event queued twice doesn't cancel out (the wheel's order doesn't matter either way)
+    uint64_t events = 0;
+    town.getEvents().forEach([&](const WorldEvent& event) {events += eventKey(event);});
+
+    uint64_t hash = events ^ ZOBRIST(HarvestLossField, town.getHarvestLoss());
+    for (int type = 0; type < NUM_ASSETS; ++type) hash ^= ZOBRIST(static_cast<HashField>(AssetField + type), town.getAssets(static_cast<AssetType>(type)));
+    return hash ^ ZOBRIST(GoldField, town.getGold()) ^ ZOBRIST(YearField, town.getYear()) ^ ZOBRIST(YearsLeftField, town.getYearsLeft())
+         ^ ZOBRIST(RankField, town.getRank()) ^ ZOBRIST(DifficultyField, town.getDifficulty())
+         ^ ZOBRIST(SerfField, town.getSerfs()) ^ ZOBRIST(MerchantField, town.getMerchants()) ^ ZOBRIST(ClergyField, town.getClergy())
+         ^ ZOBRIST(NobleField, town.getNobles()) ^ ZOBRIST(SoldierField, town.getSoldiers())
+         ^ ZOBRIST(GrainField, town.getGrain()) ^ ZOBRIST(LandField, town.getLand()) ^ ZOBRIST(ReleasedField, town.getReleasedGrain())
+         ^ ZOBRIST(GrainPriceField, town.getGrainPrice()) ^ ZOBRIST(LandPriceField, town.getLandPrice())
+         ^ ZOBRIST(SalesField, town.getSales()) ^ ZOBRIST(IncomeField, town.getIncome()) ^ ZOBRIST(CustomsField, town.getCustoms());
+}
+
+
+/// transposition table
+
+TranspositionTable::TranspositionTable(int sizeBits)
+{
+    if (sizeBits < 1 || sizeBits > 30) throw std::logic_error("Error: Transposition table created with invalid size.");
+
+    mask = (uint64_t(1) << sizeBits) - 1;
+    entries.reset(new Entry[mask + 1]);
+    clear();
+}
+
+void TranspositionTable::clear()
+{
+    for (uint64_t i = 0; i <= mask; ++i)
+    {
+        entries[i].check.store(0, std::memory_order_relaxed);
+        entries[i].data.store(0, std::memory_order_relaxed);
+    }
+}
+
+bool TranspositionTable::probe(uint64_t key, float& value) const
+{
+    const Entry& entry = entries[key & mask];
+    uint64_t data = entry.data.load(std::memory_order_relaxed);
+    uint64_t check = entry.check.load(std::memory_order_relaxed);
+    if ((check ^ data) != key) return false; // different town, or a write from another thread got in between
+
+    uint32_t bits = data;
+    std::memcpy(&value, &bits, sizeof(value));
+    return true;
+}
+
+void TranspositionTable::store(uint64_t key, float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint64_t data = bits;
+
+    Entry& entry = entries[key & mask];
+    entry.check.store(key ^ data, std::memory_order_relaxed);
+    entry.data.store(data, std::memory_order_relaxed);
+}
+
+
+/// search
+
+namespace
+{
+    const int NUM_MOVES = NUM_POLICY_ACTIONS * NUM_RELEASE_CHOICES; // move index is (action * NUM_RELEASE_CHOICES + release choice)
+
+    // everything a search shares between its threads
+    struct Search
+    {
+        TranspositionTable& table;
+
+        // budget
+        bool timed; // whether there's a deadline
+        std::chrono::steady_clock::time_point deadline;
+        long maxNodes; // 0 for no limit
+        std::atomic<long> nodes {0}; // year-end reports played out so far
+        std::atomic<bool> stopped {false}; // budget ran out, every thread gives up on the current depth
+
+        Search(TranspositionTable& t, const SearchBudget& budget)
+        : table(t), timed(budget.milliseconds > 0), deadline(std::chrono::steady_clock::now() + std::chrono::milliseconds(budget.milliseconds)), maxNodes(budget.nodes) {}
+
+        bool outOfBudget()
+        // post: count a node against the budget, return true if the search has to stop
+        {
+            if (stopped.load(std::memory_order_relaxed)) return true;
+
+            long count = nodes.fetch_add(1, std::memory_order_relaxed) + 1;
+            if ((maxNodes > 0 && count > maxNodes) || (timed && std::chrono::steady_clock::now() >= deadline)) stopped = true;
+            return stopped.load(std::memory_order_relaxed);
+        }
+    };
+
+    float townValue(const Player& town, int depth, Search& search);
+
+    // expected value of making a move, averaged over the year-end outcomes that follow it
+    float moveValue(const Player& town, int move, int depth, Search& search)
+    {
+        Player afterMove(town, currentContext()); // copies belong to the search thread's scratch game, never the real one
+        try
+        {
+            applyPolicyAction(afterMove, move / NUM_RELEASE_CHOICES);
+            applyRelease(afterMove, static_cast<ReleaseChoice>(move % NUM_RELEASE_CHOICES));
+        }
+        catch (FormulaOverflow&) {return 0;} // move breaks the game's formulas, never worth making
+
+        uint64_t key = townHash(afterMove) ^ ZOBRIST(DepthField, depth);
+        float value;
+        if (search.table.probe(key, value)) return value;
+
+        float total = 0;
+        for (int sample = 0; sample < SEARCH_SAMPLES; ++sample)
+        {
+            if (search.outOfBudget()) return 0; // unfinished value, doesn't get stored
+
+            Player outcome(afterMove);
+            try
+            {
+                outcome.turnResults();
+                total += townValue(outcome, depth - 1, search);
+            }
+            catch (FormulaOverflow&) {} // outcomes that break the formulas count as nothing
+        }
+        if (search.stopped) return 0; // something further down didn't finish
+        value = total / SEARCH_SAMPLES;
+
+        search.table.store(key, value);
+        return value;
+    }
+
+    // value of a town at the start of a turn, taking the best move
+    float townValue(const Player& town, int depth, Search& search)
+    {
+        if (depth == 0 || town.gameEnded()) return town.getScore();
+
+        float best = -HUGE_VALF;
+        for (int move = 0; move < NUM_MOVES && !search.stopped; ++move) best = std::max(best, moveValue(town, move, depth, search));
+        return best;
+    }
+}
+
+BotDecision searchDecision(const Player& town, const SearchBudget& budget)
+{
+    // the town's game has its own table, so games never see each other's values (values stay valid between turns)
+    std::unique_ptr<TranspositionTable>& table = town.getGame().searchTable;
+    if (!table) table.reset(new TranspositionTable(TRANSPOSITION_BITS));
+    Search search(*table, budget);
+
+    // best move so far, the policy table's choice until a search finishes
+    BotDecision best {policyAction(town), SolverRelease};
+
+    const unsigned int seed = random(INT_MAX); // searches follow the game's own random numbers
+    int numThreads = budget.threads;
+    if (numThreads < 1) numThreads = 1;
+    if (numThreads > NUM_MOVES) numThreads = NUM_MOVES;
+
+    // no point looking past the end of the game
+    int maxDepth = std::min<int>(MAX_SEARCH_DEPTH, town.getYearsLeft());
+    if (maxDepth < 1) maxDepth = 1;
+
+    for (int depth = 1; depth <= maxDepth; ++depth)
+    {
+        // share out top-level moves between threads
+        std::vector<float> values(NUM_MOVES);
+        std::atomic<int> nextMove(0);
+
+        auto searchMoves = [&]()
+        {
+            // copies play in a scratch game whose reports and prompts go nowhere
+            std::istringstream noInput;
+            std::ostream muted(nullptr);
+            GameContext scratch(noInput, muted);
+            scratch.recordMetrics = false; // hypothetical years aren't part of the game
+            ContextScope scope(scratch);
+
+            for (int move = nextMove++; move < NUM_MOVES && !search.stopped; move = nextMove++)
+            {
+                scratch.seed(seed + move); // a move's outcomes don't depend on which thread takes it
+                values[move] = moveValue(town, move, depth, search);
+            }
+        };
+
+        // the calling thread searches too, so a single thread never starts any others
+        std::vector<std::thread> threads;
+        for (int i = 1; i < numThreads; ++i) threads.emplace_back(searchMoves);
+        searchMoves();
+        for (std::thread& t : threads) t.join();
+
+        if (search.stopped) break; // out of budget, keep the last finished depth's move
+
+        // pick the best move (first one on ties)
+        int bestMove = 0;
+        for (int move = 1; move < NUM_MOVES; ++move)
+        {
+            if (values[move] > values[bestMove]) bestMove = move;
+        }
+        best = {bestMove / NUM_RELEASE_CHOICES, static_cast<ReleaseChoice>(bestMove % NUM_RELEASE_CHOICES)};
+    }
+
+    return best;
+}
+
+#endif // BOTSEARCH_CPP
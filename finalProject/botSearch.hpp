@@ -0,0 +1,78 @@
+#ifndef BOTSEARCH_HPP
+#define BOTSEARCH_HPP
+
+/*
+Bot search details
+    - Hard bots pick their turns by depth-limited expectimax instead of looking them up in the policy table
+    - Searches are anytime: they deepen one turn at a time until they run out of budget (time and/or nodes, see SearchBudget) or reach MAX_SEARCH_DEPTH
+        - The move returned is the best one from the deepest search that finished, or the policy table's choice if not even one turn could be searched
+        - A search that runs out partway gets thrown out, and nothing it was working on goes into the table
+        - Each deeper search finds the previous one's results in the transposition table one level down, so deepening costs little beyond the new level
+    - A move is a full turn: a policy action (investment and tax level, see botPolicy.hpp) along with a grain release choice
+    - Decision nodes try every move on a copy of the town, chance nodes play out the year-end report on more copies (SEARCH_SAMPLES of them)
+        - Outcomes come straight from the game's own random formulas, since the copies run the same code as the real town
+        - Towns are worth their score once the search depth has been played out
+    - Different moves often leave the same town behind (e.g. buying something the town can't afford is the same as saving), so chance nodes go through a transposition table
+        - Keyed by a Zobrist hash of every stat in the town along with the depth left to search
+        - Fixed amount of entries (TRANSPOSITION_BITS), so memory use stays the same however deep the search goes
+        - Lock-free: each entry is two atomic words with the key folded into one of them, so entries torn by another thread's write just look like misses
+        - Every game has a table of its own (see GameContext), so a game's searches only depend on its own earlier searches, never on other games
+          (games with node budgets play out the same on any thread, whatever else the process is playing)
+    - Moves at the top of the search get shared out between the budget's threads, which all use the same table
+        - Each thread plays its copies in a scratch game of its own, so no two threads ever touch the same game (or its player count)
+        - With a single thread the search runs on the calling thread, which is what anything already playing games in parallel should use
+*/
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include "botPolicy.hpp" // moves
+
+class Player;
+
+struct SearchBudget
+{
+    int milliseconds; // wall-clock time for the whole decision (0 for no limit)
+    long nodes; // year-end reports played out on copies of the town (0 for no limit)
+    int threads = 1; // threads searching at once (including the calling thread)
+};
+// at least one of the limits should be set, otherwise the search always goes to MAX_SEARCH_DEPTH
+
+class TranspositionTable
+{
+private:
+    struct Entry
+    {
+        std::atomic<uint64_t> check; // key xor data
+        std::atomic<uint64_t> data; // stored value
+    };
+    std::unique_ptr<Entry[]> entries;
+    uint64_t mask; // entry count minus one (count is a power of two)
+
+public:
+    TranspositionTable(int sizeBits);
+    // pre: sizeBits between 1 and 30
+    // post: empty table with 2^sizeBits entries
+
+    void clear();
+    // post: forget every stored value
+
+    bool probe(uint64_t key, float& value) const;
+    // pre: N/A
+    // post: if a value was stored for the key (and hasn't been replaced since), copy it into value and return true, return false otherwise
+    void store(uint64_t key, float value);
+    // pre: N/A
+    // post: store the value for the key, replacing whatever was in its slot
+    // both safe to call from any number of threads at once
+};
+
+uint64_t townHash(const Player& town);
+// pre: player object initialized
+// post: return the Zobrist hash of every stat in the town and every world event it has queued (same for any two towns that would play out the same way)
+
+BotDecision searchDecision(const Player& town, const SearchBudget& budget);
+// pre: player object initialized, game hasn't ended for the player
+// post: return the move with the best expected score as many turns ahead as the budget allows, searched on as many threads as the budget has
+// nothing happens to the town itself, and none of the copies' output gets displayed
+
+#endif // BOTSEARCH_HPP
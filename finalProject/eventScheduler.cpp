@@ -0,0 +1,75 @@
+#ifndef EVENTSCHEDULER_CPP
+#define EVENTSCHEDULER_CPP
+
+#include "eventScheduler.hpp"
+
+EventWheel::EventWheel(int startYear) : now(startYear) {}
+
+void EventWheel::schedule(const WorldEvent& event)
+{
+    if (event.year < now) throw std::logic_error("Error: Scheduling an event for a year the event wheel has already passed.");
+    if (((event.year ^ now) >> (EVENT_WHEEL_BITS * EVENT_WHEEL_LEVELS)) != 0)
+        throw std::logic_error("Error: Scheduling an event further ahead than the event wheel can reach.");
+
+    // reuse a free entry if there is one
+    int entry;
+    if (freeEntries != -1)
+    {
+        entry = freeEntries;
+        freeEntries = pool[entry].next;
+        pool[entry].event = event;
+    }
+    else
+    {
+        entry = pool.size();
+        pool.push_back({event, -1});
+    }
+
+    insert(entry);
+    ++pending;
+}
+
+void EventWheel::insert(int entry)
+{
+    // lowest level where the year and now only differ within a single slot's digit
+    int year = pool[entry].event.year;
+    int level = 0;
+    while (level < EVENT_WHEEL_LEVELS - 1 && ((year ^ now) >> (EVENT_WHEEL_BITS * (level + 1))) != 0) ++level;
+    int slot = (year >> (EVENT_WHEEL_BITS * level)) & (EVENT_WHEEL_SLOTS - 1);
+    if (levels[level].empty()) levels[level].assign(2 * EVENT_WHEEL_SLOTS, -1); // first event on the level
+
+    // append, keeping the slot in scheduling order
+    pool[entry].next = -1;
+    if (tail(level, slot) == -1) head(level, slot) = entry;
+    else pool[tail(level, slot)].next = entry;
+    tail(level, slot) = entry;
+}
+
+void EventWheel::cascade(int level)
+{
+    if (levels[level].empty()) return; // never used
+    int slot = (now >> (EVENT_WHEEL_BITS * level)) & (EVENT_WHEEL_SLOTS - 1);
+    int entry = head(level, slot);
+    head(level, slot) = tail(level, slot) = -1;
+
+    while (entry != -1)
+    {
+        int next = pool[entry].next;
+        insert(entry); // always lands on a lower level, since now has caught up to this slot
+        entry = next;
+    }
+}
+
+int EventWheel::take(int slot)
+{
+    int entry = head(0, slot);
+    head(0, slot) = pool[entry].next;
+    if (head(0, slot) == -1) tail(0, slot) = -1;
+
+    pool[entry].next = freeEntries;
+    freeEntries = entry;
+    --pending;
+    return entry;
+}
+
+#endif // EVENTSCHEDULER_CPP
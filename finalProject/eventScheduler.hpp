@@ -0,0 +1,125 @@
+#ifndef EVENTSCHEDULER_HPP
+#define EVENTSCHEDULER_HPP
+
+/*
+Event scheduler details
+    - Keeps a town's world events (plagues, fires, festivals, harvest failures, raids, and the delayed effects they leave behind) queued up for future years
+        - Every town has its own, see Player::worldEvents() for how events get rolled and what they do
+        - Events come out of dispatch() on their year, in the order they were scheduled
+    - Hierarchical timing wheel with a year as its tick
+        - Level 0 has a slot for each of the next EVENT_WHEEL_SLOTS years, every level above has slots covering EVENT_WHEEL_SLOTS times as many years as the one below
+        - Scheduling puts an event straight into the slot for its year on the lowest level that can hold it (constant time, no searching or sorting)
+        - Dispatching a year only empties one level 0 slot, and a higher level slot gets spread out over the level below when the wheel reaches it
+          (every event moves down at most once per level, so dispatching is constant time per event amortized)
+    - Events live in a single pool linked into lists by index, with freed entries reused, so queueing millions of events doesn't allocate for each one
+        - Copying a town copies its wheel along with it (bot searches and the sandbox see the same future)
+    - A level's slots only get allocated once an event first lands on it, so a wheel with nothing queued is a few empty vectors
+      (towns mostly schedule a few years ahead, so most wheels only ever have level 0, sometimes level 1, and copies stay small)
+*/
+
+#include <vector>
+#include <stdexcept>
+#include "parameters.hpp"
+
+namespace /// constant parameters for the event scheduler
+{
+    const int EVENT_WHEEL_BITS = 6; // years per slot on each level go up by this many bits
+    const int EVENT_WHEEL_SLOTS = 1 << EVENT_WHEEL_BITS; // slots per level
+    const int EVENT_WHEEL_LEVELS = 4; // events can be scheduled up to EVENT_WHEEL_SLOTS ^ EVENT_WHEEL_LEVELS years ahead (about 16 million)
+}
+
+enum WorldEventType {PlagueEvent, FireEvent, FestivalEvent, HarvestFailureEvent, RaidEvent, ImmigrationEvent}; // same order as WORLD_EVENTS
+
+struct WorldEvent
+{
+    WorldEventType type;
+    int year; // when it happens
+    int magnitude; // see WORLD_EVENTS in the parameters file
+};
+
+class EventWheel
+{
+private:
+    struct Entry // pool entry, either a queued event or a free one
+    {
+        WorldEvent event;
+        int next; // next entry in the same slot (or free list), -1 at the end
+    };
+    std::vector<Entry> pool;
+    int freeEntries = -1; // first free entry in the pool
+
+    std::vector<int> levels[EVENT_WHEEL_LEVELS]; // first entry in every slot and then last entry in every slot (-1 if empty), no slots at all until the level gets used
+    int now; // earliest year that hasn't been dispatched yet
+    int pending = 0; // events queued
+
+    int& head(int level, int slot) {return levels[level][slot];}
+    int& tail(int level, int slot) {return levels[level][EVENT_WHEEL_SLOTS + slot];}
+    int firstIn(int level, int slot) const {return levels[level].empty() ? -1 : levels[level][slot];} // -1 for an empty slot or level
+
+    void insert(int entry);
+    // pre: entry's year not before now and within the wheel's reach
+    // post: append the entry to the slot for its year, on the lowest level that can hold it
+
+    void cascade(int level);
+    // pre: level above 0, now at the start of the level's current slot
+    // post: move every event in the level's current slot down to the levels below
+
+    int take(int slot);
+    // pre: level 0 slot isn't empty
+    // post: unlink the slot's first entry, put it on the free list, and return its index (its event stays readable until the next schedule())
+
+public:
+    EventWheel(int startYear);
+    // pre: N/A
+    // post: empty wheel with nothing dispatched before the year
+
+    void schedule(const WorldEvent& event);
+    // pre: event's year not before currentYear() and within the wheel's reach of it (the same block of EVENT_WHEEL_SLOTS ^ EVENT_WHEEL_LEVELS years)
+    // post: queue the event to come out of dispatch() on its year
+
+    template <typename Handler> void dispatch(int year, Handler handle);
+    // pre: year not before currentYear()
+    // post: call handle(event) for every event queued up to and including the year, in order of year and then scheduling
+    // events the handler schedules for the year come out in the same call, currentYear() is the year afterwards (later events for it come out in the next call)
+
+    template <typename Visitor> void forEach(Visitor visit) const;
+    // pre: N/A
+    // post: call visit(event) for every queued event, in no particular order (for hashing and checking what's queued, not for carrying events out)
+
+    int currentYear() const {return now;}
+    int size() const {return pending;} // events queued
+};
+
+template <typename Handler>
+void EventWheel::dispatch(int year, Handler handle)
+{
+    if (year < now) throw std::logic_error("Error: Dispatching events for a year the event wheel has already passed.");
+
+    while (true)
+    {
+        // everything in the current level 0 slot is due this year, including anything the handler adds
+        int slot = now & (EVENT_WHEEL_SLOTS - 1);
+        while (firstIn(0, slot) != -1)
+        {
+            WorldEvent event = pool[take(slot)].event;
+            handle(event);
+        }
+        if (now == year) break;
+
+        // move on a year, spreading out higher level slots the wheel has just reached (highest first, so events end up on level 0 by their year)
+        ++now;
+        int level = 0;
+        while (level < EVENT_WHEEL_LEVELS - 1 && (now & ((1 << (EVENT_WHEEL_BITS * (level + 1))) - 1)) == 0) ++level;
+        for (; level > 0; --level) cascade(level);
+    }
+}
+
+template <typename Visitor>
+void EventWheel::forEach(Visitor visit) const
+{
+    for (int level = 0; level < EVENT_WHEEL_LEVELS; ++level)
+        for (int slot = 0; slot < EVENT_WHEEL_SLOTS; ++slot)
+            for (int entry = firstIn(level, slot); entry != -1; entry = pool[entry].next) visit(pool[entry].event);
+}
+
+#endif // EVENTSCHEDULER_HPP
@@ -0,0 +1,152 @@
+/*
+Purpose: Check that event wheels hand out events in order of year and then scheduling, across every level's slot boundaries and in copies, and refuse events past their reach (see eventScheduler.hpp)
+Usage: eventSchedulerTest
+    - Compares the wheel against a plain sorted list of the same events, for hand-picked years either side of cascade boundaries and for a fixed random mix
+    - Returns 0 if every check passes, otherwise prints the ones that failed and returns 1
+*/
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "eventScheduler.hpp"
+#include "testCheck.hpp"
+
+namespace
+{
+    const int LEVEL_YEARS[] = {1, EVENT_WHEEL_SLOTS, EVENT_WHEEL_SLOTS * EVENT_WHEEL_SLOTS, EVENT_WHEEL_SLOTS * EVENT_WHEEL_SLOTS * EVENT_WHEEL_SLOTS}; // years per slot on each level
+    const int REACH = LEVEL_YEARS[EVENT_WHEEL_LEVELS - 1] * EVENT_WHEEL_SLOTS;
+
+    // events tagged with their scheduling order in the magnitude, so order within a year can be checked
+    std::vector<WorldEvent> expectedOrder(std::vector<WorldEvent> events)
+    {
+        std::stable_sort(events.begin(), events.end(), [](const WorldEvent& a, const WorldEvent& b) {return a.year < b.year;});
+        return events;
+    }
+
+    // schedule every event, dispatch up to the last year in the given steps, and compare with sorting
+    void checkOrder(int start, const std::vector<int>& years, int step, const std::string& name)
+    {
+        EventWheel wheel(start);
+        std::vector<WorldEvent> events;
+        for (int year : years)
+        {
+            events.push_back({PlagueEvent, year, static_cast<int>(events.size())});
+            wheel.schedule(events.back());
+        }
+
+        int counted = 0;
+        wheel.forEach([&](const WorldEvent&) {++counted;});
+        check(wheel.size() == static_cast<int>(events.size()) && counted == wheel.size(), name + ": every event queued");
+
+        std::vector<WorldEvent> dispatched;
+        int last = *std::max_element(years.begin(), years.end());
+        for (int year = start; year < last + step; year += step)
+        {
+            int dispatchYear = std::min(year, last);
+            wheel.dispatch(dispatchYear, [&](const WorldEvent& event)
+            {
+                check(event.year <= dispatchYear, name + ": event for " + std::to_string(event.year) + " came out early, in " + std::to_string(dispatchYear));
+                dispatched.push_back(event);
+            });
+        }
+
+        std::vector<WorldEvent> expected = expectedOrder(events);
+        bool same = dispatched.size() == expected.size();
+        for (std::size_t i = 0; same && i < expected.size(); ++i) same = dispatched[i].year == expected[i].year && dispatched[i].magnitude == expected[i].magnitude;
+        check(same, name + ": events come out in order of year and then scheduling");
+        check(wheel.size() == 0 && wheel.currentYear() == last, name + ": nothing left queued");
+    }
+
+    void checkBoundaries()
+    {
+        // the years either side of every level's slot boundary, scheduled from just before the boundary and in reverse order
+        for (int level = 1; level < EVENT_WHEEL_LEVELS; ++level)
+        {
+            int boundary = LEVEL_YEARS[level] * 3;
+            int start = boundary - 2;
+            std::vector<int> years = {boundary + LEVEL_YEARS[level], boundary + 1, boundary, boundary - 1, boundary, start, boundary + LEVEL_YEARS[level] - 1};
+            checkOrder(start, years, 1, "level " + std::to_string(level) + " boundary, a year at a time");
+            checkOrder(start, years, LEVEL_YEARS[level] + 5, "level " + std::to_string(level) + " boundary, skipping past it");
+        }
+    }
+
+    void checkRandom()
+    {
+        // a fixed mix of near and far years, with plenty of repeats
+        std::mt19937 generator(2018);
+        const int start = 12345;
+        std::vector<int> years;
+        for (int i = 0; i < 20000; ++i)
+        {
+            int level = generator() % EVENT_WHEEL_LEVELS;
+            years.push_back(start + generator() % (LEVEL_YEARS[level] * 4));
+        }
+        checkOrder(start, years, 997, "random years");
+    }
+
+    void checkHandlerScheduling()
+    {
+        // events the handler queues for the year it's dispatching come out in the same call, after the ones already there
+        EventWheel wheel(100);
+        wheel.schedule({FireEvent, 110, 0});
+        std::vector<int> order;
+        wheel.dispatch(110, [&](const WorldEvent& event)
+        {
+            order.push_back(event.magnitude);
+            if (event.magnitude < 2) wheel.schedule({FireEvent, 110, event.magnitude + 1});
+        });
+        check(order == std::vector<int>({0, 1, 2}), "events scheduled while dispatching their year come out in the same call");
+    }
+
+    void checkCopies()
+    {
+        // a copy made partway through (with events on several levels) has the same future as the original, and the two stay independent
+        EventWheel original(60);
+        for (int year : {61, 64, 70, 200, 5000}) original.schedule({FestivalEvent, year, year});
+        original.dispatch(62, [](const WorldEvent&) {});
+        EventWheel copy(original);
+        copy.schedule({FestivalEvent, 63, 63});
+
+        std::vector<int> originalYears, copyYears;
+        original.dispatch(5000, [&](const WorldEvent& event) {originalYears.push_back(event.year);});
+        copy.dispatch(5000, [&](const WorldEvent& event) {copyYears.push_back(event.year);});
+        check(originalYears == std::vector<int>({64, 70, 200, 5000}), "original keeps its own events after being copied");
+        check(copyYears == std::vector<int>({63, 64, 70, 200, 5000}), "copy has the original's events along with its own");
+    }
+
+    void checkReach()
+    {
+        // the wheel reaches to the end of the block of REACH years it's in
+        EventWheel wheel(0);
+        wheel.schedule({RaidEvent, REACH - 1, 0});
+        check(wheel.size() == 1, "the last year in reach can be scheduled");
+
+        checkThrows([&] {wheel.schedule({RaidEvent, REACH, 0});}, "a year past the reach throws");
+
+        EventWheel late(REACH - 10);
+        checkThrows([&] {late.schedule({RaidEvent, REACH + 10, 0});}, "a year in the next block throws, even if it's close");
+
+        checkThrows([&] {late.schedule({RaidEvent, REACH - 11, 0});}, "a year the wheel has passed throws");
+
+        checkThrows([&] {late.dispatch(REACH - 11, [](const WorldEvent&) {});}, "dispatching a year the wheel has passed throws");
+
+        // events at the far end still come out on their year
+        std::vector<int> years;
+        wheel.dispatch(REACH - 2, [&](const WorldEvent& event) {years.push_back(event.year);});
+        check(years.empty(), "far event doesn't come out early");
+        wheel.dispatch(REACH - 1, [&](const WorldEvent& event) {years.push_back(event.year);});
+        check(years == std::vector<int>({REACH - 1}), "far event comes out on its year");
+    }
+}
+
+int main()
+{
+    checkBoundaries();
+    checkRandom();
+    checkHandlerScheduling();
+    checkCopies();
+    checkReach();
+
+    return testResult("event scheduler");
+}
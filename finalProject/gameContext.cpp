@@ -0,0 +1,55 @@
+#ifndef GAMECONTEXT_CPP
+#define GAMECONTEXT_CPP
+
+#include <stdexcept>
+#include "gameContext.hpp"
+#include "player.hpp" // deleting players
+#include "botSearch.hpp" // deleting the search table
+
+GameContext::GameContext() : GameContext(std::cin, std::cout, std::cerr) {}
+
+GameContext::GameContext(std::istream& in, std::ostream& out) : GameContext(in, out, out) {}
+
+GameContext::GameContext(std::istream& in, std::ostream& out, std::ostream& err)
+: input(&in), output(&out), errors(&err), report(&output) {}
+
+GameContext::~GameContext()
+{
+    for (Player* p : players) delete p;
+    for (Player* b : bots) delete b;
+}
+
+void GameContext::setStreams(std::istream& in, std::ostream& out)
+{
+    input = &in;
+    output = &out;
+    errors = &out;
+}
+
+int GameContext::random(int minVal, int maxVal)
+{
+    if (minVal > maxVal) throw std::logic_error("Function random() called with min parameter greater than max parameter."); // enforce precondition
+
+    // evenly distributed value straight from the game's generator
+    return std::uniform_int_distribution<int>(minVal, maxVal)(generator);
+}
+
+namespace
+{
+    thread_local GameContext* current = nullptr; // context set by useContext(), the thread's default context if none
+}
+
+GameContext& currentContext()
+{
+    if (current) return *current;
+
+    thread_local GameContext defaultContext; // made the first time the thread needs it
+    return defaultContext;
+}
+
+void useContext(GameContext& context)
+{
+    current = &context;
+}
+
+#endif // GAMECONTEXT_CPP
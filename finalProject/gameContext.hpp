@@ -0,0 +1,83 @@
+#ifndef GAMECONTEXT_HPP
+#define GAMECONTEXT_HPP
+
+/*
+Game context details
+    - Everything that belongs to a single game instead of the whole program: its streams, random numbers, report, players, and settings
+        - Two games never share anything (bot searches' transposition tables included), so any number of them can run in one process (game host sessions, tournament games, bot searches)
+    - Players are made in a context and keep it for their whole lifetime (see Player), so their formulas always draw from their own game's random numbers
+    - The helper functions (input, random numbers, output, see helperFunctions.hpp) go through the current context of the thread they're called on
+        - Each thread starts out with its own default context on std::cin, std::cout, and std::cerr
+        - ContextScope makes a context current for as long as it's in scope
+*/
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <memory>
+#include "report.hpp" // buffered output
+#include "parameters.hpp" // default settings
+
+class Player;
+class TranspositionTable;
+using playerVector = std::vector<Player*>; // typedef to represent full group of players
+
+struct GameContext
+{
+    // streams for all of the game's input and output
+    std::istream* input;
+    std::ostream* output;
+    std::ostream* errors; // invalid input messages
+
+    std::mt19937 generator; // the game's random numbers (see random())
+    Report report; // the game's buffered output, written to its output stream (see report.hpp)
+
+    int8 numPlayers = 0; // player objects currently in the context (copies included)
+    playerVector players; // human players and bots in the game, deleted along with the context
+    playerVector bots;
+
+    // settings for this game, starting out as the parameter defaults
+    int8 botAggression = BOT_AGGRESSION;
+    bool deferBotYears = DEFER_BOT_YEARS; // fast-forward bots nobody is looking at (see botActions()), games from the main menu take it from the program's own context (see main.cpp)
+    bool recordMetrics = true; // towns' years and events count towards telemetry while an exporter is running (see telemetry.hpp), off for scratch games
+
+    std::unique_ptr<TranspositionTable> searchTable; // shared by every bot search in this game and no other, made on the first one (see botSearch.hpp)
+
+    GameContext(); // console game (std::cin, std::cout, and std::cerr)
+    GameContext(std::istream& in, std::ostream& out); // errors go to the output stream
+    GameContext(std::istream& in, std::ostream& out, std::ostream& err);
+    GameContext(const GameContext&) = delete; // games can't be copied, only their players can (see Player)
+    GameContext& operator=(const GameContext&) = delete;
+    ~GameContext();
+
+    void setStreams(std::istream& in, std::ostream& out);
+    // pre: valid stream objects that outlive their usage by the game
+    // post: redirect the game's input and output (including errors) to the streams
+
+    void seed(unsigned int value) {generator.seed(value);}
+    // post: restart the game's random numbers from the seed
+    int random(int minVal, int maxVal);
+    // pre: maxVal greater than or equal to minVal
+    // post: return an evenly distributed random integer between minVal and maxVal from the game's generator
+};
+
+GameContext& currentContext();
+// pre: N/A
+// post: return the context of the game running on the current thread (the thread's default context unless a ContextScope says otherwise)
+
+void useContext(GameContext& context);
+// pre: context outlives its usage on the current thread
+// post: make the context current on this thread (used by the game host when resuming sessions, prefer ContextScope otherwise)
+
+class ContextScope // makes a context current on this thread until the end of the scope, restoring the earlier one afterwards (even on exceptions)
+{
+private:
+    GameContext& previous;
+public:
+    ContextScope(GameContext& context) : previous(currentContext()) {useContext(context);}
+    ~ContextScope() {useContext(previous);}
+    ContextScope(const ContextScope&) = delete;
+    ContextScope& operator=(const ContextScope&) = delete;
+};
+
+#endif // GAMECONTEXT_HPP
@@ -0,0 +1,967 @@
+#ifndef GAMEFLOW_CPP
+#define GAMEFLOW_CPP
+
+#include <iostream>
+#include <climits>
+#include <cmath>
+#include "gameFlow.hpp"
+#include "botPolicy.hpp" // bot decisions
+#include "botSearch.hpp"
+#include "releaseSolver.hpp" // grain release decisions
+#include "taxEngine.hpp" // batched taxes for deferred reports
+#include "townHistory.hpp" // undoing decisions
+#include "whatIfAdvisor.hpp" // advisor panel
+#include "allocationTracker.hpp" // allocation phases and budgets
+#include "helperFunctions.hpp" // input, rng, and chance functions
+#include "parameters.hpp" // constant game parameters
+
+namespace
+{
+    // sends a game's output nowhere until the end of the scope (if asked to)
+    class MutedOutput
+    {
+    private:
+        GameContext& game;
+        std::ostream* previous;
+        std::ostream muted;
+        bool muting;
+
+    public:
+        MutedOutput(GameContext& g, bool mute) : game(g), previous(g.output), muted(nullptr), muting(mute)
+        {
+            if (!muting) return;
+            game.report.flush(); // anything written before muting still goes out
+            game.output = &muted; // reports follow the game's output (see Report)
+        }
+        ~MutedOutput()
+        {
+            if (!muting) return;
+            game.report.clear();
+            game.output = previous;
+        }
+        MutedOutput(const MutedOutput&) = delete;
+        MutedOutput& operator=(const MutedOutput&) = delete;
+    };
+
+    // auto-pilot choices, in policy action order (see botPolicy.hpp)
+    std::string investmentLabel(int investment)
+    {
+        switch (investment)
+        {
+        case SaveGold: return "Save Gold";
+        case InvestGrain: return "Buy Grain";
+        case InvestLand: return "Buy Land";
+        case SellGrain: return "Sell Grain";
+        case SellLand: return "Sell Land";
+        case InvestSoldiers: return "Buy Soldiers";
+        default: return "Buy " + capitalize(ASSETS[investment - InvestAsset].plural); // one per asset type
+        }
+    }
+    const std::string TAX_LEVEL_LABELS[NUM_TAX_LEVELS] = {"No Taxes", "Half of Maximum Taxes", "Maximum Taxes"};
+    const std::string RELEASE_LABELS[NUM_RELEASE_CHOICES] = {"Release Solver's Suggestion", "Release Maximum Amount"};
+
+    std::string describeAutoPilot(const AutoPilot& autoPilot)
+    {
+        if (autoPilot.action < 0) return "Bot Policy";
+        return investmentLabel(autoPilot.action / NUM_TAX_LEVELS) + ", " + TAX_LEVEL_LABELS[autoPilot.action % NUM_TAX_LEVELS] + ", " + RELEASE_LABELS[autoPilot.release];
+    }
+}
+
+void mainMenu()
+{
+    /// main menu
+    do
+    {
+        gameOutput() << "\nWelcome to Santa Paravia and Fiumancco\n\n" // display title
+                  << "[1] Play Game\n" // and menu options
+                  << "[2] View Instructions\n"
+                  << "[3] View Credits\n"
+                  << "[4] Quit\n";
+
+        switch(intInput("\nPlease select an option: ", 1, 4)) // take and validate user choice
+        { // and call operations accordingly
+        case 1:
+        {
+            // every game gets its own context on the same streams, which deletes its players and bots at the end
+            GameContext game(gameInput(), gameOutput(), *currentContext().errors);
+            game.seed(random(INT_MAX)); // recorded sessions replay the same games from the program's seed
+            game.deferBotYears = currentContext().deferBotYears; // set from the command line
+            ContextScope scope(game);
+
+            // call functions set up game objects to start gameplay (bots are asked about first)
+            botSetup(game);
+            playerSetup(game);
+            playGame(game); // playGame function comprises of all in-game activity, game ends when function call ends
+            gameOutput() << "Game ended. Thanks for playing!\n";
+            break;
+        }
+        case 2:
+            // display instructions
+            gameOutput() << "\n\nINSTRUCTIONS\n"
+                      << "Overview: \n"
+                      << "- In Santa Paravia and Fiumancco, you play as the ruler of an Italian city-state circa 1400.\n"
+                      << "- Trade goods and invest in assets to accumulate wealth while keeping your people fed and defending from invasions.\n"
+                      << "- Good management of wealth and resources will allow your town to grow and prosper.\n"
+                      << "Controls: \n"
+                      << "- As a text-based game, most of the controls in Santa Paravia are fairly straightfoward.\n"
+                      << "- You will be given a series of text menus and input prompts to make decisions from.\n"
+                      << "- Explanations for the implications of individual decisions will be available as they are shown to you.\n"
+                      << "How to win: \n"
+                      << "- Your score is calculated as an approximation of the total wealth in your town relative to when you started.\n"
+                      << "- This is measured in terms of population and resources and assets owned in addition to the gold in your treasury.\n"
+                      << "- On higher difficulties, poor financial decisions will result in you losing score, so act carefully to maximize returns.\n"
+                      << "- By reaching a sufficiently high score, you can earn progressively more prestigious titles.\n"
+                      << "- Reaching the rank of king or queen will allow you to win the game, but you get limited time to do this before your character dies.\n"
+                      << "- AI-controlled bots will also be competing against you for the throne, so watch out.\n";
+
+            gameInput().ignore(INT_MAX, '\n');
+            pressEnterToContinue("\n(Press ENTER to return to menu)"); // pause program output before displaying menu again
+            break;
+        case 3:
+            // display credits
+            gameOutput() << "\n\nCREDITS"
+                      << "\nProgramming: \n"
+                      << "Original game created by George Blank (c)1978\n"
+                      << "C port written by Thomas Knox (c)2000\n"
+                      << "Current C++ port written by Thomas Li (c)2018\n"
+                      << "Graphics: \n"
+                      << "N/A\n"
+                      << "Sound: \n"
+                      << "N/A\n";
+
+            gameInput().ignore(INT_MAX, '\n');
+            pressEnterToContinue("\n(Press ENTER to return to menu)"); // pause program output before displaying menu again
+            break;
+        case 4:
+            // exit program if user chose to quit
+            return;
+        default:
+            // throw exception if input not recognized as one of the above (should already be validated)
+            throw std::logic_error("Error: Invalid menu input received.");
+        }
+    } while (true); // return to menu if player didn't choose to quit
+}
+
+void playerSetup(GameContext& game)
+{
+    AllocationScope phase(SetupPhase);
+    playerVector& players = game.players; // start with empty vector
+    int8 numPlayers = intInput("\nHow many players would you like? (1-" + std::to_string(MAX_PLAYERS) + "): ", 1, MAX_PLAYERS); // take input for amount of players to create
+
+    for (int i = 0; i < numPlayers; ++i) // initialize individual player objects
+    {
+        gameOutput() << "\nPlayer " << i + 1 << ": \n"; // take input for member values in constructor: 
+        gameInput().ignore(INT_MAX, '\n');
+        players.push_back(new Player(game, strInput("Enter your name (1-50 letters): ", 1, 50), // name
+                                     strInput("Enter the name of your town (1-50 letters): ", 1, 50), // town name
+                                     intInput("Enter the difficulty level to play on (1-" + std::to_string(MAX_DIFFICULTY) + "): ", MIN_DIFFICULTY, MAX_DIFFICULTY), // difficulty
+                                     static_cast<Gender>(ynInput("Enter your gender (m/f): ", 'f', 'm')))); // gender
+    }
+
+    // display results of initialization in program output
+    gameOutput() << "\nWelcome Players:\n";
+    for (Player* p: players) gameOutput() << p->getTitle() << " " << p->getName() << " of " << p->getTownName() << '\n';
+}
+
+void botSetup(GameContext& game)
+{
+    AllocationScope phase(SetupPhase);
+    playerVector& bots = game.bots; // empty vector to hold objects
+    int8 numBots = intInput("\nHow many bots would you like? (1-" + std::to_string(MAX_BOTS) + "): ", 1, MAX_BOTS); // take input for amount to create
+    BotStrategy strategy = static_cast<BotStrategy>(intInput("Bot skill level ([1] Normal, [2] Hard): ", 1, 2) - 1); // hard bots search ahead instead of following the policy table
+    SearchBudget budget {BOT_THINKING_TIME, 0, BOT_SEARCH_THREADS};
+    if (strategy == SearchStrategy) // more time makes for better moves but slower turns
+        budget.milliseconds = intInput("Thinking time per turn for hard bots in milliseconds (1-" + std::to_string(MAX_THINKING_TIME) + ", " + std::to_string(BOT_THINKING_TIME) + " recommended): ", 1, MAX_THINKING_TIME);
+
+    gameOutput() << "\nWelcome Bots:\n";
+    for (int i = 0; i < numBots; ++i) // initialize objects
+    {
+        // initialization process
+        bots.push_back(new Bot(game, BOTNAMES[random(NUM_BOTNAMES - 1)], // name and townName assigned randomly from a list
+                               BOTNAMES[random(NUM_BOTNAMES - 1)], strategy, budget)); // other members randomly assigned within allowed range
+
+        gameOutput() << bots[i]->getTitle() << " " << bots[i]->getName() << " of " << bots[i]->getTownName() << '\n'; // display results of initialization in program output
+    }
+}
+
+void playGame(GameContext& game)
+{
+    const playerVector& players = game.players;
+    const playerVector& bots = game.bots;
+
+    gameOutput() << "\nStarting Game...\n"; // header text
+
+    std::vector<AutoPilot> autoPilots(players.size()); // one for each player, in the same order
+    AllocationBudget wholeGame(GameBudget); // measured from here on (if tracking allocations, see allocationTracker.hpp)
+
+    do // start game loop
+    {
+        // player turns
+        for (std::size_t i = 0; i < players.size(); ++i)
+        {
+            Player* p = players[i];
+            AutoPilot& pilot = autoPilots[i];
+            if (!p->gameEnded()) // player only gets to play their turn if they haven't died yet
+            {
+                AllocationBudget turn(TurnBudget);
+                if (!pilot.active()) gameMenu(game, p, pilot); // main action menu (which can hand the turn over to the auto-pilot)
+
+                if (pilot.active()) autoTurn(game, p, pilot); // auto-pilot plays the whole turn
+                else
+                {
+                    grainRelease(p); // post-turn actions
+                    AllocationScope phase(YearEndPhase);
+                    p->turnResults(); // display results of turn
+                }
+
+                if (gameOver(game)) break; // check ending conditions afterwards
+                if (pilot.active()) continue; // no breaks until the auto-pilot is done
+
+                // have the user press a key to continue to the next turn to avoid to much output being displayed at once
+                gameInput().ignore(INT_MAX, '\n');
+                pressEnterToContinue("Turn completed. (Press ENTER to continue)");
+            }
+        }
+        if (gameOver(game)) break;
+
+        // bots play without any output or breaks while nobody's watching (every player still in the game is on auto-pilot)
+        bool unattended = true;
+        for (std::size_t i = 0; i < players.size(); ++i) if (!players[i]->gameEnded() && !autoPilots[i].active()) unattended = false;
+        MutedOutput muted(game, unattended);
+
+        // bot turns
+        for (Player* b : bots)
+        {
+            if (!b->gameEnded())
+            {
+                AllocationBudget turn(TurnBudget);
+                if (!botActions(game, static_cast<Bot*>(b), !unattended)) continue; // all bot activity done wtihin function (bots are always created as Bot objects by botSetup()), nothing to see if the turn was fast-forwarded
+                if (b->won()) break; // bots can win the game
+
+                // have the user press a key to continue to the next turn to avoid to much output being displayed at once
+                if (!unattended) pressEnterToContinue("Turn completed. (Press ENTER to continue)");
+            }
+        }
+
+    } while (!gameOver(game)); // loop ends if end conditions reached (should already have been checked)
+
+    // view final player standings before exiting
+    gameOutput() << "FINAL STANDINGS\n";
+    printStandings(game);
+    pressEnterToContinue("\n(Press ENTER to return to menu)");
+    gameOutput() << '\n';
+}
+
+void printStandings(GameContext& game)
+{
+    AllocationScope phase(StandingsPhase);
+    const playerVector& players = game.players;
+    const playerVector& bots = game.bots;
+    catchUpTowns(bots); // standings show every town as of its latest year
+
+    // build up the whole table before writing it out
+    Report& report = consoleReport();
+
+    // stats for all players
+    report << "\nPlayers: \n";
+    for (Player* p : players) p->printStats(report);
+    // and for all bots
+    report << "\nBots: \n";
+    for (Player* b : bots) b->printStats(report);
+
+    report.flush();
+}
+
+void catchUpTowns(playerVector towns)
+{
+    AllocationScope phase(CatchUpPhase);
+    TaxBatch batch;
+    playerVector due; // towns in the current batch, in batch order
+
+    do
+    {
+        // gather every town with a year left to catch up on
+        due.clear();
+        for (Player* t : towns)
+        {
+            if (t->getDeferredYears() < 1) continue;
+            if (t->gameEnded()) t->dropDeferredYears(); // nothing happens after the game ends
+            else due.push_back(t);
+        }
+        if (due.empty()) return;
+
+        // every town's decisions for the year, same as botActions() without the invasion (towns that invade never get their turns deferred)
+        for (Player* t : due)
+        {
+            Bot* bot = static_cast<Bot*>(t); // only bots get fast-forwarded
+            BotDecision decision = bot->getStrategy() == SearchStrategy ? searchDecision(*bot, bot->getBudget()) : BotDecision {policyAction(*bot), SolverRelease};
+            applyPolicyAction(*bot, decision.action);
+            applyRelease(*bot, decision.release);
+        }
+
+        // taxes come first in the report, so all of them can be worked out up front
+        batch.clear();
+        for (Player* t : due) batch.add(*t);
+        batch.compute();
+
+        // then towns of each difficulty one after another, since they share a year-end engine (see Player::yearEnd())
+        for (int difficulty = MIN_DIFFICULTY; difficulty <= MAX_DIFFICULTY; ++difficulty)
+        {
+            for (std::size_t i = 0; i < due.size(); ++i)
+            {
+                if (due[i]->getDifficulty() != difficulty) continue;
+
+                int revenues[NUM_TAXES];
+                for (int tax = 0; tax < NUM_TAXES; ++tax) revenues[tax] = batch.getRevenue(i, static_cast<TaxCategory>(tax));
+                due[i]->catchUp(revenues);
+            }
+        }
+    } while (true); // repeat for towns that are more than a year behind
+}
+
+bool gameOver(GameContext& game)
+{
+    // end conditions: one player has won or every player has died
+    for (Player* p : game.players)
+    {
+        if (p->won()) return true;
+        if (!(p->dead())) return false;
+    }
+    return true;
+}
+
+void gameMenu(GameContext& game, Player* currentPlayer, AutoPilot& autoPilot)
+{
+    AllocationScope phase(GameMenuPhase);
+    TurnHistory history(*currentPlayer); // decisions made from this menu can be undone until the turn ends
+
+    do
+    {
+        // display header text
+        gameOutput() << "\nYear " << currentPlayer->getYear() << " (Turn " << currentPlayer->getYear() - STARTING_YEAR + 1 << ")\n";
+        currentPlayer->printStats();
+
+        // and menu choices
+        gameOutput() << "Administrative Decisions: \n"
+                  << "[1] Buy Goods\n"
+                  << "[2] Buy Soldiers\n"
+                  << "[3] Buy Assets\n"
+                  << "[4] Adjust Taxes\n"
+                  << "[5] Invade Rivals\n"
+                  << "[6] View Standings\n"
+                  << "[7] Help\n"
+                  << "[8] End Turn\n"
+                  << "[9] Undo" << (history.canUndo() ? " (" + history.undoLabel() + ")" : "") << '\n'
+                  << "[10] Redo" << (history.canRedo() ? " (" + history.redoLabel() + ")" : "") << '\n'
+                  << "[11] Auto-Play\n";
+
+        // get choice, call functions accordingly
+        switch(intInput("Select an option: ", 1, 11))
+        {
+        case 1:
+            // display options for buying/selling land an grain
+            goodsMenu(currentPlayer);
+            history.record("trading goods");
+            break;
+        case 2:
+            // display relevant info (gold, soldiers owned, soldier price, soldier pay)
+            gameOutput() << "\nCurrent Gold: " << currentPlayer->getGold();
+            gameOutput() << "\nSoldiers Owned: " << currentPlayer->getSoldiers();
+            gameOutput() << ", Cost per Soldier: " << currentPlayer->getSoldierPrice() << "g (Yearly Upkeep: " << currentPlayer->getSoldierPay() << "g)\n";
+
+            // directly prompt player to make purchase (not enough available options to warrant a dedicated menu)
+            currentPlayer->buySoldiers(intInput("How many soldiers would you like to buy? (max "
+                                                + std::to_string(SOLDIER_PURCHASE_LIMIT) + " per purchase, buy 0 to cancel) ",
+                                                 0, SOLDIER_PURCHASE_LIMIT)); // purchase volume restricted to prevent mass debt-purchases
+            history.record("buying soldiers");
+            break;
+        case 3:
+            // display options for buying assets
+            assetMenu(currentPlayer);
+            history.record("buying assets");
+            break;
+        case 4:
+            // display options for adjusting tax rates
+            taxMenu(currentPlayer);
+            history.record("adjusting taxes");
+            break;
+        case 5:
+            // display options for invading other players
+            if (invasionMenu(game, currentPlayer)) history.restart(); // battles can't be taken back
+            break;
+        case 6:
+            // display stats for all players and bots in game
+            printStandings(game);
+            break;
+        case 7:
+            // display helper instructions
+            gameOutput() << "\nThis the main game menu from which you can make most of your decisions.\n"
+                      << "If this is your first time playing, take the time to look"
+                      << "though each of your options to see what's available for you to do.\n"
+                      << "Once you're done, select the End Turn option to proceed to the next step.\n"
+                      << "Until then, Undo takes back your latest decision (except for invasions) and Redo makes it again.\n"
+                      << "Auto-Play plays your next turns for you, either like the bots would or with the same decisions every turn.\n";
+
+            // pause output before returning to menu so player can see instruction text
+            gameInput().ignore(INT_MAX, '\n');
+            pressEnterToContinue("(Press ENTER to continue)");
+            break;
+        case 8:
+            // exit function, proceed with game
+            return;
+        case 9:
+            // take back the latest decision
+            if (history.canUndo())
+            {
+                gameOutput() << "\nUndid " << history.undoLabel() << ".\n";
+                history.undo();
+            }
+            else gameOutput() << "\nThere's nothing to undo this turn.\n";
+            break;
+        case 10:
+            // and make it again
+            if (history.canRedo())
+            {
+                gameOutput() << "\nRedid " << history.redoLabel() << ".\n";
+                history.redo();
+            }
+            else gameOutput() << "\nThere's nothing to redo.\n";
+            break;
+        case 11:
+            // hand the town over for some turns, starting with this one
+            if (autoPilotMenu(currentPlayer, autoPilot)) return;
+            break;
+        default:
+            throw std::logic_error("Invalid menu input received."); // throw exception if input not accounted for
+        }
+    } while (true); // loop doesn't terminate until user chooses "end turn" option
+}
+
+void goodsMenu(Player* player)
+{
+    AllocationScope phase(GoodsMenuPhase);
+    advisorPanel(player); // suggestions for the town as the menu opens
+
+    do
+    {
+        // display relevant header info (gold, grain prices, grain owned, land prices, land owned)
+        gameOutput() << "\nCurrent Gold: " << player->getGold() // display relevant info (gold, soldiers owned, soldier price, soldier pay)
+                  << "\nGrain Owned: " << player->getGrain()
+                  << ", Grain Price: " << player->getGrainPrice() << "g"
+                  << "\nLand Owned: " << player->getLand()
+                  << ", Land Price: " << player->getLandPrice() << "g\n";
+
+        // display choices
+        gameOutput() << "\nOptions: \n"
+                  << "[1] Buy Grain\n"
+                  << "[2] Buy Land\n"
+                  << "[3] Sell Grain\n"
+                  << "[4] Sell Land\n"
+                  << "[5] Help\n"
+                  << "[6] Back\n";
+
+        // take user choice, call operations accordingly
+        switch(intInput("Select an option: ", 1, 6))
+        {
+        case 1:
+            // prompt player to buy grain, take and validate input
+            player->buyGrain(intInput("How much grain would you like to buy? (max "
+                                     + std::to_string(GRAIN_PURCHASE_LIMIT) + " per purchase, buy 0 to cancel) ",
+                                     0, GRAIN_PURCHASE_LIMIT)); // purchase volume restricted to prevent excessive debt-purchases
+            break;
+        case 2:
+            // prompt player to buy land, take and validate input
+            player->buyLand(intInput("How much land would you like to buy? (max "
+                                     + std::to_string(LAND_PURCHASE_LIMIT) + " per purchase, buy 0 to cancel) ",
+                                     0, LAND_PURCHASE_LIMIT)); // purchase volume restricted to prevent mass debt-purchases
+            break;
+        case 3:
+            // prompt player to sell grain, take and validate input
+            player->sellGrain(intInput("How much grain would you like to sell? (must keep "
+                                     + std::to_string(MIN_GRAIN) + ", sell 0 to cancel) ", // player must keep a minimum amount of land
+                                      0, (player->getGrain() > MIN_GRAIN ? player->getGrain() - MIN_GRAIN : 0))); // conditional operator to allow player to sell 0 without causing errors
+            break;
+        case 4:
+            // prompt player to sell land, take and validate input
+            player->sellLand(intInput("How much land would you like to sell? (must keep "
+                                     + std::to_string(MIN_LAND) + ", sell 0 to cancel) ", // player must keep a minimum amount of land
+                                      0, (player->getLand() > MIN_LAND ? player->getLand() - MIN_LAND : 0))); // conditional operator to allow player to sell 0 without causing errors
+            break;
+        case 5:
+            // display help
+            gameOutput() << "\nHere you can make bulk purchases and sales of goods and "
+                      << "resources that serve essential purposes for your town: "
+                      << "- Grain is needed to feed your serfs and prevent them from starving. They'll produce some on their "
+                      << " own each turn but you might need to buy extra in case of a poor harvest\n"
+                      << "- Land mainly serves as a measure of your town's power and counts extra towards your score "
+                      << "though it doesn't have any other uses implemented yet.\n"
+                      << "On higher difficulties, goods sell for less than what you buy them for, "
+                      << "so make each transaction count.\n";
+
+            // pause output before returning to action menu so player can see instruction text
+            gameInput().ignore(INT_MAX, '\n');
+            pressEnterToContinue("(Press ENTER to continue)");
+            break;
+        case 6:
+            // exit menu, return to game menu
+            return;
+        default:
+            throw std::logic_error("Invalid menu input received."); // throw exception if input not accounted for
+        }
+    } while (true); // menu loop only terminates if user chooses to go back
+}
+
+void assetMenu(Player* player)
+{
+    AllocationScope phase(AssetMenuPhase);
+    advisorPanel(player);
+
+    // one option for every asset type in the registry, then the other options
+    const int help = NUM_ASSETS + 1;
+    const int back = NUM_ASSETS + 2;
+
+    do
+    {
+        // display relevant header info (gold)
+        gameOutput() << "\nCurrent Gold: " << player->getGold() << "\n";
+
+        // display choices
+        gameOutput() << "\nOptions: \n";
+        for (int type = 0; type < NUM_ASSETS; ++type) // prices shown alongside purchase option
+            gameOutput() << "[" << type + 1 << "] Buy " << capitalize(ASSETS[type].name) << " (" << player->getAssetPrice(static_cast<AssetType>(type)) << "g)\n";
+        gameOutput() << "[" << help << "] Help\n"
+                  << "[" << back << "] Back\n";
+
+        // take user choice, call operations accordingly
+        int choice = intInput("Select an option: ", 1, back);
+        if (choice == help)
+        {
+            // display help
+            gameOutput() << "\nAssets are long-term investments that can generate revenue over time, "
+                      << "either directly or by attracting tax-paying citizens to your town each turn.\n";
+            for (const AssetSpec& asset : ASSETS) gameOutput() << "- " << capitalize(asset.plural) << ' ' << asset.description << ".\n";
+            gameOutput() << "In case of bankruptcy, your assets will be seized by creditors, so be careful.\n";
+
+            // pause output before returning to action menu so player can see instruction text
+            gameInput().ignore(INT_MAX, '\n');
+            pressEnterToContinue("(Press ENTER to continue)");
+        }
+        else if (choice == back)
+        {
+            // exit menu, return to game menu
+            return;
+        }
+        else
+        {
+            // buy the chosen asset otherwise
+            player->buyAsset(static_cast<AssetType>(choice - 1));
+        }
+    } while (true); // menu loop only terminates if user chooses to go back
+}
+
+void taxMenu(Player* player)
+{
+    AllocationScope phase(TaxMenuPhase);
+    do
+    {
+        // display choices
+        gameOutput() << "\nOptions: \n"
+                  << "[1] Adjust Sales Tax (Current Rate: " << player->getSales() << "%)\n" // current prices shown alongside adjustment option
+                  << "[2] Adjust Income Tax (Current Rate: " << player->getIncome() << "%)\n"
+                  << "[3] Adjust Customs Duty (Current Rate: "<<  player->getCustoms() << "%)\n"
+                  << "[4] Help\n"
+                  << "[5] Back\n";
+
+        // take user choice, call operations accordingly
+        switch(intInput("Select an option: ", 1, 5))
+        {
+        case 1:
+            // prompt player to adjust sales tax within range, take and validate input
+            player->adjustSales(intInput("Enter the new sales tax rate (min " + std::to_string(MIN_TAX) +
+                                        ", max " + std::to_string(MAX_SALES_TAX) + "): ",
+                                         MIN_TAX, MAX_SALES_TAX));
+            break;
+        case 2:
+            // prompt player to adjust income tax within range, take and validate input
+            player->adjustIncome(intInput("Enter the new income tax rate (min " + std::to_string(MIN_TAX) +
+                                        ", max " + std::to_string(MAX_INCOME_TAX) + "): ",
+                                         MIN_TAX, MAX_INCOME_TAX));
+            break;
+        case 3:
+            // prompt player to adjust customs duty within range, take and validate input
+            player->adjustCustoms(intInput("Enter the new customs duty rate (min " + std::to_string(MIN_TAX) +
+                                        ", max " + std::to_string(MAX_CUSTOMS_TAX) + "): ",
+                                         MIN_TAX, MAX_CUSTOMS_TAX));
+            break;
+        case 4:
+            // display help
+            gameOutput() << "\nTaxes represent the main source of your yearly income, "
+                      << "with each tax getting its revenue from different sources:\n"
+                      << "- Sales: merchants, nobles, and assets\n"
+                      << "- Income: nobles and assets\n"
+                      << "- Customs: merchants, clergy, nobles, and assets\n"
+                      << "Higher tax rates allow you to earn more revenue, but "
+                      << "will make potential taxpayers less willing to move to your town.\n";
+
+            // pause output before returning to action menu so player can see instruction text
+            gameInput().ignore(INT_MAX, '\n');
+            pressEnterToContinue("(Press ENTER to continue)");
+            break;
+        case 5:
+            // exit menu, return to game menu
+            return;
+        default:
+            throw std::logic_error("Invalid menu input received."); // throw exception if input not accounted for
+        }
+    } while (true); // menu loop only terminates if user chooses to go back
+}
+
+bool invasionMenu(GameContext& game, Player* currentPlayer)
+{
+    AllocationScope phase(InvasionMenuPhase);
+    const playerVector& players = game.players;
+    const playerVector& bots = game.bots;
+    catchUpTowns(bots); // targets and their armies as of their latest year
+
+    playerVector targets; // menu options can differ based on circumstances
+    // essentially consist of all players and bots that aren't dead and aren't the current player
+    for (Player* p : players) if (!p->dead() && p != currentPlayer) targets.push_back(p);
+    for (Player* b : bots) if (!b->dead()) targets.push_back(b);
+
+    // record indexes for options for other optioms 2
+    const int help = targets.size() + 1;
+    const int cancel = targets.size() + 2;
+
+    do
+    {
+        // display relevant header info (gold, soldiers)
+        gameOutput() << "\nCurrent Gold: " << currentPlayer->getGold()
+                  << "\nSoldiers Owned: " << currentPlayer->getSoldiers() << "\n";
+
+        // display choices
+        gameOutput() << "\nOptions:\n"; //
+        for (std::size_t i = 0; i < targets.size(); ++i)
+        {
+            gameOutput() << "[" << i + 1 << "] Invade "
+                      << targets[i]->getTitle() << " " << targets[i]->getName() << " of " << targets[i]->getTownName()
+                      << " (" << targets[i]->getSoldiers() << " soldiers)\n";
+        } // options to get help and return to game menu
+        gameOutput() << "[" << help << "] Help\n"
+                  << "[" << cancel << "] Back\n";
+
+
+
+        // take user choice, call operations accordingly
+        int choice = intInput("Select an option: ", 1, targets.size() + 2);
+        if (choice == help)
+        {
+            // display help if player chose to do so
+            gameOutput() << "\nIf you're tired of having to buy and manage your own resources, you "
+                      << "can use your soldiers to attempt to seize grain, land, or assets "
+                      << "by force from any of the other players in the game.  \n"
+                      << "The defenders will fight back, though, so be sure to invest well enough "
+                      << "into your army to ensure a successful invasion.\n"
+                      << "You can buy soldiers from the turn menu if you need more. \n";
+
+            // pause output before returning to action menu so player can see instruction text
+            gameInput().ignore(INT_MAX, '\n');
+            pressEnterToContinue("(Press ENTER to continue)");
+            return false; // back to the game menu without invading anyone
+        }
+        else if (choice == cancel)
+        {
+            // exit function if player chose to go back
+            return false;
+        }
+        else
+        {
+            // invade specified target otherwise
+            currentPlayer->invade(targets[choice - 1]);
+            return true;
+        }
+    } while (true); // menu loop only terminates if user chooses to go back
+}
+
+void previewRelease(Player* player)
+{
+    Report& report = consoleReport();
+    report << "\nExpected outcomes (+/- one standard deviation):\n";
+
+    // evenly spaced amounts from the minimum to the maximum, plus the amount that exactly meets demand
+    const int steps = 5;
+    const int low = player->minRelease(), high = player->maxRelease();
+    const int demand = player->grainDemand() - player->getReleasedGrain(); // grain still needed this year
+    bool demandShown = demand < low || demand > high; // only list it if it can be released
+
+    for (int i = 0; i <= steps; ++i)
+    {
+        int amount = low + static_cast<long long>(high - low) * i / steps;
+        if (!demandShown && demand <= amount)
+        {
+            if (demand < amount) previewLine(player->projectRelease(demand), demand, report);
+            demandShown = true;
+        }
+        previewLine(player->projectRelease(amount), amount, report);
+        if (high == low) break; // only one possible amount
+    }
+
+    // suggest the amount a bot would pick
+    ReleaseSolver solver;
+    report << "Suggested release: " << solver.solve(*player, releaseObjective(*player, releaseHorizon(*player))) << '\n';
+
+    report.flush();
+}
+
+void advisorPanel(Player* player)
+{
+    // every standard bundle projected at once on a clone of the town
+    WhatIfBatch batch(*player);
+    batch.addStandardBundles();
+    batch.compute();
+    const int nothing = 0; // doing nothing is always the first standard bundle, and always possible
+    const int baseline = batch.getScore(nothing);
+
+    Report& report = consoleReport();
+    report << "\nAdvisor (expected end of next year, if you release the grain your serfs need):\n";
+    for (int i : batch.best(ADVISOR_SUGGESTIONS))
+    {
+        int change = static_cast<int>(batch.getScore(i)) - baseline;
+        report << "- " << describeBundle(batch.getBundle(i)) << ": score " << static_cast<int>(batch.getScore(i))
+               << " (" << (change >= 0 ? "+" : "") << change << "), " << static_cast<int>(batch.getCash(i)) << " gold\n";
+    }
+    report << "- do nothing: score " << baseline << ", " << static_cast<int>(batch.getCash(nothing)) << " gold\n";
+
+    report.flush();
+}
+
+void previewLine(const ReleaseProjection& projection, int amount, Report& report)
+{
+    // round to whole serfs for display
+    auto rounded = [](float value) {return static_cast<int>(std::floor(value + 0.5f));};
+
+    report << "Release " << amount << ": "
+           << rounded(projection.births) << " births (+/- " << rounded(std::sqrt(projection.birthVariance)) << "), "
+           << rounded(projection.deaths) << " deaths (+/- " << rounded(std::sqrt(projection.deathVariance)) << "), "
+           << rounded(projection.migration) << " migrants, about "
+           << rounded(projection.serfs) << " serfs next year (+/- " << rounded(std::sqrt(projection.serfVariance)) << ")\n";
+}
+
+void grainRelease(Player* player)
+{
+    AllocationScope phase(GrainReleasePhase);
+    do
+    {
+        // display relevant header info (grain, grain demand)
+        gameOutput() << "\nDistribute Grain for Consumption\n"
+                  << "Current Reserve: " << player->getGrain()
+                  << "\n" << player->grainDemand() << " grain will be needed to feed " << player->getTownName() << "'s population this year.\n";
+
+        // display choices
+        gameOutput() << "\nOptions: \n"
+                  << "[1] Release Minimum Amount (" << MIN_GRAIN_RELEASE << "% - " << player->minRelease() << ")\n"
+                  << "[2] Release Maximum Amount (" << MAX_GRAIN_RELEASE << "% - " << player->maxRelease() << ")\n"
+                  << "[3] Release Other Amount\n"
+                  << "[4] Buy More Grain\n"
+                  << "[5] Preview Outcomes\n"
+                  << "[6] Help\n";
+
+        // take user choice, call operations accordingly
+        switch(intInput("Select an option: ", 1, 6))
+        {
+        case 1:
+            // release minimum amount
+            player->releaseGrain(player->minRelease());
+            return;
+        case 2:
+            // release maximum amount
+            player->releaseGrain(player->maxRelease());
+            return;
+        case 3:
+            // take and validate input for how much to release
+            player->releaseGrain(intInput("Enter the amount to release: ", player->minRelease(), player->maxRelease()));
+            return;
+        case 4:
+            // show prompt for player to buy grain along with relevant info, take and valdiate input
+            gameOutput() << "Current Gold: " << player->getGold() << ", Grain Price: " << player->getGrainPrice() << "g\n";
+            player->buyGrain(intInput("How much would you like to buy? (max "
+                                     + std::to_string(GRAIN_PURCHASE_LIMIT) + " per purchase, buy 0 to cancel) ",
+                                     0, GRAIN_PURCHASE_LIMIT));
+            break;
+        case 5:
+            // show expected results of releases across the allowed range
+            previewRelease(player);
+            gameInput().ignore(INT_MAX, '\n');
+            pressEnterToContinue("(Press ENTER to continue)");
+            break;
+        case 6:
+            // display help
+            gameOutput() << "\nWhile tax-paying citizens can eat on their own paycheck, "
+                      << "your serfs rely on you to release a portion of your grain reserves "
+                      << "each year in order to keep them fed.\n"
+                      << "Not meeting the demand will result in serfs starving to death, while exceeding "
+                      << "it will increase birth rates and spur migration to your town.\n"
+                      << "Don't release too much, though, or you might have trouble replenishing"
+                      << "your reserves in later turns.\n"
+                      << "If you need more grain, you can buy some here.\n";
+
+            // pause output quickly before returning to action menu so player can see instruction text
+            gameInput().ignore(INT_MAX, '\n');
+            pressEnterToContinue("(Press ENTER to continue)");
+            break;
+        default:
+            throw std::logic_error("Invalid menu input received."); // throw exception if input not accounted for
+        }
+    } while (true); // menu loop terminates if player chooses option other than help or buy more grain(will return)
+}
+
+bool autoPilotMenu(Player* player, AutoPilot& autoPilot)
+{
+    // display choices
+    gameOutput() << "\nAuto-Play\n"
+              << "Let your next turns play out on their own, starting with this one.\n"
+              << "\nOptions: \n"
+              << "[1] Bot Policy (purchases and taxes like the bots, grain release from the solver)\n"
+              << "[2] Same Decisions Every Turn\n";
+    if (autoPilot.used) gameOutput() << "[3] Last Settings (" << describeAutoPilot(autoPilot) << ")\n";
+    gameOutput() << "[" << (autoPilot.used ? 4 : 3) << "] Back\n";
+
+    // take user choice, set up the auto-pilot accordingly
+    int choice = intInput("Select an option: ", 1, autoPilot.used ? 4 : 3);
+    if (choice == 1)
+    {
+        autoPilot.action = -1;
+        autoPilot.release = SolverRelease;
+    }
+    else if (choice == 2)
+    {
+        gameOutput() << "\nInvestments (up to half of your treasury every turn, sales get rid of half of what you can spare): \n";
+        for (int i = 0; i < NUM_INVESTMENTS; ++i) gameOutput() << "[" << i + 1 << "] " << investmentLabel(i) << '\n';
+        int investment = intInput("Select an investment: ", 1, NUM_INVESTMENTS) - 1;
+
+        gameOutput() << "\nTaxes: \n";
+        for (int i = 0; i < NUM_TAX_LEVELS; ++i) gameOutput() << "[" << i + 1 << "] " << TAX_LEVEL_LABELS[i] << '\n';
+        int taxLevel = intInput("Select a tax level: ", 1, NUM_TAX_LEVELS) - 1;
+
+        gameOutput() << "\nGrain: \n";
+        for (int i = 0; i < NUM_RELEASE_CHOICES; ++i) gameOutput() << "[" << i + 1 << "] " << RELEASE_LABELS[i] << '\n';
+        autoPilot.release = static_cast<ReleaseChoice>(intInput("Select a grain release: ", 1, NUM_RELEASE_CHOICES) - 1);
+        autoPilot.action = investment * NUM_TAX_LEVELS + taxLevel;
+    }
+    else if (!(autoPilot.used && choice == 3)) return false; // back to the game menu
+
+    int maxTurns = player->getYearsLeft() > 1 ? player->getYearsLeft() : 1; // nobody rules past their death
+    autoPilot.turnsLeft = intInput("How many turns should play out? (1-" + std::to_string(maxTurns) + ") ", 1, maxTurns);
+    autoPilot.used = true;
+
+    // remember where the town started from
+    autoPilot.startYear = player->getYear();
+    autoPilot.startScore = player->getScore();
+    autoPilot.startGold = player->getGold();
+    autoPilot.startLand = player->getLand();
+    autoPilot.startSerfs = player->getSerfs();
+
+    gameOutput() << "\nPlaying " << autoPilot.turnsLeft << (autoPilot.turnsLeft == 1 ? " turn" : " turns") << " with " << describeAutoPilot(autoPilot) << "...\n";
+    return true;
+}
+
+void autoTurn(GameContext& game, Player* player, AutoPilot& autoPilot)
+{
+    AllocationScope phase(AutoPlayPhase);
+    if (!autoPilot.active()) throw std::logic_error("Error: Auto-pilot turn played without an auto-pilot.");
+
+    {
+        MutedOutput muted(game, true); // nothing gets shown until the summary
+
+        // same calls as making those choices in the menus
+        applyPolicyAction(*player, autoPilot.action < 0 ? policyAction(*player) : autoPilot.action);
+        applyRelease(*player, autoPilot.release);
+        player->turnResults();
+    }
+
+    --autoPilot.turnsLeft;
+    if (player->gameEnded()) autoPilot.turnsLeft = 0; // nothing left to play
+    if (!autoPilot.active()) autoPilotSummary(player, autoPilot);
+}
+
+void autoPilotSummary(const Player* player, const AutoPilot& autoPilot)
+{
+    Report& report = consoleReport();
+    auto change = [&](int now, int before) {report << now << " (" << (now >= before ? "+" : "") << now - before << ")";};
+
+    report << "\nAuto-Play Summary (" << describeAutoPilot(autoPilot) << ")\n"
+           << "Played " << player->getYear() - autoPilot.startYear << " turns, " << autoPilot.startYear << " to " << player->getYear() << ".\n"
+           << "Score: ";
+    change(player->getScore(), autoPilot.startScore);
+    report << ", Gold: ";
+    change(player->getGold(), autoPilot.startGold);
+    report << ", Land: ";
+    change(player->getLand(), autoPilot.startLand);
+    report << ", Serfs: ";
+    change(player->getSerfs(), autoPilot.startSerfs);
+    report << "\n\n";
+    player->printStats(report);
+
+    report.flush();
+}
+
+bool botActions(GameContext& game, Bot* bot, bool pause)
+{
+    AllocationScope phase(BotTurnPhase);
+    const playerVector& players = game.players;
+    const playerVector& bots = game.bots;
+
+    // fast-forwarding: only bots that invade someone this year touch another town, everyone else's turn can wait until somebody looks
+    bool invading = false; // rolled up front when fast-forwarding, after the bot's decisions otherwise
+    if (game.deferBotYears)
+    {
+        invading = rollChance(game.botAggression, 100);
+        if (!invading)
+        {
+            bot->deferTurn();
+            return false;
+        }
+        catchUpTowns(bots); // the bot's own stats, and every target it could pick
+        if (bot->gameEnded()) return false; // its game ended during the owed years
+    }
+
+    // current AI behavior for each bot
+
+    // display stats header
+    gameOutput() << "Year " << bot->getYear() << " (Turn " << bot->getYear() - STARTING_YEAR + 1 << ")\n";
+    bot->printStats();
+
+    // quick break in program output
+    if (pause) pressEnterToContinue("(Press ENTER to continue)");
+
+    // purchases, tax rates, and grain release come from the policy table for the bot's current situation (or from searching ahead for hard bots)
+    BotDecision decision = bot->getStrategy() == SearchStrategy ? searchDecision(*bot, bot->getBudget()) : BotDecision {policyAction(*bot), SolverRelease};
+    applyPolicyAction(*bot, decision.action);
+    gameOutput() << '\n'; // formatting
+
+    // random chance to invade another player or bot, picked at random among both (see invasionTarget())
+    if (game.deferBotYears ? invading : rollChance(game.botAggression, 100)) // roll
+    {
+        playerVector towns(players);
+        towns.insert(towns.end(), bots.begin(), bots.end());
+        Player* target = invasionTarget(*bot, towns);
+        if (target) // invade target
+        {
+            bot->invade(target);
+            gameOutput() << '\n'; // formatting
+        }
+    }
+
+    // release grain as decided
+    applyRelease(*bot, decision.release);
+
+    // quick break in program output
+    if (pause) pressEnterToContinue("(Press ENTER to continue)");
+
+    // receive year-end report
+    bot->turnResults();
+
+    // more intelligent AI might be implemented later
+    return true;
+}
+
+#endif // GAMEFLOW_CPP
@@ -0,0 +1,118 @@
+#ifndef GAMEFLOW_HPP
+#define GAMEFLOW_HPP
+
+/// game flow functions called from the main menu (moved out of main.cpp so that other front-ends, like the game host, can run games too)
+/// all program input and output goes through gameInput() and gameOutput() (see helperFunctions.hpp)
+/// every game runs in its own context holding its players, bots, and settings (see gameContext.hpp)
+
+#include <vector>
+#include "player.hpp" // player class
+#include "bot.hpp" // computer-controlled players
+#include "gameContext.hpp" // per-game state
+#include "botPolicy.hpp" // auto-pilot decisions
+
+/// main menu (play, instructions, credits, quit)
+void mainMenu();
+// pre: N/A
+// post: display the main menu and carry out the user's choices until they choose to quit, every game played in a fresh context seeded from the current one
+
+/// function for game setup and object initialization
+void playerSetup(GameContext& game);
+// pre: current context is the game
+// post: get user input for amount of player objects to create, take constructor input for each player object, add them to the game's players
+void botSetup(GameContext& game);
+// pre: current context is the game
+// post: similar above function, adding to the game's bots, ntended for initialization of AI-controlled players with changes to program output, input process, and parameters accordingly
+// all bots in the vector are Bot objects, with the skill level (and thinking time for hard bots) chosen by the user
+
+/// auto-pilot for human players
+struct AutoPilot // a player's town handed over to a policy for some turns (see autoPilotMenu()), kept for the whole game so the last settings can be used again
+{
+    int turnsLeft = 0; // 0 while the player is in control
+    int action = -1; // policy action taken every turn, -1 to follow the policy table like the bots do (see botPolicy.hpp)
+    ReleaseChoice release = SolverRelease;
+    bool used = false; // settings above were picked at least once
+
+    // the town when it got handed over, for the summary at the end
+    int startYear = 0;
+    int startScore = 0;
+    int startGold = 0;
+    int startLand = 0;
+    int startSerfs = 0;
+
+    bool active() const {return turnsLeft > 0;}
+};
+
+/// main game function and ending conditions
+void playGame(GameContext& game);
+// pre: current context is the game, with its human players and automated bots set up
+// post: execute loop involving player turns, bot turns, and in-game events, terminate upon reaching certain end conditions
+void printStandings(GameContext& game);
+// pre: properly set up game
+// post: display stats for every player and bot in the game as a single table in program output
+void catchUpTowns(playerVector towns);
+// pre: properly initialized vector of player object pointers, every town with owed turns is a bot
+// post: play every turn the towns owe (see Player::deferTurn()) a year at a time for all of them together: each bot's decisions (without invasions),
+// then every year-end report with taxes calculated in one batch, grouped by difficulty
+// owed turns past the end of a town's game get dropped
+// owed turns draw their random numbers later and in a different order than turns played as they come, so fast-forwarded games play out differently from the same seed
+bool gameOver(GameContext& game);
+// pre: properly set up game
+// post: individually check each human player to see if the game should end, which occurs if either one has won or all have lost (returning true)
+
+/// main in-game menu comprising all other doable actions
+void gameMenu(GameContext& game, Player* currentPlayer, AutoPilot& autoPilot);
+// pre: properly set up game with a pointer to one of its players (the game gets passed into the invasion function), and the player's auto-pilot
+// post: display in-game menu containing all in-game actions, take user choice and call appropriate associated functions to display sub-menus (below)
+// every visit to a sub-menu that changed the town can be undone and redone until the turn ends, except for invasions (see townHistory.hpp)
+// the turn also ends once the player hands their town over to the auto-pilot
+
+/// individual action menus
+void goodsMenu(Player* player);
+// pre: properly constructed pointer to a player object
+// post: display in-game menu for buying/selling resources, take user choice and call appropriate associated object member functions with input parameters
+void assetMenu(Player* player);
+// pre: properly constructed pointer to a player object
+// post: display in-game menu for buying assets, take user choice and call appropriate associated  object member functions with input parameters
+void taxMenu(Player* player);
+// pre: properly constructed pointer to a player object
+// post: display in-game menu for adjusting taxes, take user choice and call appropriate associated object member functions with input parameters
+bool invasionMenu(GameContext& game, Player* currentPlayer);
+// pre: properly set up game with a pointer to one of its players (everyone else in the game can get invaded)
+// post: display in-game menu containing all other players and bots in the game for the player to choose to invade, take user choice and call invasion member function with choice as parameter
+// return true if the player invaded someone
+void grainRelease(Player* player);
+// pre: properly constructed pointer to a player object
+// post: display in-game menu for releasing grain, take user choice and call grain release member function as necessary
+void previewRelease(Player* player);
+// pre: properly constructed pointer to a player object
+// post: display expected births, deaths, migration, and serf population for a spread of release amounts between the player's minimum and maximum, along with the amount suggested by the release solver
+void previewLine(const ReleaseProjection& projection, int amount, Report& report);
+// pre: projection calculated by Player::projectRelease() for the amount
+// post: add a single line describing the projection to the report
+void advisorPanel(Player* player);
+// pre: properly constructed pointer to a player object
+// post: display the best bundles of goods and asset decisions for the player's town, ranked by projected score at the end of next year (see whatIfAdvisor.hpp)
+
+/// auto-pilot menu and turns
+bool autoPilotMenu(Player* player, AutoPilot& autoPilot);
+// pre: properly constructed pointer to a player object whose game hasn't ended
+// post: display options for handing the town over to the bot policy table or a fixed action for a number of turns, take user choice and set up the auto-pilot accordingly
+// return true if the auto-pilot took over (starting with the current turn)
+void autoTurn(GameContext& game, Player* player, AutoPilot& autoPilot);
+// pre: properly set up game with a pointer to one of its players, auto-pilot active for the player
+// post: play the player's turn with the auto-pilot's action and grain release, without any output or pauses (the same calls the menus make for those choices)
+// once the last turn is done or the player's game has ended, turn the auto-pilot off and display a summary of the turns it played
+void autoPilotSummary(const Player* player, const AutoPilot& autoPilot);
+// pre: properly constructed pointer to a player object, auto-pilot that played some turns for it
+// post: display how the town changed since it got handed over, followed by its current stats
+
+/// simulate bot turns
+bool botActions(GameContext& game, Bot* bot, bool pause = true);
+// pre: properly set up game with a pointer to one of its bots (everyone else in the game can get invaded)
+// post: simulate AI control of player object, with purchases, taxes, and grain release taken from the bot policy table and release solver (or a search within the bot's budget for hard bots), and random invasions as often as the game's bot aggression setting
+// no breaks in output without pause (while every player is on auto-pilot)
+// when the game fast-forwards bots (see GameContext::deferBotYears), a bot that isn't invading anyone this year owes its turn instead of playing it, and false gets returned
+// a bot that does invade gets caught up first, along with every other bot it could pick as a target
+
+#endif // GAMEFLOW_HPP
@@ -0,0 +1,408 @@
+#ifndef GAMEHOST_CPP
+#define GAMEHOST_CPP
+
+#include <iostream>
+#include <streambuf>
+#include <stdexcept>
+#include <cstring>
+#include <random>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "gameHost.hpp"
+#include "gameFlow.hpp" // game setup and turn loop
+#include "gameContext.hpp" // each session's own game
+
+/// session implementation
+
+struct SessionClosed {}; // thrown into a session's game when its connection goes away, not derived from std::exception so the input functions don't catch it
+
+// reads come out of the session's inbox, suspending the session whenever the inbox is empty
+class SessionInput : public std::streambuf
+{
+private:
+    Session& session;
+    std::string buffer; // input currently being read by the game
+protected:
+    int_type underflow() override;
+public:
+    SessionInput(Session& s) : session(s) {}
+};
+
+// writes go into the session's outbox, which gets sent out whenever the session is suspended
+class SessionOutput : public std::streambuf
+{
+private:
+    std::string& outbox;
+protected:
+    int_type overflow(int_type c) override
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) outbox.push_back(traits_type::to_char_type(c));
+        return traits_type::not_eof(c);
+    }
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        outbox.append(s, n);
+        return n;
+    }
+public:
+    SessionOutput(std::string& o) : outbox(o) {}
+};
+
+struct Session
+{
+    int socket; // connection to the players
+    int worker; // index of the worker thread that runs this session
+
+    // saved state of the session's game while it's suspended
+    ucontext_t context;
+    void* stack = nullptr; // mapping that holds the session's stack, starting with its guard page
+    ucontext_t* hostContext = nullptr; // context to return to when suspending (belongs to the worker)
+
+    // input passed in by the polling thread
+    std::mutex lock; // guards inbox, waiting, and closed
+    std::string inbox;
+    bool waiting = false; // session is suspended until more input arrives
+    bool closed = false; // connection has been closed, no more input will arrive
+
+    bool finished = false; // game has ended (only accessed by the worker)
+    std::atomic<bool> done {false}; // finished and all output sent, can be freed by the polling thread
+
+    // output waiting to get sent to the connection
+    std::string outbox;
+
+    // streams the game reads from and writes to
+    SessionInput inputBuffer;
+    SessionOutput outputBuffer;
+    std::istream input;
+    std::ostream output;
+
+    GameContext game; // the session's game on its streams, with its own random numbers and players (made current whenever the session is resumed)
+
+    Session(int s, int w)
+    : socket(s), worker(w), inputBuffer(*this), outputBuffer(outbox), input(&inputBuffer), output(&outputBuffer), game(input, output)
+    {
+        input.exceptions(std::ios::badbit); // lets SessionClosed escape the input functions
+        game.seed(std::random_device()()); // sessions on the same worker don't share random numbers
+    }
+
+    void waitForInput(std::string& buffer);
+    // pre: called from the session's own game
+    // post: move all of the inbox into the buffer, suspending the session until input arrives if there isn't any, throws SessionClosed if the connection is gone
+};
+
+void Session::waitForInput(std::string& buffer)
+{
+    std::unique_lock<std::mutex> guard(lock);
+    while (inbox.empty())
+    {
+        if (closed) throw SessionClosed();
+
+        // suspend until the polling thread has more input for us
+        waiting = true;
+        guard.unlock();
+        swapcontext(&context, hostContext);
+        guard.lock();
+    }
+
+    buffer.swap(inbox);
+    inbox.clear();
+}
+
+SessionInput::int_type SessionInput::underflow()
+{
+    if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+
+    session.waitForInput(buffer); // only returns once there's something to read
+    setg(&buffer[0], &buffer[0], &buffer[0] + buffer.size());
+    return traits_type::to_int_type(buffer[0]);
+}
+
+namespace
+{
+    thread_local Session* currentSession = nullptr; // session being resumed by this thread's worker
+
+    // entry point for every session's game
+    void sessionMain()
+    {
+        Session* session = currentSession;
+
+        try
+        {
+            hostedGame(session->game);
+        }
+        catch (SessionClosed) {} // players left, nothing to report back to
+        catch (std::exception& error)
+        {
+            session->output << "\nThe game has ended because of an error: " << error.what() << '\n';
+        }
+
+        session->finished = true;
+        swapcontext(&session->context, session->hostContext); // never resumed after this
+    }
+
+    const long GUARD_SIZE = sysconf(_SC_PAGESIZE); // one page below every session's stack
+
+    // map a session's stack with a guard page below it (stacks grow down), so a game that runs off the end of its stack crashes the host
+    // instead of quietly writing over whatever got mapped underneath, returns the start of the whole mapping or MAP_FAILED
+    void* mapStack()
+    {
+        void* mapping = mmap(nullptr, GUARD_SIZE + SESSION_STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (mapping != MAP_FAILED && mprotect(mapping, GUARD_SIZE, PROT_NONE) != 0)
+        {
+            munmap(mapping, GUARD_SIZE + SESSION_STACK_SIZE);
+            return MAP_FAILED;
+        }
+        return mapping;
+    }
+
+    void unmapStack(void* mapping)
+    {
+        munmap(mapping, GUARD_SIZE + SESSION_STACK_SIZE);
+    }
+
+    // send everything in a session's outbox out to its connection
+    void sendOutput(Session* session)
+    {
+        size_t sent = 0;
+        while (sent < session->outbox.size())
+        {
+            ssize_t result = send(session->socket, session->outbox.data() + sent, session->outbox.size() - sent, MSG_NOSIGNAL);
+            if (result <= 0) break; // connection gone, remaining output gets dropped
+            sent += result;
+        }
+        session->outbox.clear();
+    }
+}
+
+
+/// host implementation
+
+GameHost::GameHost(std::string path, int numWorkers) : socketPath(path)
+{
+    if (numWorkers < 1) throw std::logic_error("Error: Game host created without any worker threads.");
+
+    // set up listening socket
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) throw std::runtime_error("Socket path is too long.");
+    std::strcpy(address.sun_path, path.c_str());
+
+    listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) throw std::runtime_error("Unable to create socket.");
+    unlink(path.c_str()); // remove socket left over from an earlier run
+    if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(listener, HOST_BACKLOG) < 0)
+    {
+        close(listener);
+        throw std::runtime_error("Unable to listen on " + path + ": " + std::strerror(errno));
+    }
+
+    if (pipe(wakePipe) < 0) throw std::runtime_error("Unable to create wake-up pipe.");
+    fcntl(wakePipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(wakePipe[1], F_SETFL, O_NONBLOCK);
+
+    // start workers
+    for (int i = 0; i < numWorkers; ++i)
+    {
+        Worker* worker = new Worker;
+        worker->thread = std::thread(&GameHost::workerLoop, this, worker);
+        workers.push_back(worker);
+    }
+}
+
+GameHost::~GameHost()
+{
+    // stop workers, sessions that are still suspended are abandoned along with their games
+    stopping = true;
+    for (Worker* w : workers)
+    {
+        {
+            std::lock_guard<std::mutex> guard(w->lock);
+        }
+        w->wake.notify_one();
+        w->thread.join();
+        delete w;
+    }
+
+    for (Session* s : sessions)
+    {
+        close(s->socket);
+        unmapStack(s->stack);
+        delete s;
+    }
+
+    close(listener);
+    close(wakePipe[0]);
+    close(wakePipe[1]);
+    unlink(socketPath.c_str());
+}
+
+void GameHost::workerLoop(Worker* worker)
+{
+    do
+    {
+        // wait for a session to resume
+        Session* session;
+        {
+            std::unique_lock<std::mutex> guard(worker->lock);
+            worker->wake.wait(guard, [&] {return stopping || !worker->queue.empty();});
+            if (stopping) return;
+
+            session = worker->queue.front();
+            worker->queue.pop_front();
+        }
+
+        // run the session until it needs more input or its game ends
+        currentSession = session;
+        session->hostContext = &worker->context;
+        useContext(session->game);
+        swapcontext(&worker->context, &session->context);
+
+        // pass on everything it printed in the meantime
+        sendOutput(session);
+
+        if (session->finished)
+        {
+            // hand it back to the polling thread to get freed
+            session->done = true;
+            char signal = 0;
+            write(wakePipe[1], &signal, 1);
+        }
+    } while (true);
+}
+
+void GameHost::schedule(Session* session)
+{
+    Worker* worker = workers[session->worker];
+    {
+        std::lock_guard<std::mutex> guard(worker->lock);
+        worker->queue.push_back(session);
+    }
+    worker->wake.notify_one();
+}
+
+void GameHost::acceptSession()
+{
+    int connection = accept(listener, nullptr, nullptr);
+    if (connection < 0) return; // connection gave up before being accepted
+
+    Session* session = new Session(connection, sessionsStarted++ % workers.size());
+
+    // give the session its own stack and point it at the game
+    session->stack = mapStack();
+    if (session->stack == MAP_FAILED)
+    {
+        close(connection);
+        delete session;
+        return;
+    }
+    getcontext(&session->context);
+    session->context.uc_stack.ss_sp = static_cast<char*>(session->stack) + GUARD_SIZE; // stack starts above the guard page
+    session->context.uc_stack.ss_size = SESSION_STACK_SIZE;
+    session->context.uc_link = nullptr;
+    makecontext(&session->context, sessionMain, 0);
+
+    sessions.push_back(session);
+    schedule(session); // game starts right away with the setup prompts
+}
+
+void GameHost::readSession(Session* session)
+{
+    char buffer[SESSION_READ_SIZE];
+    ssize_t received = recv(session->socket, buffer, sizeof(buffer), MSG_DONTWAIT);
+    if (received < 0 && (errno == EAGAIN || errno == EINTR)) return; // nothing to read after all
+
+    std::lock_guard<std::mutex> guard(session->lock);
+    if (received > 0) session->inbox.append(buffer, received);
+    else session->closed = true; // connection closed (or failed), game gets ended the next time it reads
+
+    // wake up session if it was waiting on this
+    if (session->waiting)
+    {
+        session->waiting = false;
+        schedule(session);
+    }
+}
+
+void GameHost::reapSessions()
+{
+    for (size_t i = 0; i < sessions.size();)
+    {
+        Session* session = sessions[i];
+        if (session->done)
+        {
+            close(session->socket);
+            unmapStack(session->stack);
+            delete session;
+            sessions[i] = sessions.back(); // order doesn't matter
+            sessions.pop_back();
+        }
+        else ++i;
+    }
+}
+
+void GameHost::run()
+{
+    std::vector<pollfd> polled; // reused between iterations
+    std::vector<Session*> polledSessions; // session for each polled connection
+
+    while (!stopping)
+    {
+        // poll the listening socket, the wake-up pipe, and every connection that can still send input
+        polled.clear();
+        polledSessions.clear();
+        polled.push_back({listener, POLLIN, 0});
+        polled.push_back({wakePipe[0], POLLIN, 0});
+        for (Session* s : sessions)
+        {
+            std::lock_guard<std::mutex> guard(s->lock);
+            if (s->closed) continue;
+            polled.push_back({s->socket, POLLIN, 0});
+            polledSessions.push_back(s);
+        }
+
+        if (poll(polled.data(), polled.size(), -1) < 0)
+        {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("Polling failed: ") + std::strerror(errno));
+        }
+
+        // handle whatever happened (input first, since the other two change the session list)
+        for (size_t i = 2; i < polled.size(); ++i)
+        {
+            if (polled[i].revents) readSession(polledSessions[i - 2]);
+        }
+        if (polled[1].revents)
+        {
+            char drain[64];
+            while (read(wakePipe[0], drain, sizeof(drain)) > 0);
+            reapSessions();
+        }
+        if (polled[0].revents & POLLIN) acceptSession();
+    }
+}
+
+void GameHost::stop()
+{
+    stopping = true;
+    char signal = 0;
+    write(wakePipe[1], &signal, 1);
+}
+
+
+/// hosted game flow
+
+void hostedGame(GameContext& game)
+{
+    gameOutput() << "\nWelcome to Santa Paravia and Fiumancco\n";
+    playerSetup(game); // same as the play option from the main menu, except players get set up before bots
+    botSetup(game);
+    playGame(game);
+    gameOutput() << "Game ended. Thanks for playing!\n";
+}
+
+#endif // GAMEHOST_CPP
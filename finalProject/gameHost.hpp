@@ -0,0 +1,102 @@
+#ifndef GAMEHOST_HPP
+#define GAMEHOST_HPP
+
+/*
+Game host details
+    - Serves many games of Santa Paravia at once from a single long-running process
+        - Players connect over a Unix domain socket, each connection gets its own game (a session)
+        - Each session runs the normal game flow functions (see gameFlow.hpp) with its input and output redirected to the connection
+    - Sessions run as tasks on a fixed pool of worker threads
+        - A session is suspended whenever it runs out of input, freeing its worker for other sessions
+        - Suspended sessions only hold on to their saved stack and their game objects, so idle sessions stay cheap
+        - Every stack has an inaccessible guard page below it, so a session that overflows its stack crashes the host instead of corrupting memory
+        - Each session is assigned to the same worker for its whole lifetime (sessions are spread evenly over the workers)
+    - A single polling thread accepts connections and reads player input, waking up sessions as their input arrives
+*/
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <ucontext.h>
+
+namespace /// constant parameters for the game host
+{
+    const int SESSION_STACK_SIZE = 256 * 1024; // address space reserved for each session's stack, not counting its guard page (memory only gets used as the stack grows)
+    const int SESSION_READ_SIZE = 4096; // maximum amount of input read from a connection at a time
+    const int HOST_BACKLOG = 64; // amount of connections that can be waiting to get accepted
+}
+
+struct Session; // a single game and its connection (defined in implementation file)
+struct GameContext; // see gameContext.hpp
+
+class GameHost
+{
+private:
+    struct Worker // thread that runs sessions as their input becomes available
+    {
+        std::thread thread;
+        std::mutex lock; // guards the queue
+        std::condition_variable wake;
+        std::deque<Session*> queue; // sessions that are ready to be resumed
+        ucontext_t context; // where suspended sessions return to
+    };
+
+    std::string socketPath;
+    int listener = -1; // listening socket
+    int wakePipe[2] = {-1, -1}; // used to wake up the polling thread from the workers or from stop()
+
+    std::vector<Worker*> workers;
+    std::vector<Session*> sessions; // only accessed by the polling thread
+    int sessionsStarted = 0; // used to spread sessions across workers
+
+    std::atomic<bool> stopping {false};
+
+    void workerLoop(Worker* worker);
+    // pre: worker is a member of this host
+    // post: resume queued sessions until the host is stopped, sending their output back to their connections
+
+    void schedule(Session* session);
+    // pre: session is suspended or hasn't been started yet
+    // post: add session to the queue of its worker so it gets resumed
+
+    void acceptSession();
+    // pre: listening socket has a pending connection
+    // post: create a new session for the connection and schedule it to start its game
+
+    void readSession(Session* session);
+    // pre: session's connection has input available or has been closed
+    // post: pass the input to the session, waking it up if it was waiting for input
+
+    void reapSessions();
+    // pre: called from the polling thread
+    // post: close and free all sessions whose games have ended
+
+public:
+    GameHost(std::string path, int numWorkers);
+    // pre: valid path for the socket file, numWorkers greater than 0
+    // post: create listening socket at path and start worker threads, throws std::runtime_error if the socket can't be created
+
+    ~GameHost();
+    // post: stop workers, close all connections and remove the socket file
+
+    GameHost(const GameHost&) = delete;
+    GameHost& operator=(const GameHost&) = delete;
+
+    void run();
+    // pre: host constructed
+    // post: accept connections and serve games until stop() is called
+
+    void stop();
+    // pre: N/A (safe to call from a signal handler)
+    // post: makes run() return
+};
+
+void hostedGame(GameContext& game);
+// pre: the session's game is the current context, on the session's connection
+// post: play through a full game with the players on the connection (same as the play option in the main menu)
+
+#endif // GAMEHOST_HPP
@@ -3,19 +3,22 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <climits>
+#include <cctype>
 #include <string>
 #include "helperFunctions.hpp"
+#include "gameContext.hpp" // current game
+
+// random numbers, streams, and output all come from the game running on this thread (see gameContext.hpp)
 
 int random(int minVal, int maxVal)
 {
-    if (minVal > maxVal) throw std::logic_error("Function random() called with min parameter greater than max parameter."); // enforce precondition
-
-    // current method (may be changed later)
-    int result;
-    do {result = (rand() % (maxVal + 1));} // get a random number lower than the max using the default rand function
-    while (result < minVal); // repeat until random value greater than min
+    return currentContext().random(minVal, maxVal);
+}
 
-    return result; // return
+void seedRandom(unsigned int seed)
+{
+    currentContext().seed(seed);
 }
 
 int random(int maxVal)
@@ -49,19 +52,25 @@ float percent(int p)
     return static_cast<float>(p / 100.0); // return decimal
 }
 
+std::string capitalize(std::string text)
+{
+    if (!text.empty()) text[0] = toupper(text[0]);
+    return text;
+}
+
 void pressEnterToContinue()
 {
     std::string s;
-    getline(std::cin, s); // initialize a string and call getline on it, leaving the function once the user presses the ENTER key
-    std::cout << '\n';
+    getline(gameInput(), s); // initialize a string and call getline on it, leaving the function once the user presses the ENTER key
+    gameOutput() << '\n';
 }
 
 void pressEnterToContinue(std::string prompt)
 {
-    std::cout << prompt; // same as above except it displays a prompt first
+    gameOutput() << prompt; // same as above except it displays a prompt first
     std::string s;
-    getline(std::cin, s);
-    std::cout << '\n;'
+    getline(gameInput(), s);
+    gameOutput() << '\n';
 }
 
 int intInput(std::string prompt, int minVal, int maxVal)
@@ -75,22 +84,22 @@ int intInput(std::string prompt, int minVal, int maxVal)
         try
         {
             // std::cin.clear();
-            std::cout << prompt; // display prompt for input
-            std::cin >> input; // take input
+            gameOutput() << prompt; // display prompt for input
+            gameInput() >> input; // take input
 
             // check if input isn't valid, throw execptions accordingly
             if (input < minVal) throw std::runtime_error("Entered value too low. Please try again.");
             if (input > maxVal) throw std::runtime_error("Entered value too high. Please try again.");
-            if (std::cin.fail()) throw std::runtime_error("Please enter a valid integer value.");
+            if (gameInput().fail()) throw std::runtime_error("Please enter a valid integer value.");
 
             // if input makes it past execption checks, return valid value
             return input;
         }
         catch (std::runtime_error inputError) // for invalid input:
         {
-            std::cerr << inputError.what() << '\n'; // display error message
-            std::cin.clear(); // clear input buffer to prepare for second attempt to get valid input
-            std::cin.ignore(INT_MAX, '\n');
+            *currentContext().errors << inputError.what() << '\n'; // display error message
+            gameInput().clear(); // clear input buffer to prepare for second attempt to get valid input
+            gameInput().ignore(INT_MAX, '\n');
         }
     } while (true); // if input was valid, function should've returned by this point. repeat input process until valid value read
 }
@@ -105,9 +114,9 @@ std::string strInput(std::string prompt, int minLen, int maxLen)
         try
         {
             //std::cin.clear();
-            std::cout << prompt; // display prompt for input
+            gameOutput() << prompt; // display prompt for input
              //std::cin.ignore('\n');
-            getline(std::cin, input); // take input
+            getline(gameInput(), input); // take input
 
             // check if input isn't valid, throw execptions accordingly
             if (input.length() < minLen) throw std::runtime_error("Too short. Please try again.");
@@ -118,9 +127,9 @@ std::string strInput(std::string prompt, int minLen, int maxLen)
         }
         catch (std::runtime_error inputError) // for invalid input:
         {
-            std::cerr << inputError.what() << '\n'; // display error message
-            std::cin.clear(); // clear input buffer to prepare for second attempt to get valid input
-            std::cin.ignore(INT_MAX, '\n');
+            *currentContext().errors << inputError.what() << '\n'; // display error message
+            gameInput().clear(); // clear input buffer to prepare for second attempt to get valid input
+            gameInput().ignore(INT_MAX, '\n');
         }
     } while (true); // if input was valid, function should've returned by this point. repeat input process until valid value read
 }
@@ -132,8 +141,8 @@ bool ynInput(std::string prompt, char yes, char no)
     {
         try
         {
-            std::cout << prompt; // display prompt for input
-            std::cin >> input; // take input
+            gameOutput() << prompt; // display prompt for input
+            gameInput() >> input; // take input
 
             // see if input is one of two valid responses
             if (tolower(input) == tolower(yes)) return true; // return accordingly
@@ -144,11 +153,26 @@ bool ynInput(std::string prompt, char yes, char no)
         }
         catch (std::runtime_error inputError) // for invalid input:
         {
-            std::cerr << inputError.what() << '\n'; // display error message
-            std::cin.clear(); // clear input buffer to prepare for second attempt to get valid input
-            std::cin.ignore(INT_MAX, '\n');
+            *currentContext().errors << inputError.what() << '\n'; // display error message
+            gameInput().clear(); // clear input buffer to prepare for second attempt to get valid input
+            gameInput().ignore(INT_MAX, '\n');
         }
     } while (true); // if input was valid, function should've returned by this point. repeat input process until valid value read
 }
 
+std::istream& gameInput()
+{
+    return *currentContext().input;
+}
+
+std::ostream& gameOutput()
+{
+    return *currentContext().output;
+}
+
+void setGameStreams(std::istream& in, std::ostream& out)
+{
+    currentContext().setStreams(in, out);
+}
+
 #endif // HELPERFUNCTIONS_CPP
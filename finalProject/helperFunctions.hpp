@@ -2,6 +2,7 @@
 #define HELPERFUNCTIONS_HPP
 
 #include <string>
+#include <iosfwd>
 
 /// non-gameplay-related functions utilised by the rest of the program to help with low-level tasks
 
@@ -13,6 +14,10 @@ int random(int maxVal);
 // pre: valid int value greater than or equal to 0 for maxVal
 // post: return random integer between 0 and maxVal
 
+void seedRandom(unsigned int seed);
+// pre: N/A
+// post: restart the current game's random numbers from the seed (see GameContext, every thread's default context starts from the same default seed)
+
 bool rollChance(int num, int denom);
 // pre: valid int values greater than or equal to 1 or num and denom, denom is greater than or equal to num
 // post: randomly return true at the odds of denom:num, returning false otherwise (random chance)
@@ -25,6 +30,10 @@ float percent(int p);
 // pre: valid int value greater than 0
 // post: returns int as a decimal percentage
 
+std::string capitalize(std::string text);
+// pre: N/A
+// post: return the text with its first letter in upper case (for names from the asset registry at the start of a label)
+
 void pressEnterToContinue(std::string prompt);
 // pre: valid string parameter
 // post: displays prompt, pauses program until user presses ENTER
@@ -45,4 +54,19 @@ bool ynInput(std::string prompt, char yes, char no);
 // pre: valid string for prompt, valid char values for yes and no
 // post: display prompt, take and validate char input until reading input equal to yes or no parameter, return true if yes, false if no
 
+/// streams that all game input and output goes through (std::cin and std::cout unless redirected)
+/// kept per game (see GameContext) so that the game host can run a separate game on each of its sessions
+
+std::istream& gameInput();
+// pre: N/A
+// post: return the input stream of the game running on the current thread
+
+std::ostream& gameOutput();
+// pre: N/A
+// post: return the output stream of the game running on the current thread
+
+void setGameStreams(std::istream& in, std::ostream& out);
+// pre: valid stream objects that outlive their usage by the game
+// post: redirect gameInput() and gameOutput() (and input errors) to the given streams for the game running on the current thread
+
 #endif // HELPERFUNCTIONS_HPP
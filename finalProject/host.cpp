@@ -0,0 +1,56 @@
+/*
+Purpose: Host many games of Santa Paravia at once over a local socket (see gameHost.hpp)
+Usage: paraviaHost [socket path] [worker threads] [metrics file]
+    - Connect to a running host with any Unix socket client (e.g. "nc -U paravia.sock") to start a game
+    - Given a metrics file, statistics on every game's towns get exported to it in the Prometheus text format while the host runs (see telemetry.hpp)
+*/
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <memory>
+#include <csignal>
+#include "gameHost.hpp"
+#include "telemetry.hpp"
+
+namespace
+{
+    GameHost* host = nullptr; // for the signal handler
+
+    void stopHost(int)
+    {
+        if (host) host->stop();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // take settings from command line, defaulting to one worker per core
+    std::string path = argc > 1 ? argv[1] : "paravia.sock";
+    int numWorkers = argc > 2 ? std::stoi(argv[2]) : std::thread::hardware_concurrency();
+    std::string metricsPath = argc > 3 ? argv[3] : "";
+    if (numWorkers < 1) numWorkers = 1;
+
+    try
+    {
+        std::unique_ptr<MetricsExporter> exporter;
+        if (!metricsPath.empty()) exporter.reset(new MetricsExporter(metricsPath));
+
+        GameHost gameHost(path, numWorkers);
+        host = &gameHost;
+        std::signal(SIGINT, stopHost); // shut down cleanly on Ctrl+C
+        std::signal(SIGTERM, stopHost);
+
+        std::cout << "Hosting games on " << path << " with " << numWorkers << " worker threads.\n";
+        gameHost.run();
+        host = nullptr;
+    }
+    catch (std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+
+    std::cout << "Host stopped.\n";
+    return 0;
+}
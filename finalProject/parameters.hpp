@@ -68,6 +68,17 @@ namespace /// all constant values affecting in-game behavior, balance, and mecha
     const int8 NOBLE_INCOME = 250;
     const int8 ASSET_INCOME = 20;
 
+    // the same values as a matrix (one row per tax, one column per taxable group) so all taxes can be calculated in one pass
+    // a new tax category only needs a new row here
+    enum TaxCategory {SalesTax, IncomeTax, CustomsTax}; // row indexes
+    const int8 NUM_TAXES = 3;
+    enum TaxBase {MerchantBase, ClergyBase, NobleBase, AssetBase}; // column indexes
+    const int8 NUM_TAX_BASES = 4;
+    const int16 TAX_WEIGHTS[NUM_TAXES][NUM_TAX_BASES] =
+    {{MERCHANT_SALES, CLERGY_SALES, NOBLE_SALES, ASSET_SALES},
+    {MERCHANT_INCOME, CLERGY_INCOME, NOBLE_INCOME, ASSET_INCOME},
+    {MERCHANT_CUSTOMS, CLERGY_CUSTOMS, NOBLE_CUSTOMS, ASSET_CUSTOMS}};
+
     // asset prices
     const int16 MARKET_PRICE = 1000;
     const int16 MILL_PRICE = 2000;
@@ -112,19 +123,42 @@ namespace /// all constant values affecting in-game behavior, balance, and mecha
     const int8 MIN_GRAIN_LOSS = 20;
     const int8 MAX_GRAIN_LOSS = 40; // randomly chosen between these two values in-game
 
+    // world events, every event type's behavior in one row (indexed by WorldEventType, see the event scheduler)
+    const int8 NUM_WORLD_EVENTS = 6;
+    struct WorldEventSpec
+    {
+        const char* name; // displayed name
+        int8 chance; // percent chance each year of the event getting scheduled for a town (0 for events that only follow others)
+                     // at most one event gets scheduled per year, so all of the chances together can't go over 100
+        int8 minDelay; // years ahead it gets scheduled for, randomly decided between two limits
+        int8 maxDelay;
+        int16 minMagnitude; // how bad (or good) it is, randomly decided between two limits (meaning depends on the event, see below)
+        int16 maxMagnitude;
+    };
+    const WorldEventSpec WORLD_EVENTS[NUM_WORLD_EVENTS] =
+    {{"plague", 3, 1, 5, 5, 25}, // percent of the population killed (half as much for taxpayers)
+    {"fire", 4, 1, 3, 10, 50}, // percent of grain and of one type of building destroyed
+    {"festival", 5, 1, 3, 5, 15}, // percent of the treasury spent, brings immigrants the year after
+    {"harvest failure", 4, 1, 3, 20, 60}, // percent of that year's harvest lost
+    {"raid", 3, 1, 4, 20, 200}, // bandits, fought off by soldiers or paid off in gold
+    {"immigration", 0, 1, 1, 0, 0}}; // merchants moving in, magnitude set by the festival
+    const int8 RAID_LOOT = 20; // gold taken per bandit the army can't stop
+    const int8 FESTIVAL_GUEST_COST = 50; // gold spent on a festival for each merchant it draws in
+
     // bankruptcy parameters
     const int16 BANKRUPTCY_LIMIT = -10000; // minimum amount of gold allowed before bankruptcy is declared
     const int16 BANKRUPTCY_BENEFITS = 100; // amount of gold the player's treausy gets set to following bankruptcy
 
-    // invasion parameters (soon to be implemented)
-
+    // invasion parameters
+    const int8 MIN_CASUALTY_RATE = 10; // each side of an invasion loses between these two percentages of the other side's army
+    const int8 MAX_CASUALTY_RATE = 30;
 
     /// meta-game parameters (player-end)
 
     // difficulty system parameters
     const int8 MIN_DIFFICULTY = 1;
     const int8 MAX_DIFFICULTY = 4;
-    const float DIFF_MODIFIERS[MAX_DIFFICULTY] =
+    constexpr float DIFF_MODIFIERS[MAX_DIFFICULTY] =
     {0.8, 1.0, 1.2, 1.5}; // values by which in-game stats are modified on each difficulty level
 
     // death system parameters
@@ -165,6 +199,30 @@ namespace /// all constant values affecting in-game behavior, balance, and mecha
     const int16 CATHEDRAL_VALUE = CATHEDRAL_PRICE;
     const int16 PALACE_VALUE = PALACE_PRICE;
 
+    // asset registry, every asset type's behavior in one row
+    // a new type needs a new row and a new AssetType, every list of assets in the game comes from these, except for the C interface's stats (see paraviaEngine.h)
+    // it also adds a bot policy action, so the policy table has to be rebuilt (see policyBuilder.cpp)
+    enum AssetType {MarketAsset, MillAsset, CathedralAsset, PalaceAsset}; // row indexes, also the order assets go through the year-end census in
+    const int8 NUM_ASSETS = 4;
+    struct AssetSpec
+    {
+        const char* name; // displayed names, singular and plural
+        const char* plural;
+        int16 price; // base purchase price
+        int16 minRevenue; // yearly revenue per building, randomly decided between two limits (both 0 for no revenue)
+        int16 maxRevenue;
+        int8 merchantsAttracted; // maximum people brought to the town per building per year (can be 0)
+        int8 clergyAttracted;
+        int8 noblesAttracted;
+        int16 value; // score per building
+        const char* description; // what it does, for the asset menu's help
+    };
+    const AssetSpec ASSETS[NUM_ASSETS] =
+    {{"market", "markets", MARKET_PRICE, MIN_MARKET_REVENUE, MAX_MARKET_REVENUE, MARKET_MERCHANTS, 0, 0, MARKET_VALUE, "create a small amount of yearly revenue and can bring merchants to the town"}, // markets bring merchants to the town and generate revenue
+    {"mill", "mills", MILL_PRICE, MIN_MILL_REVENUE, MAX_MILL_REVENUE, 0, 0, 0, MILL_VALUE, "create a moderate amount of yearly revenue"}, // mills don't bring in new people but generate revenue
+    {"cathedral", "cathedrals", CATHEDRAL_PRICE, 0, 0, 0, CATHEDRAL_CLERGY, 0, CATHEDRAL_VALUE, "can bring clergy to the town"}, // cathedrals bring clergy to the town
+    {"palace", "palaces", PALACE_PRICE, 0, 0, 0, 0, PALACE_NOBLES, PALACE_VALUE, "can bring nobles to the town"}}; // palaces bring nobles to the town
+
 
     /// meta-game parameters (game-end)
 
@@ -181,10 +239,28 @@ namespace /// all constant values affecting in-game behavior, balance, and mecha
     "Mozzarella", "Proscuitto", "Rotini", "Alfredo", "Pesto"};
 
     // bot behavior
+    const bool DEFER_BOT_YEARS = false; // default for fast-forwarding bots: bots that don't invade anyone owe their turns until something looks at their towns, then play them all together (turned on with "--fast-forward-bots")
     const int8 BOT_AGGRESSION = 20; // percent chance of a bot invading another player in the game during a turn
     const int8 BOT_FRUGALITY = 40; // percent chance of a bot to not buy an item that they can afford during a purchase attempt
     const int8 BOT_PURCHASES = 3; // amount of attempt a bot will make to call the buy function for each asset
 
+    // what-if advisor (see whatIfAdvisor.hpp)
+    const int8 ADVISOR_SUGGESTIONS = 5; // bundles of decisions shown in the advisor panel
+    const int8 ADVISOR_SAMPLES = 4; // years every bundle gets played out over, averaged together
+
+    // bot search (see botSearch.hpp)
+    const int8 MAX_SEARCH_DEPTH = 8; // most turns hard bots look ahead, however much time they have
+    const int16 BOT_THINKING_TIME = 250; // default time hard bots get for each turn (milliseconds)
+    const int16 MAX_THINKING_TIME = 30000; // most time that can be given to hard bots during setup (milliseconds)
+    const int8 BOT_SEARCH_THREADS = 4; // threads each hard bot's search gets in a game (bots take their turns one at a time, so this is all the searching going on)
+    const int8 SEARCH_SAMPLES = 3; // random outcomes played out for each move
+    const int8 TRANSPOSITION_BITS = 16; // transposition table holds 2^16 towns (16 bytes each)
+
+    // tournament statistics (see quantileSketch.hpp)
+    const int16 SKETCH_SIZE = 200; // values kept in a quantile sketch's bottom level, percentiles are within about 1/SKETCH_SIZE (0.5%) of their true rank
+    const int8 TOURNAMENT_TOWNS = 4; // bots in each tournament game
+    const int16 TOURNAMENT_SEARCH_NODES = 200; // default node budget for searching bots in tournaments (keeps decisions the same on any machine)
+
     // purchase limits
     const int16 SOLDIER_PURCHASE_LIMIT = 100; // highest amount of a commodity one can buy in a single action
     const int16 GRAIN_PURCHASE_LIMIT = 5000;
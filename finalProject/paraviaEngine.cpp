@@ -0,0 +1,188 @@
+#ifndef PARAVIAENGINE_CPP
+#define PARAVIAENGINE_CPP
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include "paraviaEngine.h"
+#include "player.hpp"
+#include "botPolicy.hpp" // actions and grain releases
+#include "gameContext.hpp"
+
+static_assert(PARAVIA_NUM_ACTIONS == NUM_POLICY_ACTIONS, "Engine interface action count doesn't match the bot policy.");
+static_assert(PARAVIA_SALES_TAX - PARAVIA_MARKETS == NUM_ASSETS, "Engine interface asset stats don't match the asset registry.");
+
+struct ParaviaWorld
+{
+    std::istringstream noInput; // anything asking for input fails instead of waiting forever
+    std::ostream muted; // reports go nowhere
+    GameContext game; // the world's towns, random numbers, and output
+    std::vector<bool> broken; // towns that outgrew the game's formulas while stepping, frozen as they were and treated as ended from then on
+    std::string error; // last failure
+
+    ParaviaWorld() : muted(nullptr), game(noInput, muted)
+    {
+        noInput.exceptions(std::ios::eofbit);
+    }
+};
+
+namespace
+{
+    thread_local std::string creationError; // why the last world on this thread couldn't be made
+
+    // run a call on the world's game, turning anything thrown into an error code
+    template <typename Body>
+    int guarded(ParaviaWorld* world, Body body)
+    {
+        try
+        {
+            ContextScope scope(world->game);
+            body();
+            world->error.clear();
+            return 0;
+        }
+        catch (std::exception& failure)
+        {
+            world->error = failure.what();
+            return -1;
+        }
+    }
+
+    void checkRange(const ParaviaWorld* world, int first, int count)
+    {
+        if (first < 0 || count < 0 || first + count > paraviaTownCount(world))
+            throw std::logic_error("Error: Engine call made for towns outside of the world.");
+    }
+
+    bool stillPlaying(const ParaviaWorld* world, int town)
+    {
+        return !world->broken[town] && !world->game.players[town]->gameEnded();
+    }
+}
+
+ParaviaWorld* paraviaCreateWorld(int numTowns, const int* difficulties, unsigned int seed)
+{
+    ParaviaWorld* world = nullptr;
+    try
+    {
+        if (numTowns < 1) throw std::logic_error("Error: Creating a world without any towns.");
+
+        world = new ParaviaWorld;
+        world->game.seed(seed);
+        ContextScope scope(world->game);
+        world->game.players.reserve(numTowns);
+        for (int i = 0; i < numTowns; ++i)
+        {
+            int difficulty = difficulties ? difficulties[i] : 2;
+            if (difficulty < MIN_DIFFICULTY || difficulty > MAX_DIFFICULTY) throw std::logic_error("Error: Creating a town with an invalid difficulty.");
+            world->game.players.push_back(new Player(world->game, "Ruler", "Town " + std::to_string(i + 1), difficulty)); // deleted along with the game
+        }
+        world->broken.assign(numTowns, false);
+        creationError.clear();
+        return world;
+    }
+    catch (std::exception& failure)
+    {
+        delete world;
+        creationError = failure.what();
+        return nullptr;
+    }
+}
+
+void paraviaDestroyWorld(ParaviaWorld* world)
+{
+    delete world;
+}
+
+int paraviaTownCount(const ParaviaWorld* world)
+{
+    return world->game.players.size();
+}
+
+int paraviaApplyActions(ParaviaWorld* world, int first, int count, const int* actions)
+{
+    return guarded(world, [&]
+    {
+        checkRange(world, first, count);
+        for (int i = 0; i < count; ++i)
+        {
+            if (actions[i] != PARAVIA_NO_ACTION && stillPlaying(world, first + i)) applyPolicyAction(*world->game.players[first + i], actions[i]);
+        }
+    });
+}
+
+int paraviaStep(ParaviaWorld* world, int first, int count, int years, int mode)
+{
+    return guarded(world, [&]
+    {
+        checkRange(world, first, count);
+        if (years < 0) throw std::logic_error("Error: Stepping a world a negative amount of years.");
+        if (mode != PARAVIA_HOLD && mode != PARAVIA_POLICY) throw std::logic_error("Error: Stepping a world with an invalid mode.");
+
+        // a town that outgrows the game's formulas stops there, the rest of the range still plays every year (anything else thrown is a bug and fails the call right away)
+        int firstBroken = -1, numBroken = 0;
+        std::string reason;
+        for (int year = 0; year < years; ++year)
+            for (int i = first; i < first + count; ++i)
+            {
+                if (!stillPlaying(world, i)) continue;
+                Player& town = *world->game.players[i];
+                try
+                {
+                    if (mode == PARAVIA_POLICY) applyPolicyAction(town, policyAction(town));
+                    applyRelease(town, SolverRelease);
+                    town.turnResults();
+                }
+                catch (FormulaOverflow& failure)
+                {
+                    world->broken[i] = true;
+                    if (numBroken++ == 0)
+                    {
+                        firstBroken = i;
+                        reason = failure.what();
+                    }
+                }
+            }
+
+        if (numBroken > 0)
+            throw std::runtime_error("Error: Town " + std::to_string(firstBroken) + " broke while stepping (" + reason + ")"
+                                     + (numBroken > 1 ? ", along with " + std::to_string(numBroken - 1) + " more" : "") + ".");
+    });
+}
+
+int paraviaReadStats(const ParaviaWorld* world, int first, int count, int* stats)
+{
+    return guarded(const_cast<ParaviaWorld*>(world), [&] // only the error message gets changed
+    {
+        checkRange(world, first, count);
+        for (int i = 0; i < count; ++i)
+        {
+            const Player& town = *world->game.players[first + i];
+            int* row = stats + i * PARAVIA_NUM_STATS;
+            row[PARAVIA_GOLD] = town.getGold();
+            row[PARAVIA_GRAIN] = town.getGrain();
+            row[PARAVIA_LAND] = town.getLand();
+            row[PARAVIA_SERFS] = town.getSerfs();
+            row[PARAVIA_MERCHANTS] = town.getMerchants();
+            row[PARAVIA_CLERGY] = town.getClergy();
+            row[PARAVIA_NOBLES] = town.getNobles();
+            row[PARAVIA_SOLDIERS] = town.getSoldiers();
+            for (int type = 0; type < NUM_ASSETS; ++type) row[PARAVIA_MARKETS + type] = town.getAssets(static_cast<AssetType>(type));
+            row[PARAVIA_SALES_TAX] = town.getSales();
+            row[PARAVIA_INCOME_TAX] = town.getIncome();
+            row[PARAVIA_CUSTOMS_TAX] = town.getCustoms();
+            row[PARAVIA_YEAR] = town.getYear();
+            row[PARAVIA_RANK] = town.getRank();
+            row[PARAVIA_SCORE] = town.getScore();
+            row[PARAVIA_ENDED] = world->broken[first + i] ? 2 : town.gameEnded();
+        }
+    });
+}
+
+const char* paraviaLastError(const ParaviaWorld* world)
+{
+    return world ? world->error.c_str() : creationError.c_str();
+}
+
+#endif // PARAVIAENGINE_CPP
@@ -0,0 +1,79 @@
+#ifndef PARAVIAENGINE_H
+#define PARAVIAENGINE_H
+
+/*
+Engine library details
+    - The game's rules (towns, year-end reports, bot policy, world events) without any menus, for other programs to drive through a plain C interface
+        - Built as the paraviaEngine library (static and shared, see CMakeLists.txt), callable from C, C++, or anything with a C foreign function interface
+    - A world is a group of towns in one game of their own (own random numbers, own output that goes nowhere), so worlds never affect each other
+        - Calls on different worlds can run on different threads at the same time, calls on the same world can't
+    - Everything works on ranges of towns at once: apply actions to towns [first, first + count), step them some number of years, read their stats into a caller's buffer
+        - One call can cover millions of town-years, with no per-town calls or allocations on the caller's side
+    - Functions that can fail return 0 on success and -1 on failure, with paraviaLastError() saying what went wrong (nothing gets thrown across the interface)
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ParaviaWorld ParaviaWorld; /* opaque */
+
+/* towns' stats, in the order paraviaReadStats() writes them */
+/* asset counts are in asset registry order (see ASSETS in parameters.hpp), a new asset type needs its own stat here (the engine won't build until it has one) */
+enum ParaviaStat
+{
+    PARAVIA_GOLD, PARAVIA_GRAIN, PARAVIA_LAND,
+    PARAVIA_SERFS, PARAVIA_MERCHANTS, PARAVIA_CLERGY, PARAVIA_NOBLES, PARAVIA_SOLDIERS,
+    PARAVIA_MARKETS, PARAVIA_MILLS, PARAVIA_CATHEDRALS, PARAVIA_PALACES,
+    PARAVIA_SALES_TAX, PARAVIA_INCOME_TAX, PARAVIA_CUSTOMS_TAX,
+    PARAVIA_YEAR, PARAVIA_RANK, PARAVIA_SCORE,
+    PARAVIA_ENDED, /* 1 once the town's game has ended (won or died), 2 if it broke while stepping (see paraviaStep()), 0 otherwise */
+    PARAVIA_NUM_STATS
+};
+
+/* what towns decide on their own while stepping */
+enum ParaviaStepMode
+{
+    PARAVIA_HOLD, /* no decisions besides releasing grain (actions come from paraviaApplyActions() between steps) */
+    PARAVIA_POLICY /* every year starts with the bot policy table's action for the town (see botPolicy.hpp) */
+};
+
+#define PARAVIA_NUM_ACTIONS 30 /* bot policy actions, see applyPolicyAction() in botPolicy.hpp */
+#define PARAVIA_NO_ACTION (-1) /* leaves a town as it is in paraviaApplyActions() */
+
+ParaviaWorld* paraviaCreateWorld(int numTowns, const int* difficulties, unsigned int seed);
+/* pre: numTowns above 0, difficulties either NULL (every town on difficulty 2) or numTowns values between 1 and 4 */
+/* post: return a new world of towns at the start of the game, playing out the same way for the same seed (NULL if it couldn't be made) */
+
+void paraviaDestroyWorld(ParaviaWorld* world);
+/* pre: world from paraviaCreateWorld() or NULL */
+/* post: free the world and all of its towns */
+
+int paraviaTownCount(const ParaviaWorld* world);
+/* pre: valid world */
+/* post: return the number of towns in the world */
+
+int paraviaApplyActions(ParaviaWorld* world, int first, int count, const int* actions);
+/* pre: valid world, towns [first, first + count) in the world, count actions between 0 and PARAVIA_NUM_ACTIONS - 1 (or PARAVIA_NO_ACTION) */
+/* post: set each town's tax rates and spend its treasury as the action says (towns whose games have ended or that broke get skipped) */
+
+int paraviaStep(ParaviaWorld* world, int first, int count, int years, int mode);
+/* pre: valid world, towns [first, first + count) in the world, years greater than or equal to 0, mode from ParaviaStepMode */
+/* post: play that many years for every town in the range, year by year, with each town releasing the grain picked by the release solver */
+/* towns stop once their games end, and only take decisions the mode allows */
+/* a town that grows past what the game's formulas can handle stops where it was and counts as ended from then on, with PARAVIA_ENDED at 2 */
+/* the other towns still play every year, then the call fails with paraviaLastError() giving the first broken town's index */
+
+int paraviaReadStats(const ParaviaWorld* world, int first, int count, int* stats);
+/* pre: valid world, towns [first, first + count) in the world, room for count * PARAVIA_NUM_STATS values in stats */
+/* post: write every town's stats to the buffer, PARAVIA_NUM_STATS values per town in ParaviaStat order */
+
+const char* paraviaLastError(const ParaviaWorld* world);
+/* pre: valid world or NULL */
+/* post: return what made the world's last call fail ("" if nothing has), or why the last world couldn't be made for NULL (on the calling thread) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PARAVIAENGINE_H */
@@ -2,9 +2,48 @@
 #define PLAYER_CPP
 
 #include <iostream>
+#include <vector>
+#include <limits>
 #include "player.hpp"
+#include "telemetry.hpp" // score components and events
+#include "weightedSampler.hpp" // picking world events
 
-int8 Player::numPlayers = 0; // static variable definition
+namespace
+{
+    // new value of a population or price after a change, as long as it still fits
+    int16 fitStat(long value, const char* stat)
+    {
+        if (value < std::numeric_limits<int16>::min() || value > std::numeric_limits<int16>::max())
+            throw FormulaOverflow(std::string("Error: Town's ") + stat + " grew past what the game's formulas can handle.");
+        return value;
+    }
+
+    // odds of each world event being the one scheduled in a year, shared by every town (built right away, so every thread can draw from it)
+    const AliasTable& worldEventOdds()
+    {
+        static const AliasTable odds = []
+        {
+            std::vector<double> chances;
+            for (int type = 0; type < NUM_WORLD_EVENTS; ++type) chances.push_back(WORLD_EVENTS[type].chance);
+            return AliasTable(chances);
+        }();
+        return odds;
+    }
+}
+
+Player::Player(const Player& original, GameContext& g)
+: game(&g), name(original.name), townName(original.townName), playerNum(original.playerNum), difficulty(original.difficulty), gender(original.gender),
+  gold(original.gold), year(original.year),
+  serfs(original.serfs), merchants(original.merchants), clergy(original.clergy), nobles(original.nobles),
+  grain(original.grain), releasedGrain(original.releasedGrain), land(original.land), soldiers(original.soldiers),
+  taxes{original.taxes[SalesTax], original.taxes[IncomeTax], original.taxes[CustomsTax]},
+  events(original.events), harvestLoss(original.harvestLoss),
+  rankIndex(original.rankIndex), deathYear(original.deathYear), deferredYears(original.deferredYears), bankruptcies(original.bankruptcies),
+  countedBankruptcies(original.countedBankruptcies)
+{
+    for (int type = 0; type < NUM_ASSETS; ++type) assets[type] = original.assets[type];
+    ++game->numPlayers; // copies count as players too, since they get subtracted when destroyed
+}
 
 /// function definitions for all non-inline player members
 /// (see class def for protoypes and inline defs
@@ -21,21 +60,27 @@ void Player::buy(Commodity& product, int quantity)
     // handling for negative quantities
     if (quantity < 0) sell(product, quantity);
 
-    int totalCost = quantity * getPrice(product); // get cost of purchase
+    purchase(product.owned, getPrice(product), product.name.c_str(), quantity);
+}
+
+void Player::purchase(int& owned, int price, const char* item, int quantity)
+{
+    int totalCost = quantity * price; // get cost of purchase
 
     if (gold > totalCost || quantity == 0 || // do quick check to see if player can afford purchase, ask if they'd like to proceed in case that it puts them in debt
         ynInput("You're buying more than you can afford. Proceed with purchase anyways? (y/n) ", 'y', 'n'))
     {
         // continue with purchase
-        product.owned += quantity;
+        owned += quantity;
         gold -= totalCost;
 
         // display results in program output
-        std::cout << name << " buys " << quantity << ' ' << product.name
-                  << " for " << totalCost << " gold.\n";
+        output() << name << " buys " << quantity << ' ' << item
+                 << " for " << totalCost << " gold.\n";
 
         // check if the purchase has resulted in bankruptcy, act accordingly
         if (isBankrupt()) bankruptcy();
+        output().flush();
     }
 }
 
@@ -58,18 +103,20 @@ void Player::sell(Commodity& product, int quantity)
     gold += earnings;
 
     // display results
-    std::cout << name << " sells " << quantity << ' ' << product.name
-              << " for " << earnings << " gold.\n";
+    output() << name << " sells " << quantity << ' ' << product.name
+             << " for " << earnings << " gold.\n";
+    output().flush();
 }
 
+template <int8 DIFF>
 void Player::adjustPrice(Commodity& product)
 {
     // enforce general void preconditions
     if (gameEnded())
         throw std::logic_error("Error: Game function adjustPrice() being called after endgame conditions already reached.");
 
-    product.basePrice *= percent(random(MIN_PRICE_CHANGE, MAX_PRICE_CHANGE)); // change the price by a random percentage within the allowed range
-    std::cout << "The price of " << product.name <<  " in " << townName << " has changed to " << getPrice(product) <<" gold.\n"; // display results in program output
+    product.basePrice = fitStat(product.basePrice * percent(random(MIN_PRICE_CHANGE, MAX_PRICE_CHANGE)), "prices"); // change the price by a random percentage within the allowed range
+    output() << "The price of " << product.name <<  " in " << townName << " has changed to " << getPrice<DIFF>(product) <<" gold.\n"; // display results in program output
 }
 
 /*void Player::buy(Asset& building) no longer necessary due to addition of inheritance hierarchy
@@ -88,36 +135,105 @@ void Player::adjustPrice(Commodity& product)
         gold -= totalCost;
 
         // display results in program output
-        std::cout << name << " buys a "<< building.name
-                  << " for " << totalCost << " gold.\n";
+        output() << name << " buys a "<< building.name
+                 << " for " << totalCost << " gold.\n";
 
         // check if purchase has resulted in bankruptcy, act accordingly
         if (isBankrupt()) bankruptcy();
     }
 }*/
 
-void Player::attractCitizens(Asset building)
+template <int8 DIFF>
+Player::AssetYield Player::assetCensus() const
 {
-    // get quantities based on formula (high tax rates can decrease migration)
-    int newMerchants = (random(building.owned * building.merchantsAttracted) / (taxLevel() > diffModifier() ? taxLevel() : diffModifier()));
-    int newClergy = (random(building.owned * building.clergyAttracted) / (getCustoms() / CUSTOMS_TAX > diffModifier() ? getCustoms() / CUSTOMS_TAX : diffModifier()));
-    int newNobles = (random(building.owned * building.noblesAttracted) / (taxLevel() > diffModifier() ? taxLevel() : diffModifier()));
-    // higher taxes will decrease the amount of people who are willing to move in, lower taxes have the opposite affect but only up to (1 / diffModifier)
+    // high tax rates can decrease migration, same for every building so only figured out once
+    const float migrationDivisor = taxLevel() > modifier<DIFF>() ? taxLevel() : modifier<DIFF>();
+    const float clergyDivisor = getCustoms() / CUSTOMS_TAX > modifier<DIFF>() ? getCustoms() / CUSTOMS_TAX : modifier<DIFF>();
 
+    // one pass over the registry, in registry order
+    AssetYield yield;
+    for (int type = 0; type < NUM_ASSETS; ++type)
+    {
+        const AssetSpec& spec = ASSETS[type];
+        const int owned = assets[type];
+
+        if (spec.maxRevenue > 0) yield.revenue[type] = owned * random(spec.minRevenue, spec.maxRevenue) / modifier<DIFF>();
+        yield.merchants += static_cast<int>(random(owned * spec.merchantsAttracted) / migrationDivisor);
+        yield.clergy += static_cast<int>(random(owned * spec.clergyAttracted) / clergyDivisor);
+        yield.nobles += static_cast<int>(random(owned * spec.noblesAttracted) / migrationDivisor);
+    }
+    return yield;
+}
+
+void Player::attractCitizens(const AssetYield& yield)
+{
     // take effects into account
-    merchants += newMerchants;
-    clergy += newClergy;
-    nobles += newNobles;
+    merchants = fitStat(static_cast<long>(merchants) + yield.merchants, "merchants");
+    clergy = fitStat(static_cast<long>(clergy) + yield.clergy, "clergy");
+    nobles = fitStat(static_cast<long>(nobles) + yield.nobles, "nobles");
 
     // display results
-    if (newMerchants > 0) std::cout << newMerchants << " merchants come to "<< townName << ".\n";
-    if (newClergy > 0) std::cout << newClergy << " clergy come to " << townName << ".\n";
-    if (newClergy > 0) std::cout << newNobles << " nobles come to " << townName << ".\n";
+    if (yield.merchants > 0) output() << yield.merchants << " merchants come to "<< townName << ".\n";
+    if (yield.clergy > 0) output() << yield.clergy << " clergy come to " << townName << ".\n";
+    if (yield.nobles > 0) output() << yield.nobles << " nobles come to " << townName << ".\n";
+}
+
+int Player::totalAssets() const
+{
+    int total = 0;
+    for (int type = 0; type < NUM_ASSETS; ++type) total += assets[type];
+    return total;
 }
 
 
 /// taxes - helper functions
 
+int Player::getStat(TownStat stat) const
+{
+    if (stat >= AssetStat && stat < AssetStat + NUM_ASSETS) return assets[stat - AssetStat];
+    switch (stat)
+    {
+    case GoldStat: return gold;
+    case GrainStat: return grain.owned;
+    case LandStat: return land.owned;
+    case SoldierStat: return soldiers.owned;
+    case SalesStat: return taxes[SalesTax].rate;
+    case IncomeStat: return taxes[IncomeTax].rate;
+    case CustomsStat: return taxes[CustomsTax].rate;
+    case BankruptcyStat: return bankruptcies;
+    default: throw std::logic_error("Error: Invalid town stat requested.");
+    }
+}
+
+void Player::setStat(TownStat stat, int value)
+{
+    if (stat >= AssetStat && stat < AssetStat + NUM_ASSETS)
+    {
+        assets[stat - AssetStat] = value;
+        return;
+    }
+    switch (stat)
+    {
+    case GoldStat: gold = value; break;
+    case GrainStat: grain.owned = value; break;
+    case LandStat: land.owned = value; break;
+    case SoldierStat: soldiers.owned = value; break;
+    case SalesStat: taxes[SalesTax].rate = value; break;
+    case IncomeStat: taxes[IncomeTax].rate = value; break;
+    case CustomsStat: taxes[CustomsTax].rate = value; break;
+    case BankruptcyStat: bankruptcies = value; break;
+    default: throw std::logic_error("Error: Invalid town stat set.");
+    }
+}
+
+void Player::startFrom(const int stats[NUM_TOWN_STATS], int16 yearsLeft)
+{
+    if (year != STARTING_YEAR) throw std::logic_error("Error: Setting starting stats after the town's first turn.");
+    if (yearsLeft < 1) throw std::logic_error("Error: Starting a town with no years left.");
+    for (int stat = 0; stat < NUM_TOWN_STATS; ++stat) setStat(static_cast<TownStat>(stat), stats[stat]);
+    deathYear = year + yearsLeft;
+}
+
 void Player::adjustRate(int8& oldRate, int8 newRate, int8 minRate, int8 maxRate)
 {
     // enforce general void preconditions
@@ -138,9 +254,13 @@ void Player::invade(Player* defender)
     // enforce general void preconditions
     if (gameEnded() || defender->gameEnded())
         throw std::logic_error("Error: Game function invade() being called after endgame conditions already reached.");
+    if (deferredYears > 0 || defender->deferredYears > 0) // invasion depends on both towns' current stats
+        throw std::logic_error("Error: Game function invade() being called with a town that hasn't been caught up.");
+
+    if (game->recordMetrics) countEvent(InvasionEvent);
 
     // display header text
-    std::cout << getName() << "'s army has invaded " << defender->getTownName() << "!\n";
+    output() << name << "'s army has invaded " << defender->townName << "!\n";
 
     // invasion process:
     // randomly determine casualties for each player depending on strength of other player's army
@@ -162,6 +282,7 @@ void Player::invade(Player* defender)
     // take casualties into effect and display
 
     // break output to allow user to view results
+    output().flush();
     pressEnterToContinue("(Press ENTER to continue)");
 }
 
@@ -179,25 +300,28 @@ void Player::releaseGrain(int quantity)
     releasedGrain += quantity;
 
     // display results
-    std::cout << name << " distibutes " << quantity
-              << " grain to the citizens of " << townName << " for consumption.\n";
+    output() << name << " distibutes " << quantity
+             << " grain to the citizens of " << townName << " for consumption.\n";
+    output().flush();
 }
 
-void Player::printStats()
+void Player::printStats(Report& report) const
 {
     // function can be called after game ends, no preconditions need to be enforced
 
     // display full player title
-    std::cout << getTitle() << ' ' << name << " of " << townName;
-    if (won()) {std::cout << " (WINNER)";}
-    else if (dead()) {std::cout << " (deceased)";} // small indicator for if player is out of the game
-    std::cout << ": \n"; // formatting
+    report << title() << ' ' << name << " of " << townName;
+    if (won()) {report << " (WINNER)";}
+    else if (dead()) {report << " (deceased)";} // small indicator for if player is out of the game
+    report << ": \n"; // formatting
 
     // display player stats by category
-    std::cout << "Core stats: " << gold << " Gold, " << getGrain() << " Grain, " << getLand() << " Land.\n"
-              << "Population: " << getSerfs() << " Serfs, " << getSoldiers() << " Soldiers, " << getMerchants() << " Merchants, " << getClergy() << " Clergy, " << getNobles() << " Nobles.\n"
-              << "Assets: " << getMarkets() << " Markets, " << getMills() << " Mills, " << getCathedrals() << " Cathedrals, " << getPalaces() << " Palaces.\n"
-              << "Total Score: " << getScore() << "\n\n";
+    report << "Core stats: " << gold << " Gold, " << getGrain() << " Grain, " << getLand() << " Land.\n"
+           << "Population: " << getSerfs() << " Serfs, " << getSoldiers() << " Soldiers, " << getMerchants() << " Merchants, " << getClergy() << " Clergy, " << getNobles() << " Nobles.\n"
+           << "Assets: ";
+    for (int type = 0; type < NUM_ASSETS; ++type)
+        report << assets[type] << ' ' << capitalize(ASSETS[type].plural) << (type == NUM_ASSETS - 1 ? ".\n" : ", ");
+    report << "Total Score: " << getScore() << "\n\n";
 }
 
 void Player::bankruptcy()
@@ -209,80 +333,146 @@ void Player::bankruptcy()
     // check if player is considered bankrupt, proceed with bankruptcy process if yes
     if (isBankrupt())
     {
+        ++bankruptcies; // counted in the telemetry once the year ends (see yearEnd())
+
         // calculate randomized portion of player's assets to get "seized by creditors" (removed from game)
-        int16 marketsSeized = random(marketplace.owned);
-        int16 millsSeized = random(mill.owned); // simple formula involving a ranged random number
-        int16 cathedralsSeized = random(cathedral.owned); // variable assignment to keep consistent values
-        int16 palacesSeized = random(palace.owned);
-        // and deduct
-        marketplace.owned -= marketsSeized;
-        mill.owned -= millsSeized;
-        cathedral.owned -= cathedralsSeized;
-        palace.owned -= palacesSeized;
+        int16 seized[NUM_ASSETS];
+        for (int type = 0; type < NUM_ASSETS; ++type)
+        {
+            seized[type] = random(assets[type]); // simple formula involving a ranged random number
+            assets[type] -= seized[type]; // and deduct
+        }
 
         // in exchange for restoring their gold to a positive amount
         gold = BANKRUPTCY_BENEFITS;
 
         // display results in program output to inform user of event
-        std::cout << name << " has gone bankrupt from excessive debt.\n"
-                  << "Creditors in " << townName << " seize "
-                  << marketsSeized << " markets, " << millsSeized << " mills, "
-                  << cathedralsSeized << " cathedrals, and " << palacesSeized << " palaces to bail them out.\n";
+        output() << name << " has gone bankrupt from excessive debt.\n"
+                 << "Creditors in " << townName << " seize ";
+        for (int type = 0; type < NUM_ASSETS; ++type)
+            output() << (type == NUM_ASSETS - 1 ? "and " : "") << seized[type] << ' ' << ASSETS[type].plural << (type == NUM_ASSETS - 1 ? "" : ", ");
+        output() << " to bail them out.\n";
     }
 }
 
 
 /// population changes
 
+template <int8 DIFF>
 int Player::getSerfBirths() const
 {
     // formula: base amount of births with one extra birth for every (indiv. grain demand * 2) grain released above the total demand
     int baseBirths = random(getSerfs() * percent(MIN_BIRTH_RATE), getSerfs() * percent(MAX_BIRTH_RATE)); // base amount calculated between random parameters
-    int bonusBirths = (releasedGrain - grainDemand()) / (GRAIN_DEMAND * 2);
+    int bonusBirths = (releasedGrain - grainDemand<DIFF>()) / (GRAIN_DEMAND * 2);
 
     if (bonusBirths < 0) bonusBirths = 0; // take care of negative values
 
-    return (baseBirths + bonusBirths) / diffModifier();
+    return (baseBirths + bonusBirths) / modifier<DIFF>();
 }
 
+template <int8 DIFF>
 int Player::getSerfDeaths() const
 {
     // formula: base amount of deaths with one extra death for every (indiv. grain demand * 2) grain released below the total demand
     int baseDeaths = random(getSerfs() * percent(MIN_DEATH_RATE), getSerfs() * percent(MAX_DEATH_RATE)); // base amount calculated between random parameters
-    int bonusDeaths = (grainDemand() - releasedGrain) / (GRAIN_DEMAND * 2);
+    int bonusDeaths = (grainDemand<DIFF>() - releasedGrain) / (GRAIN_DEMAND * 2);
 
     if (bonusDeaths < 0) bonusDeaths = 0; // take care of negative values
     if (bonusDeaths > getSerfs() - baseDeaths) bonusDeaths = getSerfs() - baseDeaths; // take care of excessive values
 
-    return (baseDeaths + bonusDeaths) * diffModifier();
+    int deaths = (baseDeaths + bonusDeaths) * modifier<DIFF>();
+    if (deaths > getSerfs()) deaths = getSerfs(); // harder difficulties can't kill off more serfs than there are
+    return deaths;
 }
 
-int Player::getSerfMigration() const
+template <int8 DIFF>
+int Player::getSerfMigration(int released) const
 {
     // formula: 1 migrant for every extra (indiv. grain demand * 3) grain released after exceeding the demand by (migration req), divided by difficulty modifier
-    int16 surplus = releasedGrain - grainDemand() - MIGRATION_REQ;
+    int16 surplus = released - grainDemand<DIFF>() - MIGRATION_REQ;
     if (surplus < 0) return 0; // no one moves in if no surplus grain is released
 
-    return (surplus / (GRAIN_DEMAND * 3)) / diffModifier();
+    return (surplus / (GRAIN_DEMAND * 3)) / modifier<DIFF>();
+}
+
+namespace
+{
+    // expected value and variance of min(U + bonus, cap) for U a random integer between minVal and maxVal (as given by random())
+    void clampedUniformMoments(int minVal, int maxVal, int bonus, int cap, float& mean, float& variance)
+    {
+        double count = maxVal - minVal + 1;
+        int lastUnclamped = maxVal < cap - bonus ? maxVal : cap - bonus; // highest draw that stays under the cap
+
+        double sum = 0, sumOfSquares = 0;
+        if (lastUnclamped >= minVal)
+        {
+            // draws that keep their value (shifted by the bonus), using sums of consecutive integers and squares
+            double low = minVal + bonus, high = lastUnclamped + bonus, n = lastUnclamped - minVal + 1;
+            sum = n * (low + high) / 2;
+            sumOfSquares = (high * (high + 1) * (2 * high + 1) - (low - 1) * low * (2 * low - 1)) / 6;
+        }
+        else lastUnclamped = minVal - 1; // every draw gets clamped
+
+        // draws that get clamped down to the cap
+        double clamped = maxVal - lastUnclamped;
+        sum += clamped * cap;
+        sumOfSquares += clamped * cap * cap;
+
+        mean = sum / count;
+        variance = sumOfSquares / count - (sum / count) * (sum / count);
+    }
+}
+
+ReleaseProjection Player::projectRelease(int quantity) const
+{
+    ReleaseProjection result;
+    result.released = releasedGrain + quantity; // released grain adds up over the turn
+    const int serfCount = getSerfs();
+    const int noLimit = serfCount * 2 + result.released; // higher than any possible number of births
+
+    // births: same bounds and bonus as getSerfBirths(), then divided by the difficulty modifier
+    int bonusBirths = (result.released - grainDemand()) / (GRAIN_DEMAND * 2);
+    if (bonusBirths < 0) bonusBirths = 0;
+    clampedUniformMoments(serfCount * percent(MIN_BIRTH_RATE), serfCount * percent(MAX_BIRTH_RATE), bonusBirths, noLimit, result.births, result.birthVariance);
+    result.births /= diffModifier();
+    result.birthVariance /= diffModifier() * diffModifier();
+
+    // deaths: same as getSerfDeaths(), multiplied by the difficulty modifier and capped at the whole serf population (the cap is divided to match)
+    int bonusDeaths = (grainDemand() - result.released) / (GRAIN_DEMAND * 2);
+    if (bonusDeaths < 0) bonusDeaths = 0;
+    const int deathCap = diffModifier() > 1 ? serfCount / diffModifier() : serfCount;
+    clampedUniformMoments(serfCount * percent(MIN_DEATH_RATE), serfCount * percent(MAX_DEATH_RATE), bonusDeaths, deathCap, result.deaths, result.deathVariance);
+    result.deaths *= diffModifier();
+    result.deathVariance *= diffModifier() * diffModifier();
+
+    // migration is fixed for a given amount of grain
+    result.migration = getSerfMigration(result.released);
+
+    // births and deaths are drawn independently, so their variances add up
+    result.serfs = serfCount + result.births - result.deaths + result.migration;
+    result.serfVariance = result.birthVariance + result.deathVariance;
+
+    return result;
 }
 
+template <int8 DIFF>
 void Player::populationChange()
 {
     // get values for changes in serf population by cause
-    int serfBirths = getSerfBirths();
-    int serfDeaths = getSerfDeaths(); // variable assignments to keep consistent values in case of randomness
-    int serfMigration = getSerfMigration();
+    int serfBirths = getSerfBirths<DIFF>();
+    int serfDeaths = getSerfDeaths<DIFF>(); // variable assignments to keep consistent values in case of randomness
+    int serfMigration = getSerfMigration<DIFF>();
 
     // take changes into effect and display results in program output
     // for births
-    serfs += serfBirths;
-    std::cout << serfBirths << " serfs are born in " << townName << ".\n";
+    serfs = fitStat(static_cast<long>(serfs) + serfBirths, "serfs");
+    output() << serfBirths << " serfs are born in " << townName << ".\n";
     // for deaths
-    serfs -= serfDeaths;
-    std::cout << serfDeaths << " serfs in " << townName << " die.\n";
+    serfs = fitStat(static_cast<long>(serfs) - serfDeaths, "serfs");
+    output() << serfDeaths << " serfs in " << townName << " die.\n";
     // and for migration
-    serfs += serfMigration;
-    std::cout << serfMigration << " serfs move to " << townName << ".\n";
+    serfs = fitStat(static_cast<long>(serfs) + serfMigration, "serfs");
+    output() << serfMigration << " serfs move to " << townName << ".\n";
 
     releasedGrain = 0; // reset released grain using it to calculate changes for serfs
 }
@@ -290,60 +480,59 @@ void Player::populationChange()
 
 /// revenue and expenses
 
-int Player::getRevenue(Tax tax) const
+void Player::getTaxRevenues(int revenues[NUM_TAXES]) const
 {
-    return (percent(tax.rate) // get the percentage as a decimal
-    * ((tax.merchantRevenue * merchants)
-    + (tax.clergyRevenue * clergy) // factor in taxable wealth in town
-    + (tax.nobleRevenue * nobles)
-    + (tax.assetRevenue * totalAssets())
-    /*+ (taxJustice)*/) // i'm still trying to figure out how tax justice is supposed to get factored in
-    / diffModifier()); // take difficulty into account
+    // taxable groups in the town, shared by every tax
+    const int base[NUM_TAX_BASES] = {merchants, clergy, nobles, totalAssets()};
+    // (i'm still trying to figure out how tax justice is supposed to get factored in)
+
+    // one row of the weight matrix per tax, difficulty taken into account by the formula
+    for (int tax = 0; tax < NUM_TAXES; ++tax)
+        revenues[tax] = taxRevenue(TAX_WEIGHTS[tax], base, taxes[tax].rate, diffModifier());
 }
 
 void Player::receiveTaxRevenue()
 {
-    // get values for tax revenue by category
-    int16 salesRevenue = getSalesRevenue();
-    int16 incomeRevenue = getIncomeRevenue(); // variable assignments to keep consistent values in case of randomness
-    int16 customsRevenue = getCustomsRevenue();
+    // get values for tax revenue by category, all calculated together
+    int revenues[NUM_TAXES];
+    getTaxRevenues(revenues);
+    receiveTaxRevenue(revenues);
+}
 
+void Player::receiveTaxRevenue(const int revenues[NUM_TAXES])
+{
     // take changes into effect and display results in program output
     // for sales
-    gold += salesRevenue;
-    std::cout << salesRevenue << " gold received from sales taxes.\n";
+    gold += revenues[SalesTax];
+    output() << revenues[SalesTax] << " gold received from sales taxes.\n";
     // for income
-    gold += incomeRevenue;
-    std::cout << incomeRevenue << " gold received from income taxes.\n";
-    // and for customs
-    gold += customsRevenue;
-    std::cout << customsRevenue << " gold received from customs duties.\n";
+    gold += revenues[IncomeTax];
+    output() << revenues[IncomeTax] << " gold received from income taxes.\n";
+    // and for customs
+    gold += revenues[CustomsTax];
+    output() << revenues[CustomsTax] << " gold received from customs duties.\n";
 }
 
-// int16 getRevenue(Asset building) const {return building.owned * random(building.minRevenue, building.maxRevenue) / diffModifier();}
-void Player::receiveAssetRevenue()
+void Player::receiveAssetRevenue(const AssetYield& yield)
 {
-    // get values for asset revenue by category
-    int16 marketRevenue = getMarketRevenue();
-    int16 millRevenue = getMillRevenue(); // variable assignments to keep consistent values in case of randomness
-
-    // take changes into effect and display results in program output
-    // for sales
-    gold += marketRevenue;
-    std::cout << marketRevenue << " gold earned by " << townName << "'s markets.\n";
-    // for income
-    gold += millRevenue;
-    std::cout << millRevenue << " gold earned by " << townName << "'s mills.\n";
+    // take changes into effect and display results in program output, for every type that earns anything
+    for (int type = 0; type < NUM_ASSETS; ++type)
+    {
+        if (ASSETS[type].maxRevenue == 0) continue;
+        gold += yield.revenue[type];
+        output() << yield.revenue[type] << " gold earned by " << townName << "'s " << ASSETS[type].plural << ".\n";
+    }
 }
 
+template <int8 DIFF>
 void Player::paySoldiers()
 {
     // calculate and deduct expenses
-    int16 pay = armyPay(); // variable assignment to keep consistent values in case of randomness
+    int16 pay = armyPay<DIFF>(); // variable assignment to keep consistent values in case of randomness
     gold -= pay;
 
     // display results
-    std::cout << pay << " gold paid to " << townName << "'s standing army.\n";
+    output() << pay << " gold paid to " << townName << "'s standing army.\n";
 
     // check if payments have caused bankruptcy
     if (isBankrupt()) bankruptcy();
@@ -352,38 +541,140 @@ void Player::paySoldiers()
 
 /// resource gain and loss
 
+template <int8 DIFF>
 int Player::getHarvest()
 {
     // formula: serf population multiplied by random value between two parameters, divided by difficulty modifier
     // might change this to a more sophisticated formula later
-    return random(getSerfs() * MIN_HARVEST, getSerfs() * MAX_HARVEST) / diffModifier();
+    return random(getSerfs() * MIN_HARVEST, getSerfs() * MAX_HARVEST) / modifier<DIFF>();
 }
 
+template <int8 DIFF>
 void Player::receiveHarvest()
 {
     // get amount of grain to receive
-    int harvest = getHarvest();
+    int harvest = getHarvest<DIFF>();
+    harvest -= harvest * percent(harvestLoss); // failed harvests (see worldEvents())
+    harvestLoss = 0;
 
     // take changes into effect, display results;
     grain.owned += harvest;
-    std::cout << harvest << " grain harvested by " << townName << "'s serfs.\n";
+    output() << harvest << " grain harvested by " << townName << "'s serfs.\n";
 }
 
 // int8 getGrainLoss() {return random(20, 40) * diffModifier();}
+template <int8 DIFF>
 void Player::loseGrain()
 {
     // get percentage of current grain to deduct
-    int16 grainLoss = getGrainLoss();
+    int16 grainLoss = getGrainLoss<DIFF>();
 
     // take changes into effect, display results;
     grain.owned -= grain.owned * percent(grainLoss); // subtract as percentage
-    std::cout << grainLoss << "% of " << townName << "'s existing grain reserves lost to various causes.\n";
+    output() << grainLoss << "% of " << townName << "'s existing grain reserves lost to various causes.\n";
+}
+
+
+/// world events
+
+template <int8 DIFF>
+void Player::worldEvents()
+{
+    // roll a new event for the coming years (chance of any event is all of their chances together, then each one's odds go by its own chance)
+    const AliasTable& odds = worldEventOdds();
+    if (random(99) < odds.totalWeight())
+    {
+        WorldEventType type = static_cast<WorldEventType>(odds.draw(*game));
+        const WorldEventSpec& spec = WORLD_EVENTS[type];
+        int delay = random(spec.minDelay, spec.maxDelay);
+        events.schedule({type, year + delay, random(spec.minMagnitude, spec.maxMagnitude)});
+    }
+
+    // carry out this year's
+    int happened = 0;
+    events.dispatch(year, [&](const WorldEvent& event)
+    {
+        handleEvent<DIFF>(event);
+        ++happened;
+    });
+    if (happened == 0) output() << "Nothing out of the ordinary happens in " << townName << " this year.\n";
+}
+
+template <int8 DIFF>
+void Player::handleEvent(const WorldEvent& event)
+{
+    int severity = event.magnitude * modifier<DIFF>(); // harmful events get worse on higher difficulties
+    if (severity > 100 && event.type != RaidEvent) severity = 100; // percentages
+
+    switch (event.type)
+    {
+    case PlagueEvent:
+    {
+        int16 serfsKilled = serfs * percent(severity);
+        int16 merchantsKilled = merchants * percent(severity / 2); // taxpayers can afford to stay away from the sick
+        int16 clergyKilled = clergy * percent(severity / 2);
+        int16 noblesKilled = nobles * percent(severity / 2);
+        serfs -= serfsKilled;
+        merchants -= merchantsKilled;
+        clergy -= clergyKilled;
+        nobles -= noblesKilled;
+        output() << "A plague sweeps through " << townName << ", killing " << serfsKilled << " serfs, " << merchantsKilled << " merchants, "
+                 << clergyKilled << " clergy, and " << noblesKilled << " nobles.\n";
+        break;
+    }
+    case FireEvent:
+    {
+        int burned = grain.owned * percent(severity);
+        AssetType type = static_cast<AssetType>(random(NUM_ASSETS - 1)); // one part of town catches fire
+        int destroyed = assets[type] * percent(severity);
+        grain.owned -= burned;
+        assets[type] -= destroyed;
+        output() << "A fire in " << townName << " burns " << burned << " grain and " << destroyed << ' ' << ASSETS[type].plural << ".\n";
+        break;
+    }
+    case FestivalEvent:
+    {
+        int spent = gold > 0 ? gold * percent(event.magnitude) : 0; // held whatever the difficulty, but draws fewer guests on harder ones
+        gold -= spent;
+        int guests = spent / FESTIVAL_GUEST_COST / modifier<DIFF>();
+        if (guests > 0) events.schedule({ImmigrationEvent, year + 1, guests}); // word gets around by next year
+        output() << townName << " holds a festival, spending " << spent << " gold.\n";
+        break;
+    }
+    case HarvestFailureEvent:
+        harvestLoss = severity;
+        output() << "Blight spreads through " << townName << "'s fields, ruining " << severity << "% of this year's harvest.\n";
+        break;
+    case RaidEvent:
+        if (getSoldiers() >= severity)
+        {
+            int16 casualties = random(severity / 2);
+            soldiers.owned -= casualties;
+            output() << townName << "'s army drives off " << severity << " bandits, losing " << casualties << " soldiers.\n";
+        }
+        else
+        {
+            int16 casualties = random(getSoldiers());
+            int loot = (severity - getSoldiers()) * RAID_LOOT;
+            soldiers.owned -= casualties;
+            gold -= loot;
+            output() << severity << " bandits raid " << townName << ", killing " << casualties << " soldiers and taking " << loot << " gold.\n";
+            if (isBankrupt()) bankruptcy();
+        }
+        break;
+    case ImmigrationEvent:
+        merchants = fitStat(static_cast<long>(merchants) + event.magnitude, "merchants");
+        output() << event.magnitude << " merchants move to " << townName << " after hearing about its festival.\n";
+        break;
+    default:
+        throw std::logic_error("Error: Function handleEvent() called with an invalid event type.");
+    }
 }
 
 
 /// scoring and ranking
 
-std::string Player::getTitle() const
+const std::string& Player::title() const
 {
     // check player gender before returning appropriate title
     switch (getGender())
@@ -398,8 +689,25 @@ std::string Player::getTitle() const
     }
 }
 
+void Player::getScoreComponents(int components[NUM_SCORE_COMPONENTS]) const
+{
+    // same weights as getScore()
+    components[GoldScore] = getGold();
+    components[SerfScore] = getSerfs() * SERF_VALUE;
+    components[MerchantScore] = getMerchants() * MERCHANT_VALUE;
+    components[ClergyScore] = getClergy() * CLERGY_VALUE;
+    components[NobleScore] = getNobles() * NOBLE_VALUE;
+    components[SoldierScore] = getSoldiers() * SOLDIER_VALUE;
+    components[GrainScore] = getGrain() * GRAIN_VALUE;
+    components[LandScore] = getLand() * LAND_VALUE;
+    for (int type = 0; type < NUM_ASSETS; ++type) components[AssetScore + type] = assets[type] * ASSETS[type].value;
+}
+
 int Player::getScore() const
 {
+    int assetScore = 0;
+    for (int type = 0; type < NUM_ASSETS; ++type) assetScore += assets[type] * ASSETS[type].value;
+
     // each stat weighed by their "value" in terms of gold for calculating score with the total being the sum (difficulty not accounted, see parameters file for details)
     return (((getGold()/* - STARTING_GOLD*/) * 1) // gold
             + ((getSerfs()/* - STARTING_SERFS*/) * SERF_VALUE) // populations
@@ -409,10 +717,7 @@ int Player::getScore() const
             + ((getSoldiers()/* - STARTING_SOLDIERS*/) * SOLDIER_VALUE)
             + ((getGrain()/* - STARTING_GRAIN*/) * GRAIN_VALUE) // resources
             + ((getLand()/* - STARTING_LAND*/) * LAND_VALUE)
-            + ((getMarkets() - 0) * MARKET_VALUE) // assets
-            + ((getMills() - 0) * MILL_VALUE)
-            + ((getCathedrals()- 0) * CATHEDRAL_VALUE)
-            + ((getPalaces() - 0) * PALACE_VALUE)
+            + assetScore // assets
             + 1000); // starting score
 }
 
@@ -431,52 +736,78 @@ void Player::promote()
     if (getPromotion()) // check if player meets score conditions
     {
         ++rankIndex; // do the actual promotion
+        if (game->recordMetrics) countEvent(PromotionEvent);
 
         // display results of promotion in program output
-        std::cout <<  "Thanks to their diligent leadership of "
+        output() <<  "Thanks to their diligent leadership of "
         << townName << ", " << name
         << " has attained the rank of "
-        << getTitle() << "!\n";
+        << title() << "!\n";
     }
 }
 
 /// the big post-turn function
 void Player::turnResults()
+{
+    // taxes are the first thing to happen, so they can be calculated from the town as it is now
+    int revenues[NUM_TAXES];
+    getTaxRevenues(revenues);
+    turnResults(revenues);
+}
+
+void Player::turnResults(const int revenues[NUM_TAXES])
 {
     // enforce general void preconditions
     if (gameEnded())
         throw std::logic_error("Error: Game function turnResults() being called after endgame conditions already reached.");
 
+    // one engine per difficulty, with the difficulty modifier built into every formula
+    switch (difficulty)
+    {
+    case 1: yearEnd<1>(revenues); break;
+    case 2: yearEnd<2>(revenues); break;
+    case 3: yearEnd<3>(revenues); break;
+    case 4: yearEnd<4>(revenues); break;
+    default:
+        throw std::logic_error("Error: Function turnResults() called for a player with an invalid difficulty.");
+    }
+}
+
+template <int8 DIFF>
+void Player::yearEnd(const int revenues[NUM_TAXES])
+{
+
     // program output header
-    std::cout << "\nAnnual report for " << getTitle() << ' ' << name
+    output() << "\nAnnual report for " << title() << ' ' << name
     << " of " << townName << ", Year " << year << "\n";
 
     // take all the functions scheduled to get called after a player's turn
     // and call all of them by category
 
-    std::cout << "\nFinances: \n";
-    receiveTaxRevenue();
-    receiveAssetRevenue();
-    paySoldiers();
+    output() << "\nFinances: \n";
+    receiveTaxRevenue(revenues);
+    AssetYield buildings = assetCensus<DIFF>(); // everything the buildings do this year, used again in the census below
+    receiveAssetRevenue(buildings);
+    paySoldiers<DIFF>();
+
+    output() << "\nEvents: \n";
+    worldEvents<DIFF>();
 
-    std::cout << "\nResources: \n";
-    receiveHarvest();
-    loseGrain();
+    output() << "\nResources: \n";
+    receiveHarvest<DIFF>();
+    loseGrain<DIFF>();
 
-    std::cout << "\nEconomy: \n";
-    adjustGrainPrice();
-    adjustLandPrice();
+    output() << "\nEconomy: \n";
+    adjustGrainPrice<DIFF>();
+    adjustLandPrice<DIFF>();
 
-    std::cout << "\nCensus (Taxpayers): \n";
-    attractCitizens(marketplace);
-    attractCitizens(mill);
-    attractCitizens(cathedral);
-    attractCitizens(palace);
+    output() << "\nCensus (Taxpayers): \n";
+    attractCitizens(buildings);
 
-    std::cout << "\nCensus (Serfs): \n";
-    populationChange();
+    output() << "\nCensus (Serfs): \n";
+    populationChange<DIFF>();
 
-    std::cout << "\n"; // formatting
+    output() << "\n"; // formatting
 
     // check if player should get promoted following stat changeshg
     if(getPromotion()) promote();
@@ -488,19 +819,35 @@ void Player::turnResults()
     // actual handling to be done in game flow functions
     if (won())
     { // if you win and die in the same turn, victory takes precedence
-        std::cout << "\n" << getTitle() << ' ' << name << " of " << townName
+        output() << "\n" << title() << ' ' << name << " of " << townName
         << " has won the game by achieving the highest rank!\n"
         << "Congratulations, " << name << "!\n";
     }
     else if (dead())
     {
-        std::cout << "\nAfter ruling " << townName
+        if (game->recordMetrics) countEvent(DeathEvent);
+        output() << "\nAfter ruling " << townName
         << " for " << year - STARTING_YEAR << " years, "
-        << getTitle() << name << " has died.\n"
+        << title() << name << " has died.\n"
         << "Thanks, for playing, " << name << "!\n";
     }
 
-    std::cout << "\n"; // formatting
+    output() << "\n"; // formatting
+    for (; countedBankruptcies < bankruptcies; ++countedBankruptcies) if (game->recordMetrics) countEvent(BankruptcyEvent); // including ones during the turn, which can't be undone anymore
+    if (game->recordMetrics) recordTownYear(*this); // town as the year ends
+
+    // write out the whole report at once
+    output().flush();
+}
+
+/// deferred year-end reports
+
+void Player::catchUp(const int revenues[NUM_TAXES])
+{
+    if (deferredYears < 1) throw std::logic_error("Error: Function catchUp() called for a town without any deferred years.");
+
+    --deferredYears;
+    turnResults(revenues);
 }
 
 
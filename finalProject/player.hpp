@@ -183,15 +183,42 @@ Player class abstraction details (copied from README.md file)
 */
 
 #include <string>
+#include <stdexcept>
 #include "helperFunctions.hpp" // rng and input functions
 #include "parameters.hpp" // constant parameters
+#include "report.hpp" // buffered game output
+#include "gameContext.hpp" // game the player belongs to
+#include "taxEngine.hpp" // tax revenue formula
+#include "eventScheduler.hpp" // world events
 
 enum Gender {Male, Female}; // player gender represented with enum values to make higher-level usage easier
 
+// stats that decisions during a turn can change (see Player::getStat() and TurnHistory)
+// one asset stat per asset type, in registry order (AssetStat + AssetType)
+enum TownStat {GoldStat, GrainStat, LandStat, SoldierStat, AssetStat, SalesStat = AssetStat + NUM_ASSETS, IncomeStat, CustomsStat, BankruptcyStat};
+const int NUM_TOWN_STATS = BankruptcyStat + 1;
+
+// parts of a town's score (see Player::getScoreComponents()), with one asset component per asset type in registry order (AssetScore + AssetType)
+enum ScoreComponent {GoldScore, SerfScore, MerchantScore, ClergyScore, NobleScore, SoldierScore, GrainScore, LandScore, AssetScore};
+const int NUM_SCORE_COMPONENTS = AssetScore + NUM_ASSETS;
+
+struct ReleaseProjection // expected effects of releasing an amount of grain on a town's serfs (see Player::projectRelease())
+{
+    int released; // total grain released for the year
+    float births, birthVariance; // expected value and variance of each change
+    float deaths, deathVariance;
+    float migration; // doesn't involve any randomness
+    float serfs, serfVariance; // serf population once all changes take effect
+};
+
+// thrown once a town grows past what its stats can hold (populations and prices are int16), which means the town has outgrown the game's formulas rather than hit a bug
+// simulation tools catch only this and count the town as broken, anything else thrown is a real error
+struct FormulaOverflow : std::overflow_error {using std::overflow_error::overflow_error;};
+
 class Player
 {
 private:
-    static int8 numPlayers; // measures total number of player objects, incremented with constructor, decremented with destructor
+    GameContext* game; // game the player belongs to, supplies the random numbers and output for all of the player's formulas and reports (set before anything else gets initialized)
 
     /// first set of members denoted in the abstraction details - personal stats
     /// basic identifying info that's mostly independent from gameplay and game flow (aside of the difficulty member)
@@ -206,28 +233,45 @@ private:
 public:
     // member values in this section are the only ones determined by constructor input
     // all others are assigned to default values
-    Player() = default; // default constructor, included for sake of good practice
-    Player(std::string n, std::string tn, int8 diff, Gender gen) // "main" constructor, takes input for all the above members and assigns accordingly
-    : name(n), townName(tn), playerNum(++numPlayers), difficulty(diff), gender(gen) {}
-    Player(std::string n, std::string tn, int8 diff) // "abbreviated" constructor only takes input for name, townName, and difficulty, gender assigned randomly
-    : name(n), townName(tn), playerNum(++numPlayers), difficulty(diff), gender(random(Male, Female)) {}
-    Player(std::string n, std::string tn) // further-shortened version that only needs input for name and town name
-    : name(n), townName(tn), playerNum(++numPlayers), difficulty(random(MIN_DIFFICULTY, MAX_DIFFICULTY)), gender(random(Male, Female)) {}
-    ~Player() {--numPlayers;}
+    // every constructor takes the game the player belongs to first (see gameContext.hpp)
+    Player(GameContext& g, std::string n, std::string tn, int8 diff, Gender gen) // "main" constructor, takes input for all the above members and assigns accordingly
+    : game(&g), name(n), townName(tn), playerNum(++g.numPlayers), difficulty(diff), gender(gen) {}
+    Player(GameContext& g, std::string n, std::string tn, int8 diff) // "abbreviated" constructor only takes input for name, townName, and difficulty, gender assigned randomly
+    : game(&g), name(n), townName(tn), playerNum(++g.numPlayers), difficulty(diff), gender(random(Male, Female)) {}
+    Player(GameContext& g, std::string n, std::string tn) // further-shortened version that only needs input for name and town name
+    : game(&g), name(n), townName(tn), playerNum(++g.numPlayers), difficulty(random(MIN_DIFFICULTY, MAX_DIFFICULTY)), gender(random(Male, Female)) {}
+    Player(const Player& original) : Player(original, *original.game) {} // copy constructor, copies every stat into the same game
+    Player(const Player& original, GameContext& g); // same, with the copy belonging to another game (used by bots to try out decisions on a copy of their town without touching the real game)
+    ~Player() {--game->numPlayers;}
 
     // public accessor functions for usage in program output
     std::string getName() {return name;}
     std::string getTownName() {return townName;}
 
     int8 getPlayerNum() const {return playerNum;}
-    // int8 getDifficulty() const {return difficulty;}
+    int8 getDifficulty() const {return difficulty;}
     Gender getGender() const {return static_cast<Gender>(gender);}
 
 private:
+    // all program output from game functions goes through the report (written out at the end of each action, see report.hpp)
+    Report& output() const {return game->report;}
+
+    // random numbers from the player's game (used by every formula in place of the global helpers)
+    int random(int minVal, int maxVal) const {return game->random(minVal, maxVal);}
+    int random(int maxVal) const {return game->random(0, maxVal);}
+
     /// value by which some stats are modified based on game difficulty (very important to gameplay)
     float diffModifier() const {return DIFF_MODIFIERS[difficulty - 1];}
     // expenses and resource loss get multiplied, revenue and resource gain get divided
 
+    // same modifier for formulas that are part of the year-end engine (see yearEnd())
+    // DIFF is the difficulty level the engine was built for, which turns the modifier into a constant, or 0 to look it up from the town like diffModifier()
+    template <int8 DIFF = 0> float modifier() const
+    {
+        if constexpr (DIFF > 0) return DIFF_MODIFIERS[DIFF - 1];
+        else return diffModifier();
+    }
+
     /// second set of members denoted in the abstraction details - in-game stats
     /// all the variables that the gameplay and game mechanics center around (aside of score and endgame stuff)
     /// initialized to default values at construction, values get modified indirectly through events and decisions (functions defined in next section)
@@ -264,7 +308,7 @@ private:
         : owned(owned), basePrice(basePrice), name(name) {};
     };
     // take difficulty into account for the "true" prices
-    int16 getPrice(const Commodity& product) const {return product.basePrice * diffModifier();}
+    template <int8 DIFF = 0> int16 getPrice(const Commodity& product) const {return product.basePrice * modifier<DIFF>();}
 
     // helper functions do basic processes of "buying" or selling a quantity of goods in the game
     // intended for indirect usage (called by other member functions in the public access)
@@ -275,87 +319,68 @@ private:
     // inform player if purchase would put them into debt and check if player has become bankrupt from purchase
     void buy(Commodity& product) {buy(product, 1);} // overload for only one parameter
 
+    void purchase(int& owned, int price, const char* item, int quantity);
+    // pre: same as buy(), owned is a member of object, price per item as the town sees it
+    // post: same as buy(), for anything the town keeps a count of (commodities and assets)
+
     void sell(Commodity& product, int quantity);
     // pre: player object initialized, commodity parameter is member of object, function called by public member of object, valid quantity parameter greater than 0 and less than the owned product quantity
     // post: decrease commodity's owned quantity by quantity parameter, increase gold by quantity times price, display results in program output to inform user
     void sell(Commodity& product) {sell(product, 1);} // overload for only one parameter
 
-    void adjustPrice(Commodity& product);
+    template <int8 DIFF = 0> void adjustPrice(Commodity& product);
     // pre: player object intialized, commodity parameter is member of object
     // post: changes the price member of the commodity to a randomized value
 
     // grain implementation
-    Commodity grain = *new Commodity(STARTING_GRAIN, GRAIN_PRICE, "grain"); // grain is required to feed the town's population, which can grow or starve depending on the amount it gets access to
+    Commodity grain = Commodity(STARTING_GRAIN, GRAIN_PRICE, "grain"); // grain is required to feed the town's population, which can grow or starve depending on the amount it gets access to
     int releasedGrain = 0; // how much of the grain reserves the player distributes to the townspeople, set to half the starting grain for the first turn
 
     // land implementation
-    Commodity land = *new Commodity(STARTING_LAND, LAND_PRICE, "land"); // land is needed for
+    Commodity land = Commodity(STARTING_LAND, LAND_PRICE, "land"); // land is needed for
 
     // soldiers are part of the population on an abstract level but are implemented as commodities because they can be bought
-    Commodity soldiers = *new Commodity(STARTING_SOLDIERS, SOLDIER_COST, "soldiers"); // require yearly payments in gold, mainly used as part of the invasion mechanic
+    Commodity soldiers = Commodity(STARTING_SOLDIERS, SOLDIER_COST, "soldiers"); // require yearly payments in gold, mainly used as part of the invasion mechanic
 
     /// implementation for assets
-    // set of high-value in-game investments that serve similar, generic purposes of attracting tax-paying citizens and/or generating monthly revenu
-    struct Asset : Commodity // data structure inherits commodity members for base price, amount owned, and item name
-    { // also consists of additional members representing parameters for in-game behavior
-
-        // yearly revenue generation
-        const int16 minRevenue;
-        const int16 maxRevenue; // randomly decided between two limits
+    // set of high-value in-game investments that serve similar, generic purposes of attracting tax-paying citizens and/or generating yearly revenue
+    // every type's behavior comes from its row in the asset registry (see ASSETS in the parameters file), so the town only keeps how many of each it owns
+    int assets[NUM_ASSETS] = {}; // buildings owned, by AssetType (next to each other so the year-end census goes through them in one pass)
 
-        // population growth per turn per owned building
-        const int8 merchantsAttracted; // represent maximum values (can be 0)
-        const int8 clergyAttracted;
-        const int8 noblesAttracted;
+    template <int8 DIFF = 0> int16 getPrice(AssetType type) const {return ASSETS[type].price * modifier<DIFF>();} // asset prices don't change, only the difficulty affects them
 
-        // constructors
-        Asset() = default; // default
-        // with member initializations
-        Asset(int owned, int basePrice, std::string name, int minRevenue, int maxRevenue, int merchantsAttracted, int clergyAttracted, int noblesAttracted)
-        : Commodity(owned, basePrice, name), minRevenue(minRevenue), maxRevenue(maxRevenue)
-        , merchantsAttracted(merchantsAttracted), clergyAttracted(clergyAttracted), noblesAttracted(noblesAttracted) {}
+    // everything the town's buildings produce in a year
+    struct AssetYield
+    {
+        int revenue[NUM_ASSETS] = {}; // gold earned, by AssetType
+        int merchants = 0; // new people attracted by all of the buildings together
+        int clergy = 0;
+        int nobles = 0;
     };
-    // can use buy and getPrice functions for Commodity struct through dynamic typing
 
-    // function to bring new people into the town each turn from assets
-    void attractCitizens(Asset building);
-    // pre: player object intialized, asset parameter is member of object, player isn't dead, game hasn't ended
-    // post: increase populations of taxpayers in the town based on asset members, display results in program output
+    template <int8 DIFF = 0> AssetYield assetCensus() const;
+    // pre: player object initialized, player isn't dead, game hasn't ended
+    // post: roll the year's revenue and new citizens for every building type in a single loop over the registry (nothing in the town changes yet)
+    // higher taxes decrease the amount of people who are willing to move in, lower taxes have the opposite affect but only up to (1 / diffModifier)
 
-    int getRevenue(Asset building) const // helper function for getting yearly revenue generated by building category in the town
-    {return building.owned * random(building.minRevenue, building.maxRevenue) / diffModifier();}
+    void attractCitizens(const AssetYield& yield);
+    // pre: player object intialized, yield from assetCensus() in the same year-end report
+    // post: increase populations of taxpayers in the town by the new citizens, display results in program output
 
     // public works are also sources of tax revenue in addition to any income generated on their own
-    int16 totalAssets() const
-    {return marketplace.owned + mill.owned + cathedral.owned + palace.owned;} // simple helper function returns total number of town buildings for taxation purposes
-
-    // current implemented types
-    Asset marketplace = *new Asset(0, MARKET_PRICE, "market", MIN_MARKET_REVENUE, MAX_MARKET_REVENUE, MARKET_MERCHANTS, 0, 0); // markets bring merchants to the town and generate revenue
-    Asset mill = *new Asset(0, MILL_PRICE, "mill", MIN_MILL_REVENUE, MAX_MILL_REVENUE, 0, 0, 0); // mills don't bring in new people but generate revenue
-    Asset cathedral = *new Asset(0, CATHEDRAL_PRICE, "cathedral", 0, 0, 0, CATHEDRAL_CLERGY, 0); // cathedrals bring clergy to the town
-    Asset palace = *new Asset(0, PALACE_PRICE, "palace", 0, 0, 0, 0, PALACE_NOBLES); // palaces bring nobles to the town
+    int totalAssets() const; // simple helper function returns total number of town buildings for taxation purposes
 
     /// implementation for taxes
     // data structure consisting of all the relevant attributes in a tax
+    // taxable wealth per taxpayer for each tax is shared by every town, see TAX_WEIGHTS in the parameters file
     struct Tax
     {
         int8 rate; // percentage of taxable revenue that gets collected, only member intended to be modified after initialization
-
-        const int8 merchantRevenue; // other members serve to help determine the total taxable quantity
-        const int8 clergyRevenue; // for purposes of calculating tax income
-        const int8 nobleRevenue;
-        const int8 assetRevenue;
-
-        // constructor
+        const int8 maxRate; // highest rate the tax can be set to
     };
 
     // int8 taxJustice = TAX_JUSTICE; // measured on a scale of 1-4, determines strictness of enforcement of taxes, which affects revenue (currently not implemented)
 
-    // helper function with basic formula to determine the income generated by a tax within a year
-    int getRevenue(Tax tax) const;
-    // pre: player object initialized, tax object is member of player object
-    // post: return yearly revenue generated by tax as calculated based on tax rates and targets
-
     // and to change the tax rate
     void adjustRate(int8& oldRate, int8 newRate, int8 minRate, int8 maxRate);
     // pre: player object initialized, tax object is member of player object, min rate is lower than max rate, old rate and new rate inside of rate range
@@ -363,14 +388,15 @@ private:
     void adjustRate(int8& oldRate, int8 newRate) {oldRate = newRate;}
     // alt version of the above with no contract enforcement, easier to use the but less safe
 
-    // tax categories implemented in the game
-    Tax salesTax = {SALES_TAX, MERCHANT_SALES, CLERGY_SALES, NOBLE_SALES, ASSET_SALES}; // generates revenue from: merchants, nobles, public works
-    Tax incomeTax = {INCOME_TAX, MERCHANT_INCOME, CLERGY_INCOME, NOBLE_INCOME, ASSET_INCOME}; // nobles, public works
-    Tax customsTax = {CUSTOMS_TAX, MERCHANT_CUSTOMS, CLERGY_CUSTOMS, NOBLE_CUSTOMS, ASSET_CUSTOMS}; // clergy, nobles, merchants, public works
+    // tax categories implemented in the game (indexed by TaxCategory)
+    Tax taxes[NUM_TAXES] =
+    {{SALES_TAX, MAX_SALES_TAX}, // generates revenue from: merchants, nobles, public works
+    {INCOME_TAX, MAX_INCOME_TAX}, // nobles, public works
+    {CUSTOMS_TAX, MAX_CUSTOMS_TAX}}; // clergy, nobles, merchants, public works
 
     // relative taxation rates compared to starting values
-    float taxLevel() // used to calculate adverse effects on migration
-    {return static_cast<float>(salesTax.rate + incomeTax.rate + customsTax.rate) / (SALES_TAX + INCOME_TAX + CUSTOMS_TAX);}
+    float taxLevel() const // used to calculate adverse effects on migration
+    {return static_cast<float>(taxes[SalesTax].rate + taxes[IncomeTax].rate + taxes[CustomsTax].rate) / (SALES_TAX + INCOME_TAX + CUSTOMS_TAX);}
 
 public:
     /// functions for public read-only access to above members
@@ -387,34 +413,52 @@ public:
 
     // soldier prices
     int16 getSoldierPrice() const {return getPrice(soldiers);} // purchase cost
-    int16 getSoldierPay() const {return SOLDIER_PAY * diffModifier();} // yearly upkeep (per soldier)
+    template <int8 DIFF = 0> int16 getSoldierPay() const {return SOLDIER_PAY * modifier<DIFF>();} // yearly upkeep (per soldier)
 
     // commodity quantities
     int getGrain() const {return grain.owned;}
     int getLand() const {return land.owned;}
+    int getReleasedGrain() const {return releasedGrain;} // released so far this year
 
     // and prices
     int16 getGrainPrice() const {return getPrice(grain);}
     int16 getLandPrice() const {return getPrice(land);}
 
-    // asset quantites
-    int16 getMarkets() const {return marketplace.owned;}
-    int16 getMills() const {return mill.owned;}
-    int16 getCathedrals() const {return cathedral.owned;}
-    int16 getPalaces() const {return palace.owned;}
+    // asset quantites, by registry row
+    int16 getAssets(AssetType type) const {return assets[type];}
+    int16 getTotalAssets() const {return totalAssets();}
 
     // and prices
-    int16 getMarketPrice() const {return getPrice(marketplace);}
-    int16 getMillPrice() const {return getPrice(mill);}
-    int16 getCathedralPrice() const {return getPrice(cathedral);}
-    int16 getPalacePrice() const {return getPrice(palace);}
+    int16 getAssetPrice(AssetType type) const {return getPrice(type);}
 
     // tax rates
-    int16 getSales() const {return salesTax.rate;}
-    int16 getIncome() const {return incomeTax.rate;}
-    int16 getCustoms() const {return customsTax.rate;}
+    int16 getTaxRate(TaxCategory tax) const {return taxes[tax].rate;}
+    int16 getSales() const {return taxes[SalesTax].rate;}
+    int16 getIncome() const {return taxes[IncomeTax].rate;}
+    int16 getCustoms() const {return taxes[CustomsTax].rate;}
     // int8 getJustice() const {return taxJustice;}
 
+    // and the income every tax generates within a year
+    void getTaxRevenues(int revenues[NUM_TAXES]) const;
+    // pre: player object initialized, array has room for every tax category
+    // post: fill the array with the yearly revenue generated by each tax (indexed by TaxCategory) based on tax rates and the town's taxable wealth
+
+    int getStat(TownStat stat) const;
+    // pre: player object initialized
+    // post: return the stat's current value, same as its accessor above
+
+private:
+    friend class TurnHistory; // only undoing and redoing decisions can set stats directly
+    void setStat(TownStat stat, int value);
+    // pre: player object initialized, value held by the stat earlier in the same turn
+    // post: put the stat back to the value (no checks, no program output)
+
+public:
+    void startFrom(const int stats[NUM_TOWN_STATS], int16 yearsLeft);
+    // pre: town hasn't played a turn yet, every value in range for its stat, at least one year left
+    // post: start the town off with the given stats and years left to live instead of the defaults (used by the policy builder to reach states the opening never leads to)
+
+
 
     /// third set and fourth set of members - gameplay mechanics/decisions
     /// public-access functions representing in-game actions or events that can modify the values in the previous section
@@ -428,15 +472,12 @@ public:
     // and buying soldiers
     void buySoldiers(int16 quantity) {buy(soldiers, quantity);}
     // and buying buildings
-    void buyMarket() {buy(marketplace);}
-    void buyMill() {buy(mill);}
-    void buyPalace() {buy(palace);}
-    void buyCathedral() {buy(cathedral);}
+    void buyAsset(AssetType type) {purchase(assets[type], getPrice(type), ASSETS[type].name, 1);}
 
     // adjusting taxes
-    void adjustSales(int8 newRate) {adjustRate(salesTax.rate, newRate, MIN_TAX, MAX_SALES_TAX);}
-    void adjustIncome(int8 newRate) {adjustRate(incomeTax.rate, newRate, MIN_TAX, MAX_INCOME_TAX);}
-    void adjustCustoms(int8 newRate) {adjustRate(customsTax.rate, newRate, MIN_TAX, MAX_CUSTOMS_TAX);}
+    void adjustSales(int8 newRate) {adjustRate(taxes[SalesTax].rate, newRate, MIN_TAX, taxes[SalesTax].maxRate);}
+    void adjustIncome(int8 newRate) {adjustRate(taxes[IncomeTax].rate, newRate, MIN_TAX, taxes[IncomeTax].maxRate);}
+    void adjustCustoms(int8 newRate) {adjustRate(taxes[CustomsTax].rate, newRate, MIN_TAX, taxes[CustomsTax].maxRate);}
     // void adjustJustice(int8 newVal) {adjustRate(taxJustice, newVal, MIN_TAX_JUSTICE, MAX_TAX_JUSTICE);}
 
     // invasion
@@ -445,19 +486,28 @@ public:
     // post: both players lose a random number of soldiers, invading player has chance to take land from opponent, results displayed in program output
 
     // releasing grain
-    int grainDemand() const {return serfs * GRAIN_DEMAND * diffModifier();} // how much grain is needed to be released to feed the population
-    int minRelease() {return (grain.owned * percent(MIN_GRAIN_RELEASE));}
-    int maxRelease() {return (grain.owned * percent(MAX_GRAIN_RELEASE));} // limits on how much grain the player can release (put in public access for usage in program output)
+    template <int8 DIFF = 0> int grainDemand() const {return serfs * GRAIN_DEMAND * modifier<DIFF>();} // how much grain is needed to be released to feed the population
+    int minRelease() const {return (grain.owned * percent(MIN_GRAIN_RELEASE));}
+    int maxRelease() const {return (grain.owned * percent(MAX_GRAIN_RELEASE));} // limits on how much grain the player can release (put in public access for usage in program output)
     void releaseGrain(int quantity);
     // pre: player object initialized, valied quantity parameter between min and max percentage of releasable grain, player isn't dead, game hasn't ended
     // post: deducts the parameter member from the player's grain stash and adds it to the stockpile of released grain
 
-    void printStats();
+    ReleaseProjection projectRelease(int quantity) const;
+    // pre: player object initialized, valid quantity parameter between min and max percentage of releasable grain (preferably)
+    // post: return the expected serf births, deaths, and migration (with variances) if the quantity were released this turn, and the resulting serf population
+    // calculated directly from the population formulas instead of by sampling them (values before rounding down to whole serfs), no changes to the player
+
+    void printStats() {printStats(output()); output().flush();}
     // pre: player object initialized
     // post: display all data values relevant to player's in-game performance (grain, gold, land, populations, assets) in program output
+    void printStats(Report& report) const;
+    // pre: player object initialized
+    // post: add the same stats to the report without writing it out (for building up standings tables)
 
     // go bankrupt
     bool isBankrupt() {return gold < BANKRUPTCY_LIMIT;} // check if the player is bankrupt
+    int getBankruptcies() const {return bankruptcies;} // times the town has gone bankrupt
     void bankruptcy();
     // pre: player object initialized, player gold lower than bankruptcy limit, player isn't dead, game hasn't ended
     // post: if player is bankrupt, player loses all assets in the town and gold gets reset to certain value
@@ -465,59 +515,77 @@ public:
 private:
     /// set of functions (w/ helper formulas) that always get called after every turn as part of the game flow
     /// results can depend on player actions during the turn
+    /// each one is built once for every difficulty level (DIFF, see modifier()) so the year-end engine doesn't have to look up the difficulty modifier in every formula
 
     // population changes
-    int getSerfBirths() const;
+    template <int8 DIFF = 0> int getSerfBirths() const;
     // pre: player object initialized, more than 0 grain released (preferably)
     // post: calculate number of serfs projected to be born in player's town following their turn based on randomized formula involving population and grain release
-    int getSerfDeaths() const;
+    template <int8 DIFF = 0> int getSerfDeaths() const;
     // pre: player object initialized, more than 0 grain released (preferably)
     // post: calculate number of serfs projected to die in player's town following their turn based on randomized formula involving population and grain release
-    int getSerfMigration() const;
+    template <int8 DIFF = 0> int getSerfMigration() const {return getSerfMigration<DIFF>(releasedGrain);}
     // pre: player object initialized, more than 0 grain released (preferably)
     // post: calculate number of serfs projected to move to player's town following their turn based on randomized formula involving grain release
-    void populationChange();
+    template <int8 DIFF = 0> int getSerfMigration(int released) const;
+    // pre: player object initialized
+    // post: same as above for a given total amount of released grain
+    template <int8 DIFF = 0> void populationChange();
     // pre: player object initialized, game hasn't ended for player yet, more than 0 grain released
     // post: take all changes in serf and other populations into effect, display the results and reset released grain to 0
 
     // receive revenues from taxes
-    int getSalesRevenue() const {return getRevenue(salesTax);} // calculate individual revenues
-    int getIncomeRevenue() const {return getRevenue(customsTax);}
-    int getCustomsRevenue() const {return getRevenue(customsTax);}
     void receiveTaxRevenue();
     // pre: player object initalized, game hasn't ended yet for player
-    // post: call functions to calculate revenue generated from taxation, add to treasury and display results in program output
+    // post: calculate revenue generated by all taxes at once, add to treasury and display results in program output
+    void receiveTaxRevenue(const int revenues[NUM_TAXES]);
+    // pre: same as above, revenues calculated from the town's current stats (see getTaxRevenues() and TaxBatch)
+    // post: add the revenues to treasury and display results in program output
 
     // and from assets
-    int getMarketRevenue() const {return getRevenue(marketplace);} // calculate individual revenues
-    int getMillRevenue() const {return getRevenue(mill);}
-    void receiveAssetRevenue();
-    // pre: player object initialized, game hasn't ended yet for player
-    // post: call functions to calculate revenue generated from town buildings, add to treasury and display results in program output
+    void receiveAssetRevenue(const AssetYield& yield);
+    // pre: player object initialized, game hasn't ended yet for player, yield from assetCensus() in the same year-end report
+    // post: add revenue generated from town buildings to treasury and display results in program output (one line per asset type that earns any)
 
     // receive harvest
-    int getHarvest();
+    template <int8 DIFF = 0> int getHarvest();
     // pre: player object initialized,
     // post: calculate amount of grain that the player receives between turns based on formula involving serf populations and randomized variables
-    void receiveHarvest();
+    template <int8 DIFF = 0> void receiveHarvest();
     // pre: player object initialized, game hasn't ended yet for player
     // post: call the getHarvest function to determine an amount of grain to add to the player's reserves, display results in program output
 
     // pay expenses
-    int armyPay() {return getSoldiers() * getSoldierPay();} // calculate amount of gold needed to pay army each turn
-    void paySoldiers();
+    template <int8 DIFF = 0> int armyPay() {return getSoldiers() * getSoldierPay<DIFF>();} // calculate amount of gold needed to pay army each turn
+    template <int8 DIFF = 0> void paySoldiers();
     // pre: player object initialized, game hasn't ended yet for player
     // post: deduct army upkeep from treasury and display results in program output, check if player has become bankrupt from expenses
 
     // lose resources
-    int8 getGrainLoss() {return random(MIN_GRAIN_LOSS, MAX_GRAIN_LOSS) * diffModifier();}
-    void loseGrain();
+    template <int8 DIFF = 0> int8 getGrainLoss() {return random(MIN_GRAIN_LOSS, MAX_GRAIN_LOSS) * modifier<DIFF>();}
+    template <int8 DIFF = 0> void loseGrain();
     // pre: player object initialized, game hasn't ended yet for player
     // post: calculate random percentage of player's grain reserves to get lost between turns, deduct, and display results in program output
 
+    // world events
+    EventWheel events = EventWheel(STARTING_YEAR); // plagues, fires, and the like queued up for future years (see the event scheduler)
+    int8 harvestLoss = 0; // percentage of this year's harvest lost to a harvest failure, reset once the harvest comes in
+
+    template <int8 DIFF = 0> void worldEvents();
+    // pre: player object initialized, game hasn't ended yet for player
+    // post: roll new events for the coming years, then carry out every event due this year, display results in program output
+    template <int8 DIFF = 0> void handleEvent(const WorldEvent& event);
+    // pre: player object initialized, event due this year
+    // post: take the event's effects into account (see WORLD_EVENTS in the parameters file), display results in program output
+
     // commodity prices change
-    void adjustGrainPrice() {adjustPrice(grain);}
-    void adjustLandPrice() {adjustPrice(land);}
+    template <int8 DIFF = 0> void adjustGrainPrice() {adjustPrice<DIFF>(grain);}
+    template <int8 DIFF = 0> void adjustLandPrice() {adjustPrice<DIFF>(land);}
+
+    // the year-end engine
+    template <int8 DIFF> void yearEnd(const int revenues[NUM_TAXES]);
+    // pre: same as turnResults(), DIFF is the player's difficulty
+    // post: run the whole year-end report (see turnResults()) with every formula built for that difficulty
 
 
     /// last section - rank, scoring, and endgame implementation
@@ -527,15 +595,26 @@ private:
     // internal status measurements
     int8 rankIndex = 0; // player rank stored internally as a number corresponding to an index in the const vector of rank structs (see namespace)
     int16 deathYear = STARTING_YEAR + random(MIN_LIFESPAN, MAX_LIFESPAN); // game ends for the player in a random in-game year between two parameter limits if they haven't won yet
+    int8 deferredYears = 0; // whole turns the town owes, played when it gets caught up (see deferTurn())
+    int bankruptcies = 0; // times the town has gone bankrupt (see bankruptcy())
+    int countedBankruptcies = 0; // bankruptcies already counted in the telemetry, which waits for the end of the year so undone ones never get counted
+
+    const std::string& title() const;
+    // pre: player object initialized, valid value for player gender
+    // post: return the title of the player's gender attached to the their in-game rank (no copy, used for reports)
 
 public:
     // all public access to rank data
-    std::string getTitle() const;
+    std::string getTitle() const {return title();}
     // pre: player object initialized, valid value for player gender
     // post: return the title of the player's gender attached to the their in-game rank for program output
+    int8 getRank() const {return rankIndex;} // rank as an index into the rank list
     int getScore() const; // score used to determine increases in rank
     // pre: player object initialized
     // post: return the player's game score as determined by a formula involving all of their other stats
+    void getScoreComponents(int components[NUM_SCORE_COMPONENTS]) const;
+    // pre: player object initialized, array has room for every component
+    // post: fill the array with the score points from each stat (indexed by ScoreComponent), which add up to the score along with the starting score
     bool getPromotion() const;
     // pre: player object initialized
     // post: checks if player's score is higher than the threshold to reach the next rank, return the results
@@ -546,13 +625,41 @@ public:
     // endgame conditions (see above)
     bool won() const {return rankIndex >= MAX_RANK;}
     bool dead() const {return year >= deathYear;}
+    int16 getYearsLeft() const {return deathYear - year;} // years until the player dies (used by the bot policy)
     bool gameEnded() const {return won() || dead();}
 
+    // world events
+    void scheduleEvent(WorldEventType type, int yearsAhead, int magnitude) {events.schedule({type, year + yearsAhead, magnitude});}
+    // pre: player object initialized, yearsAhead at least 1 (events for the current year come out at the next year-end report instead)
+    // post: queue the event for the town's year-end report in that many years
+    int getPendingEvents() const {return events.size();}
+    GameContext& getGame() const {return *game;} // game the town belongs to (bot searches keep their transposition table in it)
+    const EventWheel& getEvents() const {return events;} // every queued event (used by bot searches to tell towns with different futures apart)
+    int8 getHarvestLoss() const {return harvestLoss;}
+
     /// combined super-function that comprises of all functions scheduled to get called between game turns
     /// as well as advancing to the next in-game year and checking if the game has ended (critical to game flow)
     void turnResults();
     // pre: player object initialized, game started, player isn't dead and game hasn't ended (yet), at least one turn finished
     // post: calls all functions for events that take place after a player's turn, increments the year, and checks for endgame conditions, all results displayed in program output
+    void turnResults(const int revenues[NUM_TAXES]);
+    // pre: same as above, revenues calculated from the town's current stats (see TaxBatch)
+    // post: same as above, using the given tax revenues instead of calculating them
+    // picks the year-end engine built for the town's difficulty, the only place where the difficulty gets looked at during the report
+
+    /// fast-forwarded years for towns nobody is looking at (used for bots, see GameContext::deferBotYears)
+    /// a deferred town's stats stay as they were at the end of its last played year until it gets caught up, so anything that reads them has to catch it up first
+    /// (catchUpTowns() in the game flow plays the owed turns, decisions included, for whole groups at once)
+    void deferTurn() {++deferredYears;}
+    // pre: player object initialized, game hasn't ended for the player (as of its last played year)
+    // post: count a whole turn the town owes, to be played when it gets caught up
+    int8 getDeferredYears() const {return deferredYears;}
+    void dropDeferredYears() {deferredYears = 0;}
+    // pre: game has ended for the player
+    // post: forget every owed turn (nothing happens after the game ends)
+    void catchUp(const int revenues[NUM_TAXES]);
+    // pre: at least one deferred year, game hasn't ended for player, the owed turn's decisions made, revenues calculated from the town's current stats (see TaxBatch)
+    // post: run the oldest owed year's year-end report with the given tax revenues
 };
 
 #endif // PLAYER_HPP
@@ -0,0 +1,283 @@
+/*
+Purpose: Build the bot policy tables in botPolicyTable.hpp (see botPolicy.hpp)
+Usage: policyBuilder [simulated years per difficulty] [output file] [random seed]
+    - Plays through many towns taking random policy actions, recording every year's state, action, next state, and change in score
+        - Half the towns start from the opening, the rest from stats and years left picked at random across the state buckets
+          (towns reach the top rank long before their rulers get old, so the opening alone never leads to most states)
+    - Runs value iteration on the recorded transitions and writes the best action for every state as constexpr tables
+        - States no town reached take the action of the nearest state that was reached (fewest bucket steps away)
+        - Prints how many states were reached on each difficulty, and writes nothing (failing with exit code 1) if it's under MIN_POLICY_COVERAGE
+    - Needs an existing botPolicyTable.hpp to compile (any earlier output works, the tables aren't used while building)
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <climits>
+#include <stdexcept>
+#include "botPolicy.hpp"
+#include "player.hpp"
+#include "helperFunctions.hpp"
+
+namespace
+{
+    const int END_STATE = NUM_POLICY_STATES; // stands for every state where the town's game is over (worth nothing afterwards)
+    const int MAX_ITERATIONS = 1000;
+    const double POLICY_DISCOUNT = 0.95; // weight of each later year's score changes (just below 1 so towns that stay in the same state don't add up forever)
+    const double CONVERGED = 0.01; // largest change in any state's value (in score points) for value iteration to stop
+    const int SCATTERED_START_SHARE = 50; // percentage of towns that start from random stats instead of the opening
+    const double MIN_POLICY_COVERAGE = 0.9; // share of every difficulty's states that towns have to reach for the tables to get written
+
+    // bucket limits along every stat of the state, in the order policyState() combines them (the first is the slowest changing)
+    const int NUM_STATE_STATS = 5;
+    const int STATE_BUCKETS[NUM_STATE_STATS] = {GRAIN_BUCKETS, GOLD_BUCKETS, TAX_BUCKETS, ASSET_BUCKETS, YEAR_BUCKETS};
+
+    // split a state index back into its buckets
+    void stateBuckets(int state, int buckets[NUM_STATE_STATS])
+    {
+        for (int i = NUM_STATE_STATS - 1; i >= 0; --i)
+        {
+            buckets[i] = state % STATE_BUCKETS[i];
+            state /= STATE_BUCKETS[i];
+        }
+    }
+
+    // random value in a random bucket, with the first bucket starting at low and the last one ending at high
+    template <typename T>
+    int randomInBucket(const T* limits, int numBuckets, int low, int high)
+    {
+        int index = random(numBuckets - 1);
+        int from = index > 0 ? limits[index - 1] : low;
+        int to = index < numBuckets - 1 ? limits[index] - 1 : high;
+        return random(from, to);
+    }
+
+    // give a town that hasn't played yet stats and years left from random buckets
+    void scatter(Player& town)
+    {
+        int stats[NUM_TOWN_STATS];
+        for (int stat = 0; stat < NUM_TOWN_STATS; ++stat) stats[stat] = town.getStat(static_cast<TownStat>(stat));
+
+        stats[GrainStat] = town.getSerfs() * randomInBucket(GRAIN_PER_SERF_LIMITS, GRAIN_BUCKETS, 0, 2 * GRAIN_PER_SERF_LIMITS[GRAIN_BUCKETS - 2]);
+        stats[GoldStat] = randomInBucket(GOLD_LIMITS, GOLD_BUCKETS, BANKRUPTCY_LIMIT, 2 * GOLD_LIMITS[GOLD_BUCKETS - 2]);
+
+        int taxLevel = randomInBucket(TAX_LEVEL_LIMITS, TAX_BUCKETS, 0, 100);
+        stats[SalesStat] = MAX_SALES_TAX * taxLevel / 100;
+        stats[IncomeStat] = MAX_INCOME_TAX * taxLevel / 100;
+        stats[CustomsStat] = MAX_CUSTOMS_TAX * taxLevel / 100;
+
+        // assets spread at random over every type
+        int assets = randomInBucket(ASSET_LIMITS, ASSET_BUCKETS, 0, 2 * ASSET_LIMITS[ASSET_BUCKETS - 2]);
+        for (int type = 0; type < NUM_ASSETS; ++type) stats[AssetStat + type] = 0;
+        for (int i = 0; i < assets; ++i) ++stats[AssetStat + random(NUM_ASSETS - 1)];
+
+        town.startFrom(stats, randomInBucket(YEARS_LEFT_LIMITS, YEAR_BUCKETS, 1, MAX_LIFESPAN));
+    }
+
+    struct Transition // one simulated year
+    {
+        int state;
+        int action;
+        int next;
+        float reward; // change in score
+    };
+
+    // simulate random policy actions until enough years are recorded
+    void simulate(int difficulty, int years, std::vector<Transition>& transitions)
+    {
+        while (static_cast<int>(transitions.size()) < years)
+        {
+            Player* town = new Player(currentContext(), "Builder", "Town", difficulty, Male);
+            try
+            {
+                if (rollChance(SCATTERED_START_SHARE, 100)) scatter(*town);
+                while (!town->gameEnded() && static_cast<int>(transitions.size()) < years)
+                {
+                    Transition year;
+                    year.state = policyState(*town);
+                    year.action = random(NUM_POLICY_ACTIONS - 1);
+                    int score = town->getScore();
+
+                    // same turn a policy bot takes (without invasions)
+                    applyPolicyAction(*town, year.action);
+                    applyRelease(*town, SolverRelease);
+                    town->turnResults();
+
+                    year.next = town->gameEnded() ? END_STATE : policyState(*town);
+                    year.reward = town->getScore() - score;
+                    transitions.push_back(year);
+                }
+            }
+            catch (FormulaOverflow&) {} // towns that grow past what the game's formulas can handle get dropped partway through
+            delete town;
+        }
+    }
+
+    // find the best action for every state by value iteration over the recorded transitions, returning how many states were reached
+    int solvePolicy(std::vector<Transition>& transitions, int8* policy)
+    {
+        // group transitions by state and action so each pair's outcomes are next to each other
+        std::sort(transitions.begin(), transitions.end(), [](const Transition& a, const Transition& b)
+        {
+            if (a.state != b.state) return a.state < b.state;
+            if (a.action != b.action) return a.action < b.action;
+            return a.next < b.next;
+        });
+
+        // average reward and outcome probabilities for every pair that got tried
+        struct Outcome {int next; double probability;};
+        struct Choice {int state; int action; double reward; int first; int last;}; // outcomes[first, last)
+        std::vector<Outcome> outcomes;
+        std::vector<Choice> choices;
+        for (size_t start = 0; start < transitions.size();)
+        {
+            size_t end = start;
+            double reward = 0;
+            while (end < transitions.size() && transitions[end].state == transitions[start].state && transitions[end].action == transitions[start].action)
+            {
+                reward += transitions[end].reward;
+                ++end;
+            }
+
+            Choice choice = {transitions[start].state, transitions[start].action, reward / (end - start), static_cast<int>(outcomes.size()), 0};
+            for (size_t i = start; i < end;)
+            {
+                size_t same = i;
+                while (same < end && transitions[same].next == transitions[i].next) ++same;
+                outcomes.push_back({transitions[i].next, static_cast<double>(same - i) / (end - start)});
+                i = same;
+            }
+            choice.last = outcomes.size();
+            choices.push_back(choice);
+            start = end;
+        }
+
+        // value iteration
+        const double discount = POLICY_DISCOUNT;
+        std::vector<double> value(NUM_POLICY_STATES + 1, 0), best(NUM_POLICY_STATES + 1);
+        std::fill(policy, policy + NUM_POLICY_STATES, DEFAULT_POLICY_ACTION);
+
+        int iteration = 0;
+        double change;
+        do
+        {
+            std::fill(best.begin(), best.end(), -HUGE_VAL);
+            for (const Choice& c : choices)
+            {
+                double expected = c.reward;
+                for (int i = c.first; i < c.last; ++i) expected += discount * outcomes[i].probability * value[outcomes[i].next];
+                if (expected > best[c.state])
+                {
+                    best[c.state] = expected;
+                    policy[c.state] = c.action;
+                }
+            }
+
+            change = 0;
+            for (int s = 0; s < NUM_POLICY_STATES; ++s)
+            {
+                if (best[s] == -HUGE_VAL) continue; // never reached, stays at 0
+                change = std::max(change, std::abs(best[s] - value[s]));
+                value[s] = best[s];
+            }
+        } while (change > CONVERGED && ++iteration < MAX_ITERATIONS);
+
+        std::cout << "    " << choices.size() << " state/action pairs, converged after " << iteration << " iterations\n";
+
+        // states nobody reached copy the nearest reached state
+        std::vector<int> reached;
+        for (int s = 0; s < NUM_POLICY_STATES; ++s) if (best[s] != -HUGE_VAL) reached.push_back(s);
+        if (reached.empty()) return 0;
+
+        int buckets[NUM_STATE_STATS], other[NUM_STATE_STATS];
+        for (int s = 0; s < NUM_POLICY_STATES; ++s)
+        {
+            if (best[s] != -HUGE_VAL) continue;
+            stateBuckets(s, buckets);
+            int nearest = reached[0], nearestDistance = INT_MAX;
+            for (int r : reached)
+            {
+                stateBuckets(r, other);
+                int distance = 0;
+                for (int i = 0; i < NUM_STATE_STATS; ++i) distance += std::abs(buckets[i] - other[i]);
+                if (distance < nearestDistance)
+                {
+                    nearest = r;
+                    nearestDistance = distance;
+                }
+            }
+            policy[s] = policy[nearest];
+        }
+        return reached.size();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // take settings from command line
+    int years = argc > 1 ? std::stoi(argv[1]) : 4000000;
+    std::string path = argc > 2 ? argv[2] : "botPolicyTable.hpp";
+    unsigned int seed = argc > 3 ? std::stoul(argv[3]) : 2018;
+    seedRandom(seed);
+
+    // towns' own output isn't needed
+    std::ostream muted(nullptr);
+    setGameStreams(std::cin, muted);
+
+    std::vector<Transition> transitions;
+    std::vector<int8> policies(MAX_DIFFICULTY * NUM_POLICY_STATES);
+    double worstCoverage = 1;
+    for (int difficulty = MIN_DIFFICULTY; difficulty <= MAX_DIFFICULTY; ++difficulty)
+    {
+        std::cout << "Difficulty " << difficulty << ": simulating " << years << " years\n";
+        transitions.clear();
+        simulate(difficulty, years, transitions);
+        int reached = solvePolicy(transitions, &policies[(difficulty - 1) * NUM_POLICY_STATES]);
+
+        double coverage = static_cast<double>(reached) / NUM_POLICY_STATES;
+        std::cout << "    reached " << reached << " of " << NUM_POLICY_STATES << " states (" << std::fixed << std::setprecision(1) << coverage * 100 << "%), "
+                  << NUM_POLICY_STATES - reached << " copied from the nearest reached state\n";
+        worstCoverage = std::min(worstCoverage, coverage);
+    }
+    if (worstCoverage < MIN_POLICY_COVERAGE)
+    {
+        std::cerr << "Coverage under " << MIN_POLICY_COVERAGE * 100 << "% on at least one difficulty, not writing " << path << " (simulate more years)\n";
+        return 1;
+    }
+
+    // write out tables
+    std::ostringstream table;
+    table << "#ifndef BOTPOLICYTABLE_HPP\n#define BOTPOLICYTABLE_HPP\n\n"
+          << "// generated by policyBuilder from " << years << " simulated years per difficulty (seed " << seed << "), don't edit by hand\n"
+          << "// towns reached at least " << std::fixed << std::setprecision(1) << worstCoverage * 100 << "% of the states on every difficulty, the rest copy the nearest state that was reached\n"
+          << "// best policy action for every town state on each difficulty (see botPolicy.hpp)\n"
+          << "// only holds for the year-end rules and bot actions it was simulated with, so rebuild it along with any change to them\n\n"
+          << "#include \"botPolicy.hpp\"\n\n"
+          << "constexpr int8 BOT_POLICY[MAX_DIFFICULTY][NUM_POLICY_STATES] =\n{\n";
+    for (int difficulty = 0; difficulty < MAX_DIFFICULTY; ++difficulty)
+    {
+        table << "    { // difficulty " << difficulty + 1;
+        for (int s = 0; s < NUM_POLICY_STATES; ++s)
+        {
+            if (s % 32 == 0) table << "\n        ";
+            table << static_cast<int>(policies[difficulty * NUM_POLICY_STATES + s]) << (s + 1 < NUM_POLICY_STATES ? "," : "");
+        }
+        table << "\n    },\n";
+    }
+    table << "};\n\n#endif // BOTPOLICYTABLE_HPP\n";
+
+    std::ofstream file(path);
+    file << table.str();
+    if (!file)
+    {
+        std::cerr << "Unable to write " << path << '\n';
+        return 1;
+    }
+    std::cout << "Wrote " << path << '\n';
+    return 0;
+}
@@ -0,0 +1,117 @@
+#ifndef QUANTILESKETCH_CPP
+#define QUANTILESKETCH_CPP
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <stdexcept>
+#include "quantileSketch.hpp"
+
+QuantileSketch::QuantileSketch(int sketchSize) : size(sketchSize), levels(1)
+{
+    if (sketchSize < 2) throw std::logic_error("Error: Quantile sketch created with a size below 2.");
+    levels[0].reserve(size);
+}
+
+int QuantileSketch::capacity(int level) const
+{
+    // top level gets the full size, every level below it 2/3 of the one above
+    int depth = static_cast<int>(levels.size()) - 1 - level;
+    int result = std::ceil(size * std::pow(2.0 / 3.0, depth));
+    return result < 2 ? 2 : result;
+}
+
+int QuantileSketch::retainedCapacity() const
+{
+    int total = 0;
+    for (std::size_t level = 0; level < levels.size(); ++level) total += capacity(level);
+    return total;
+}
+
+int QuantileSketch::getRetained() const
+{
+    int total = 0;
+    for (const std::vector<float>& level : levels) total += level.size();
+    return total;
+}
+
+void QuantileSketch::compress()
+{
+    while (getRetained() > retainedCapacity())
+    {
+        // compact the lowest level that's over its capacity
+        int level = 0;
+        while (static_cast<int>(levels[level].size()) < capacity(level)) ++level;
+        if (level + 1 == static_cast<int>(levels.size())) levels.emplace_back(); // new top level (which also shrinks every level's capacity below it)
+
+        std::vector<float>& values = levels[level];
+        std::sort(values.begin(), values.end());
+
+        // an odd value out stays behind so no weight gets lost
+        bool leftover = values.size() % 2;
+        float kept = leftover ? values.back() : 0;
+        if (leftover) values.pop_back();
+
+        // keep every other value, starting at random from the first or second
+        coin ^= coin << 13;
+        coin ^= coin >> 17;
+        coin ^= coin << 5;
+        for (std::size_t i = coin & 1; i < values.size(); i += 2) levels[level + 1].push_back(values[i]);
+
+        values.clear();
+        if (leftover) values.push_back(kept);
+    }
+}
+
+void QuantileSketch::add(float value)
+{
+    if (count == 0 || value < minValue) minValue = value;
+    if (count == 0 || value > maxValue) maxValue = value;
+    ++count;
+
+    levels[0].push_back(value);
+    if (static_cast<int>(levels[0].size()) >= capacity(0)) compress();
+}
+
+void QuantileSketch::merge(const QuantileSketch& other)
+{
+    if (other.size != size) throw std::logic_error("Error: Quantile sketches of different sizes being merged.");
+    if (other.count == 0) return;
+
+    if (count == 0 || other.minValue < minValue) minValue = other.minValue;
+    if (count == 0 || other.maxValue > maxValue) maxValue = other.maxValue;
+    count += other.count;
+
+    // combine level by level, then bring the total back down
+    if (levels.size() < other.levels.size()) levels.resize(other.levels.size());
+    for (std::size_t level = 0; level < other.levels.size(); ++level)
+        levels[level].insert(levels[level].end(), other.levels[level].begin(), other.levels[level].end());
+    compress();
+}
+
+float QuantileSketch::quantile(double fraction) const
+{
+    if (count == 0) throw std::logic_error("Error: Function quantile() called for an empty sketch.");
+    if (fraction < 0 || fraction > 1) throw std::logic_error("Error: Function quantile() called with a fraction outside of 0 to 1.");
+    if (fraction == 0) return minValue;
+    if (fraction == 1) return maxValue;
+
+    // every kept value along with how many added values it stands for, in order
+    std::vector<std::pair<float, long>> weighted;
+    weighted.reserve(getRetained());
+    for (std::size_t level = 0; level < levels.size(); ++level)
+        for (float value : levels[level]) weighted.push_back({value, 1L << level});
+    std::sort(weighted.begin(), weighted.end());
+
+    // first value whose running weight reaches the fraction
+    double target = fraction * count;
+    long seen = 0;
+    for (const std::pair<float, long>& w : weighted)
+    {
+        seen += w.second;
+        if (seen >= target) return w.first;
+    }
+    return maxValue;
+}
+
+#endif // QUANTILESKETCH_CPP
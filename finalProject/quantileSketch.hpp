@@ -0,0 +1,58 @@
+#ifndef QUANTILESKETCH_HPP
+#define QUANTILESKETCH_HPP
+
+/*
+Quantile sketch details
+    - Keeps track of percentiles (median, p90, p99, etc) of a stream of values without keeping all of them (KLL sketch)
+    - Values are kept in levels, where every value at level h stands for 2^h of the values that were added
+        - New values go into the bottom level
+        - A level that fills up gets sorted and compacted: every other value (starting at a random one of the first two) moves up a level, the rest are dropped
+        - Levels get smaller by 2/3 going down from the top (at least 2 values each), so the sketch holds about 3 * SKETCH_SIZE values plus a few per level
+    - Memory only grows with the logarithm of the amount of values, and percentiles are off by about 1/SKETCH_SIZE of their rank
+    - Sketches can be merged (level by level, then compacted), so separate threads can each fill their own and combine them at the end
+*/
+
+#include <vector>
+#include <cstdint>
+#include "parameters.hpp"
+
+class QuantileSketch
+{
+private:
+    int size; // capacity of the top level
+    std::vector<std::vector<float>> levels; // values by level, each one standing for 2^level added values
+    long count = 0; // values added in total (including merged sketches)
+    float minValue = 0, maxValue = 0; // exact extremes
+    uint32_t coin = 0x2018; // random bits for choosing which half of a level to keep (separate from the game's random numbers)
+
+    int capacity(int level) const;
+    // pre: valid level index
+    // post: return how many values the level can hold before it has to get compacted
+    int retainedCapacity() const;
+    // post: return the sum of every level's capacity
+    void compress();
+    // pre: N/A
+    // post: compact levels from the bottom up until the sketch holds no more values than its capacity
+
+public:
+    QuantileSketch(int sketchSize = SKETCH_SIZE);
+    // pre: sketchSize at least 2
+    // post: empty sketch, larger sizes give more accurate percentiles at the cost of more memory
+
+    void add(float value);
+    // pre: N/A
+    // post: count the value towards every percentile
+    void merge(const QuantileSketch& other);
+    // pre: both sketches made with the same size
+    // post: this sketch describes all the values added to either sketch
+
+    float quantile(double fraction) const;
+    // pre: fraction between 0 and 1, at least one value added
+    // post: return an estimate of the value with the given fraction of all values at or below it (0 and 1 give the exact minimum and maximum)
+
+    long getCount() const {return count;}
+    int getRetained() const;
+    // post: return how many values the sketch is holding on to
+};
+
+#endif // QUANTILESKETCH_HPP
@@ -0,0 +1,87 @@
+/*
+Purpose: Check that quantile sketches stay within their rank error, on their own and after merging (see quantileSketch.hpp)
+Usage: quantileSketchTest
+    - Values are a fixed shuffle of 0 to N - 1, so the true rank of a value is the value itself and every run checks the same thing
+    - Returns 0 if every check passes, otherwise prints the ones that failed and returns 1
+*/
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "quantileSketch.hpp"
+#include "testCheck.hpp"
+
+namespace
+{
+    const long NUM_VALUES = 200000;
+    const double FRACTIONS[] = {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99};
+    const double RANK_ERROR = 2.0 / SKETCH_SIZE; // twice the expected error, since a single run can land past it
+
+    std::vector<float> shuffledValues(long count, unsigned int seed)
+    {
+        std::vector<float> values(count);
+        for (long i = 0; i < count; ++i) values[i] = i;
+        std::shuffle(values.begin(), values.end(), std::mt19937(seed));
+        return values;
+    }
+
+    // every percentile's rank within the allowed error of where it should be
+    void checkRanks(const QuantileSketch& sketch, long count, const std::string& name)
+    {
+        check(sketch.getCount() == count, name + ": counts every value");
+        check(sketch.quantile(0) == 0 && sketch.quantile(1) == count - 1, name + ": exact minimum and maximum");
+        for (double fraction : FRACTIONS)
+        {
+            double error = (sketch.quantile(fraction) - fraction * count) / count; // values are their own ranks
+            check(error <= RANK_ERROR && error >= -RANK_ERROR, name + ": rank error at " + std::to_string(fraction) + " is " + std::to_string(error));
+        }
+    }
+
+    void checkSingle()
+    {
+        QuantileSketch sketch;
+        for (float value : shuffledValues(NUM_VALUES, 1)) sketch.add(value);
+        checkRanks(sketch, NUM_VALUES, "single sketch");
+        check(sketch.getRetained() < 4 * SKETCH_SIZE, "single sketch: holds about 3 * SKETCH_SIZE values, not " + std::to_string(sketch.getRetained()));
+    }
+
+    void checkMerge()
+    {
+        // uneven parts, like threads that played different amounts of games
+        std::vector<float> values = shuffledValues(NUM_VALUES, 2);
+        const long parts[] = {0, NUM_VALUES / 10, NUM_VALUES / 2, NUM_VALUES};
+        QuantileSketch total;
+        for (int p = 0; p < 3; ++p)
+        {
+            QuantileSketch part;
+            for (long i = parts[p]; i < parts[p + 1]; ++i) part.add(values[i]);
+            total.merge(part);
+        }
+        checkRanks(total, NUM_VALUES, "merged sketch");
+
+        QuantileSketch empty;
+        total.merge(empty);
+        checkRanks(total, NUM_VALUES, "merged with an empty sketch");
+    }
+
+    void checkErrors()
+    {
+        checkThrows([&] {QuantileSketch tooSmall(1);}, "size below 2 throws");
+
+        QuantileSketch sketch, other(SKETCH_SIZE / 2);
+        other.add(1);
+        checkThrows([&] {sketch.merge(other);}, "merging different sizes throws");
+
+        checkThrows([&] {QuantileSketch().quantile(0.5);}, "percentile of an empty sketch throws");
+    }
+}
+
+int main()
+{
+    checkSingle();
+    checkMerge();
+    checkErrors();
+
+    return testResult("quantile sketch");
+}
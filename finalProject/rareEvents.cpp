@@ -0,0 +1,229 @@
+/*
+Purpose: Estimate the chances of rare disasters for a policy table bot (going bankrupt, or its serfs dying out) with multilevel splitting instead of plain Monte Carlo
+Usage: rareEvents [bankruptcy/collapse] [difficulty] [levels] [towns per level] [replications] [threads] [random seed]
+    - Towns play alone (no invasions) with the same decisions as policy table bots, from the start of the game until it ends for them
+    - The way to the disaster is split into levels the town has to pass one after another, checked at the end of every year:
+        - Bankruptcy: gold at or below evenly spaced steps between 0 and BANKRUPTCY_LIMIT, with going bankrupt as the last level
+        - Collapse: serfs at or below evenly spaced steps (on a log scale) between STARTING_SERFS and COLLAPSE_SHARE of them, which is the last level
+    - Fixed effort splitting: every level gets the same amount of towns
+        - The first level plays towns from the start of the game, and every later one plays copies of towns that reached the level before it (picked at random, with replacement)
+        - Towns stop as soon as they reach the next level (kept for the level after) or their game ends (dropped)
+        - The chance of the disaster is the product of the share of towns that made it through each level, which is unbiased as long as the levels are set up front
+    - Independent replications (spread over the threads) give the estimate's standard error
+    - Then plain Monte Carlo gets the same amount of simulated years, for comparison
+    - Towns that break the game's formulas stop where they are without reaching the disaster, and get counted and reported separately by both methods
+*/
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include "player.hpp"
+#include "botPolicy.hpp"
+#include "gameContext.hpp" // each replication's own state
+#include "helperFunctions.hpp"
+
+namespace
+{
+    const double COLLAPSE_SHARE = 0.05; // serfs left, as a share of the starting serfs, for a town to count as collapsed
+
+    enum Disaster {BankruptcyDisaster, CollapseDisaster};
+
+    // which levels the town is past at the moment (0 to levels, where the last one is the disaster itself)
+    int levelReached(const Player& town, Disaster disaster, int levels)
+    {
+        if (disaster == BankruptcyDisaster)
+        {
+            if (town.getBankruptcies() > 0) return levels;
+            int level = 0;
+            while (level < levels - 1 && town.getGold() <= static_cast<long>(BANKRUPTCY_LIMIT) * (level + 1) / levels) ++level;
+            return level;
+        }
+        else
+        {
+            int level = 0;
+            while (level < levels && town.getSerfs() <= STARTING_SERFS * std::pow(COLLAPSE_SHARE, static_cast<double>(level + 1) / levels)) ++level;
+            return level;
+        }
+    }
+
+    // one year of a policy table bot without rivals, returning false once the town's game has ended or it has broken
+    bool playYear(Player& town, long& years, long& broken)
+    {
+        if (town.gameEnded()) return false;
+        try
+        {
+            applyPolicyAction(town, policyAction(town));
+            applyRelease(town, SolverRelease);
+            town.turnResults();
+        }
+        catch (FormulaOverflow&) // grew past what the game's formulas can handle, stops without reaching the disaster
+        {
+            ++broken;
+            return false;
+        }
+        ++years;
+        return !town.gameEnded();
+    }
+
+    // a single splitting estimate, adding every year it plays to years and every town that breaks to broken
+    double splittingEstimate(Disaster disaster, int difficulty, int levels, int effort, unsigned int seed, long& years, long& broken)
+    {
+        // towns' own output isn't needed
+        std::istringstream noInput;
+        std::ostream muted(nullptr);
+        GameContext game(noInput, muted); // plays every town
+        game.seed(seed);
+        ContextScope scope(game);
+
+        double estimate = 1;
+        std::unique_ptr<GameContext> reached; // towns that reached the previous level, deleted along with their game
+        for (int level = 1; level <= levels; ++level)
+        {
+            std::unique_ptr<GameContext> next(new GameContext(noInput, muted));
+            for (int i = 0; i < effort; ++i)
+            {
+                // a new town for the first level, a copy of a random town that reached the previous level after that
+                std::unique_ptr<Player> town(level == 1 ? new Player(game, "Bot", "Town", difficulty)
+                                                         : new Player(*reached->players[random(reached->players.size() - 1)], game));
+
+                bool playing = true;
+                while (playing && levelReached(*town, disaster, levels) < level) playing = playYear(*town, years, broken);
+                if (levelReached(*town, disaster, levels) >= level) next->players.push_back(new Player(*town, *next));
+            }
+
+            estimate *= static_cast<double>(next->players.size()) / effort;
+            if (next->players.empty()) return 0; // nobody made it, so no point going on
+            reached = std::move(next);
+        }
+        return estimate;
+    }
+
+    // plain Monte Carlo: whole games from the start until the year budget runs out, counting towns that reached the disaster and towns that broke
+    void plainEstimate(Disaster disaster, int difficulty, int levels, long yearBudget, unsigned int seed, long& towns, long& disasters, long& broken)
+    {
+        std::istringstream noInput;
+        std::ostream muted(nullptr);
+        GameContext game(noInput, muted);
+        game.seed(seed);
+        ContextScope scope(game);
+
+        long years = 0;
+        while (years < yearBudget)
+        {
+            Player town(game, "Bot", "Town", difficulty);
+            bool playing = true;
+            while (playing && levelReached(town, disaster, levels) < levels) playing = playYear(town, years, broken);
+            ++towns;
+            if (levelReached(town, disaster, levels) >= levels) ++disasters;
+        }
+    }
+
+    // run a job for every index on every thread at once
+    template <typename Job>
+    void parallel(int count, int numThreads, Job job)
+    {
+        std::atomic<int> next(0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; ++t) threads.emplace_back([&] {for (int i = next++; i < count; i = next++) job(i);});
+        for (std::thread& t : threads) t.join();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // take settings from command line
+    const char* usage = "Usage: rareEvents [bankruptcy/collapse] [difficulty] [levels] [towns per level] [replications] [threads] [random seed]\n";
+    if (argc > 1 && std::string(argv[1]) != "bankruptcy" && std::string(argv[1]) != "collapse")
+    {
+        std::cerr << "The disaster has to be bankruptcy or collapse.\n" << usage;
+        return 1;
+    }
+    Disaster disaster = argc > 1 && std::string(argv[1]) == "collapse" ? CollapseDisaster : BankruptcyDisaster;
+    int difficulty, levels, effort, replications, numThreads;
+    unsigned int seed;
+    try
+    {
+        difficulty = argc > 2 ? std::stoi(argv[2]) : MIN_DIFFICULTY;
+        levels = argc > 3 ? std::stoi(argv[3]) : 6;
+        effort = argc > 4 ? std::stoi(argv[4]) : 1000;
+        replications = argc > 5 ? std::stoi(argv[5]) : 16;
+        numThreads = argc > 6 ? std::stoi(argv[6]) : std::thread::hardware_concurrency();
+        seed = argc > 7 ? std::stoul(argv[7]) : 2018;
+    }
+    catch (std::logic_error&) // invalid_argument or out_of_range
+    {
+        std::cerr << "Settings after the disaster have to be numbers in range.\n" << usage;
+        return 1;
+    }
+    if (difficulty < MIN_DIFFICULTY || difficulty > MAX_DIFFICULTY)
+    {
+        std::cerr << "Difficulty has to be between " << static_cast<int>(MIN_DIFFICULTY) << " and " << static_cast<int>(MAX_DIFFICULTY) << ".\n" << usage;
+        return 1;
+    }
+    if (levels < 1 || effort < 1 || replications < 2)
+    {
+        std::cerr << "Need at least 1 level, 1 town per level, and 2 replications.\n" << usage;
+        return 1;
+    }
+    if (numThreads < 1) numThreads = 1;
+
+    std::cout << "Estimating the chance of " << (disaster == BankruptcyDisaster ? "bankruptcy" : "collapse") << " on difficulty " << difficulty
+              << " with " << levels << " levels of " << effort << " towns, " << replications << " replications on " << numThreads << " threads\n";
+
+    // splitting
+    std::vector<double> estimates(replications);
+    std::vector<long> splitYears(replications, 0), splitBroken(replications, 0);
+    parallel(replications, numThreads, [&](int r) {estimates[r] = splittingEstimate(disaster, difficulty, levels, effort, seed + r, splitYears[r], splitBroken[r]);});
+
+    double mean = 0, variance = 0;
+    long years = 0, splitBrokenTotal = 0;
+    for (int r = 0; r < replications; ++r)
+    {
+        mean += estimates[r] / replications;
+        years += splitYears[r];
+        splitBrokenTotal += splitBroken[r];
+    }
+    for (int r = 0; r < replications; ++r) variance += (estimates[r] - mean) * (estimates[r] - mean) / (replications - 1);
+    double error = std::sqrt(variance / replications);
+
+    std::cout << std::scientific << std::setprecision(3)
+              << "\nSplitting:    " << mean << " +/- " << error << " (standard error), " << years << " simulated years";
+    if (splitBrokenTotal > 0) std::cout << ", " << splitBrokenTotal << " towns broke the formulas on the way";
+    std::cout << '\n';
+
+    // plain Monte Carlo with the same years, split up the same way
+    std::vector<long> plainTowns(replications, 0), plainDisasters(replications, 0), plainBroken(replications, 0);
+    parallel(replications, numThreads, [&](int r) {plainEstimate(disaster, difficulty, levels, splitYears[r], seed + replications + r, plainTowns[r], plainDisasters[r], plainBroken[r]);});
+
+    long towns = 0, disasters = 0, broken = 0;
+    for (int r = 0; r < replications; ++r)
+    {
+        towns += plainTowns[r];
+        disasters += plainDisasters[r];
+        broken += plainBroken[r];
+    }
+    double plain = static_cast<double>(disasters) / towns;
+    std::cout << "Monte Carlo:  " << plain << " +/- " << std::sqrt(plain * (1 - plain) / towns) << " (standard error), "
+              << disasters << " disasters in " << towns << " towns";
+    if (disasters == 0) std::cout << " (below " << 3.0 / towns << " at 95% confidence)";
+    std::cout << '\n';
+    if (broken > 0) std::cout << "              " << broken << " of the towns broke the formulas first (" << static_cast<double>(broken) / towns << "), counted as not reaching it\n";
+
+    // years plain Monte Carlo would need to be as precise as splitting
+    if (mean > 0 && error > 0)
+    {
+        double yearsPerTown = static_cast<double>(years) / towns;
+        double townsNeeded = mean * (1 - mean) / (error * error);
+        std::cout << std::fixed << std::setprecision(0) << "Plain Monte Carlo would need about " << townsNeeded * yearsPerTown << " simulated years for the same standard error ("
+                  << std::setprecision(1) << townsNeeded * yearsPerTown / years << " times as many)\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+#ifndef RELEASESOLVER_CPP
+#define RELEASESOLVER_CPP
+
+#include <climits>
+#include "releaseSolver.hpp"
+#include "player.hpp"
+
+ReleaseObjective releaseObjective(const Player& town, int years)
+{
+    const float modifier = DIFF_MODIFIERS[town.getDifficulty() - 1];
+    const float grainKept = 1 - (MIN_GRAIN_LOSS + MAX_GRAIN_LOSS) / 200.0 * modifier; // share of unreleased grain left after a year of losses
+    const float harvest = (MIN_HARVEST + MAX_HARVEST) / 2.0 / modifier; // average grain harvested by a serf each year
+    const float upkeep = GRAIN_DEMAND * modifier; // grain released each year to keep a serf fed (see Player::grainDemand())
+    const float growth = 1 + (MIN_BIRTH_RATE + MAX_BIRTH_RATE) / 200.0 / modifier
+                         - (MIN_DEATH_RATE + MAX_DEATH_RATE) / 200.0 * modifier; // serfs a serf turns into over a year with the demand met
+    const float birthsPerBushel = 1 / (GRAIN_DEMAND * 2 * modifier); // extra births from each bushel released above the demand
+
+    // last year: stats count for their score values, with grain kept still taking the year's losses
+    ReleaseObjective result = {SERF_VALUE, GRAIN_VALUE * grainKept};
+
+    // every year before it, in terms of the values for the year after
+    for (int year = 1; year < years; ++year)
+    {
+        const float releaseValue = result.serfValue * birthsPerBushel; // a bushel released for births next year
+        ReleaseObjective earlier;
+        earlier.serfValue = (harvest - upkeep) * result.grainValue + growth * result.serfValue;
+        earlier.grainValue = grainKept * (releaseValue > result.grainValue ? releaseValue : result.grainValue);
+        result = earlier;
+    }
+
+    return result;
+}
+
+int releaseHorizon(const Player& town)
+{
+    int years = town.getYearsLeft();
+    if (MAX_RANK - town.getRank() < years) years = MAX_RANK - town.getRank(); // at most one promotion a year
+    return years > 1 ? years : 1;
+}
+
+void ReleaseSolver::setTown(const Player& town, const ReleaseObjective& goal)
+{
+    serfs = town.getSerfs();
+    deathCap = DIFF_MODIFIERS[town.getDifficulty() - 1] > 1 ? serfs / DIFF_MODIFIERS[town.getDifficulty() - 1] : serfs; // see Player::projectRelease()
+    demand = town.grainDemand();
+    alreadyReleased = town.getReleasedGrain();
+    minBirths = serfs * percent(MIN_BIRTH_RATE);
+    maxBirths = serfs * percent(MAX_BIRTH_RATE);
+    minDeaths = serfs * percent(MIN_DEATH_RATE);
+    maxDeaths = serfs * percent(MAX_DEATH_RATE);
+    modifier = DIFF_MODIFIERS[town.getDifficulty() - 1];
+    objective = goal;
+}
+
+void ReleaseSolver::evaluate(const int* releases, float* results, int count) const
+{
+    // town stats as locals so the loop only works on registers and the two arrays
+    const int serfCount = serfs, cap = deathCap, need = demand, released = alreadyReleased;
+    const int lowDeaths = minDeaths, highDeaths = maxDeaths;
+    const float baseBirths = (minBirths + maxBirths) / 2.0f, deathRange = highDeaths - lowDeaths + 1;
+    const float diff = modifier, serfValue = objective.serfValue, grainValue = objective.grainValue;
+
+    // same formulas as Player::projectRelease() (expected values only), written without branches so the compiler can vectorize it
+    for (int i = 0; i < count; ++i)
+    {
+        const int total = released + releases[i];
+
+        // births: average of the random range plus the bonus for grain above demand
+        int bonusBirths = (total - need) / (GRAIN_DEMAND * 2);
+        bonusBirths = bonusBirths < 0 ? 0 : bonusBirths;
+        const float births = (baseBirths + bonusBirths) / diff;
+
+        // deaths: same with the bonus for grain below demand, capped so they can't take out the whole population
+        int bonusDeaths = (need - total) / (GRAIN_DEMAND * 2);
+        bonusDeaths = bonusDeaths < 0 ? 0 : bonusDeaths;
+        int lastUnclamped = cap - bonusDeaths; // highest random draw that stays under the cap
+        lastUnclamped = lastUnclamped > highDeaths ? highDeaths : lastUnclamped;
+        lastUnclamped = lastUnclamped < lowDeaths - 1 ? lowDeaths - 1 : lastUnclamped;
+        const float unclamped = lastUnclamped - lowDeaths + 1;
+        const float deaths = (unclamped * ((lowDeaths + lastUnclamped) / 2.0f + bonusDeaths)
+                              + static_cast<float>(highDeaths - lastUnclamped) * cap) / deathRange * diff;
+
+        // migration: same as Player::getSerfMigration()
+        const int16 surplus = total - need - MIGRATION_REQ;
+        int migrationSteps = surplus / (GRAIN_DEMAND * 3);
+        migrationSteps = migrationSteps < 0 ? 0 : migrationSteps; // no one moves in without a surplus
+        const int migrants = migrationSteps / diff;
+
+        results[i] = serfValue * (serfCount + births - deaths + migrants) - grainValue * releases[i];
+    }
+}
+
+void ReleaseSolver::addSteps(int origin, int period, int from, int to)
+{
+    // first step at or after from (steps are origin plus or minus whole periods)
+    int offset = (from - origin) % period;
+    if (offset < 0) offset += period;
+    int first = offset == 0 ? from : from + period - offset;
+
+    for (int amount = first; amount <= to; amount += period) amounts.push_back(amount);
+}
+
+int ReleaseSolver::solve(const Player& town, const ReleaseObjective& goal)
+{
+    setTown(town, goal);
+    const int low = town.minRelease(), high = town.maxRelease();
+    if (high <= low) return low; // nothing to choose from
+
+    // births, deaths, and migration only change every few bushels, and in between every extra bushel just costs its grain value
+    // so the best amount is either the lowest one or one where one of them steps up
+    // (births only get a bonus above the demand and deaths only below it, so each only steps on its own side)
+    const int demandLeft = demand - alreadyReleased; // amount that meets the demand exactly
+    amounts.clear();
+    amounts.push_back(low);
+    addSteps(demandLeft, GRAIN_DEMAND * 2, demandLeft > low ? demandLeft : low + 1, high); // births
+    addSteps(demandLeft + 1, GRAIN_DEMAND * 2, low + 1, demandLeft < high ? demandLeft : high); // deaths
+
+    // migration: the surplus is an int16 in the formula, so its steps start over every 2^16 bushels (both ways)
+    const int wrap = 1 << 16;
+    int origin = demandLeft + MIGRATION_REQ;
+    origin -= (origin - low) / wrap * wrap;
+    if (origin > low) origin -= wrap; // first start at or below the lowest amount
+    for (; origin <= high; origin += wrap)
+    {
+        const int from = origin > low ? origin : low + 1, to = origin + SHRT_MAX < high ? origin + SHRT_MAX : high; // surplus above 0 until it wraps
+        if (from <= to) addSteps(origin, GRAIN_DEMAND * 3, from, to);
+    }
+
+    values.resize(amounts.size());
+    evaluate(amounts.data(), values.data(), amounts.size());
+
+    int best = 0;
+    for (size_t i = 1; i < amounts.size(); ++i)
+    {
+        if (values[i] > values[best]) best = i;
+    }
+    return amounts[best];
+}
+
+#endif // RELEASESOLVER_CPP
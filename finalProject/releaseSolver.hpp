@@ -0,0 +1,69 @@
+#ifndef RELEASESOLVER_HPP
+#define RELEASESOLVER_HPP
+
+/*
+Grain release solver details
+    - Finds the amount of grain to release that gives a town the best expected score
+    - The release only affects the score through two stats: the grain that's kept and the serf population afterwards
+        - So the objective is (value of a serf) * (expected serfs next year) - (value of a bushel of grain) * (amount released)
+        - The two values come from a ReleaseObjective: what a serf and a bushel kept are worth to the score at the end of the game
+          (a serf harvests grain and has children in the years left, grain kept keeps losing a share every year or gets released later)
+    - Expected serfs come from the same closed-form formulas as Player::projectRelease(), evaluated for many amounts at once in one flat loop
+    - Search: births, deaths, and migration only step up every few bushels, and between steps every extra bushel only costs its grain value,
+      so the best amount is the lowest one or a step, and all of those get evaluated together (about one in five amounts, so it's exact without a full scan)
+*/
+
+#include <vector>
+#include "parameters.hpp"
+
+class Player;
+
+struct ReleaseObjective // score value of the stats a grain release changes
+{
+    float serfValue; // per serf in next year's population
+    float grainValue; // per bushel released
+};
+
+ReleaseObjective releaseObjective(const Player& town, int years = 1);
+// pre: player object initialized, years at least 1
+// post: return stat values for the score once the given amount of years have ended (this one included), worked out backwards from the last year
+// each year before the last, a serf brings in a harvest, eats its share of the grain demand, and grows into next year's serfs at the average birth and death rates,
+// and grain kept loses the average share, then is worth the more of keeping it again or releasing it for births
+// with the default argument, this is the change in next turn's score
+
+int releaseHorizon(const Player& town);
+// pre: player object initialized
+// post: return the soonest the town's game can end in years (this one included): when its ruler dies, or when it reaches the top rank with a promotion every year
+
+class ReleaseSolver
+{
+private:
+    // town stats used by the evaluation loop, set at the start of solve()
+    int serfs, deathCap, demand, alreadyReleased;
+    int minBirths, maxBirths, minDeaths, maxDeaths;
+    float modifier;
+    ReleaseObjective objective;
+
+    // search candidates and their objective values (kept between calls for reuse)
+    std::vector<int> amounts;
+    std::vector<float> values;
+
+    void addSteps(int origin, int period, int from, int to);
+    // pre: period above 0
+    // post: add every amount between from and to that's a whole number of periods away from origin to the candidates
+
+public:
+    void setTown(const Player& town, const ReleaseObjective& goal);
+    // pre: player object initialized
+    // post: take the town's population stats and the objective for the evaluations that follow
+
+    void evaluate(const int* releases, float* results, int count) const;
+    // pre: setTown() called, releases and results hold at least count elements
+    // post: fill results with the objective value of releasing each amount (expected serfs from the same formulas as Player::projectRelease())
+
+    int solve(const Player& town, const ReleaseObjective& goal);
+    // pre: player object initialized
+    // post: return the amount between the town's minimum and maximum release with the best objective value (the grain value has to be above 0, as it is from releaseObjective())
+};
+
+#endif // RELEASESOLVER_HPP
@@ -0,0 +1,92 @@
+/*
+Purpose: Check that the release solver finds the best amount of grain to release, by comparing it with a scan of every allowed amount (see releaseSolver.hpp)
+Usage: releaseSolverTest
+    - Samples town states from games with a fixed seed on every difficulty, with towns taking random policy actions and releases so their stats spread out
+    - Some samples have grain already released that turn, and every sample asks for a random amount of years between next turn's score and the game's end
+    - The solver's amount has to be allowed and worth exactly as much as the best amount the scan found (ties can pick either amount)
+    - Returns 0 if every check passes, otherwise prints the ones that failed and returns 1
+*/
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "releaseSolver.hpp"
+#include "botPolicy.hpp"
+#include "player.hpp"
+#include "gameContext.hpp"
+#include "helperFunctions.hpp"
+#include "testCheck.hpp"
+
+namespace
+{
+    const int SAMPLES_PER_DIFFICULTY = 60;
+    const int MAX_YEARS = 10; // most years asked for, along with the town's own horizon
+    const unsigned int TEST_SEED = 240;
+
+    // solve for the town and compare with every allowed amount
+    void checkTown(const Player& town, int years, ReleaseSolver& solver, const std::string& name)
+    {
+        const ReleaseObjective goal = releaseObjective(town, years);
+        const int chosen = solver.solve(town, goal);
+        const int low = town.minRelease(), high = town.maxRelease();
+        check(chosen >= low && chosen <= high, name + ": amount " + std::to_string(chosen) + " is outside of " + std::to_string(low) + " to " + std::to_string(high));
+
+        // solve() leaves the solver set to this town, so its evaluations use the same stats
+        std::vector<int> amounts;
+        for (int amount = low; amount <= high; ++amount) amounts.push_back(amount);
+        std::vector<float> values(amounts.size());
+        solver.evaluate(amounts.data(), values.data(), amounts.size());
+
+        int best = 0;
+        for (std::size_t i = 1; i < values.size(); ++i) if (values[i] > values[best]) best = i;
+
+        float chosenValue;
+        solver.evaluate(&chosen, &chosenValue, 1);
+        check(chosenValue == values[best], name + ": solver picked " + std::to_string(chosen) + " (worth " + std::to_string(chosenValue) + "), scan found "
+                                           + std::to_string(amounts[best]) + " (worth " + std::to_string(values[best]) + ")");
+    }
+
+    // play towns with random decisions, sampling their states along the way
+    int checkDifficulty(int difficulty, ReleaseSolver& solver)
+    {
+        std::istringstream noInput;
+        std::ostream muted(nullptr);
+        GameContext game(noInput, muted);
+        game.seed(TEST_SEED + difficulty);
+        ContextScope scope(game);
+
+        int samples = 0;
+        while (samples < SAMPLES_PER_DIFFICULTY)
+        {
+            Player town(game, "Bot", "Town", difficulty);
+            while (!town.gameEnded() && samples < SAMPLES_PER_DIFFICULTY)
+            {
+                try
+                {
+                    applyPolicyAction(town, random(0, NUM_POLICY_ACTIONS - 1));
+                    if (rollChance(1, 3) && town.maxRelease() > 0) town.releaseGrain(random(town.minRelease(), town.maxRelease())); // some grain out already
+
+                    const int years = random(1, MAX_YEARS) <= 2 ? releaseHorizon(town) : random(1, MAX_YEARS);
+                    checkTown(town, years, solver, "difficulty " + std::to_string(difficulty) + ", sample " + std::to_string(samples));
+                    ++samples;
+
+                    town.releaseGrain(random(town.minRelease(), town.maxRelease()));
+                    town.turnResults();
+                }
+                catch (FormulaOverflow&) {break;} // start over with a new town
+            }
+        }
+        return samples;
+    }
+}
+
+int main()
+{
+    ReleaseSolver solver; // reused like a bot's, so leftover buffers get checked too
+    int samples = 0;
+    for (int difficulty = MIN_DIFFICULTY; difficulty <= MAX_DIFFICULTY; ++difficulty) samples += checkDifficulty(difficulty, solver);
+
+    std::cout << "Compared " << samples << " town states\n";
+    return testResult("release solver");
+}
@@ -0,0 +1,114 @@
+/*
+Purpose: Play recorded game sessions over again without anyone at the keyboard (see sessionRecorder.hpp)
+Usage: replaySessions [--fast-forward-bots] [session files...]
+    - Record sessions by starting the game with "santaParavia --record [session file]"
+        - Sessions recorded with "--fast-forward-bots" only play out the same when replayed with it too
+    - Every session gets replayed as fast as it can go, with its output thrown away
+    - Reports how long each session took along with a hash of everything it printed
+        - Hashes stay the same between builds unless something changed how the recorded sessions play out, so a set of sessions works as a regression check
+        - Times make the same set of sessions a benchmark of the menus and formulas that real players go through
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include "gameFlow.hpp"
+#include "sessionRecorder.hpp"
+#include "helperFunctions.hpp"
+
+namespace
+{
+    // keeps a running hash (64-bit FNV-1a) of everything written to it instead of storing it
+    class HashingOutput : public std::streambuf
+    {
+    private:
+        uint64_t hash = 0xCBF29CE484222325ull;
+        long long length = 0;
+
+        void add(char c)
+        {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3ull;
+            ++length;
+        }
+
+    protected:
+        int_type overflow(int_type c) override
+        {
+            if (!traits_type::eq_int_type(c, traits_type::eof())) add(traits_type::to_char_type(c));
+            return traits_type::not_eof(c);
+        }
+        std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+            for (std::streamsize i = 0; i < n; ++i) add(s[i]);
+            return n;
+        }
+
+    public:
+        uint64_t getHash() const {return hash;}
+        long long getLength() const {return length;}
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    // same settings as the game takes from the command line
+    int first = 1;
+    if (argc > 1 && std::string(argv[1]) == "--fast-forward-bots")
+    {
+        currentContext().deferBotYears = true;
+        ++first;
+    }
+    if (argc <= first)
+    {
+        std::cerr << "Usage: replaySessions [--fast-forward-bots] [session files...]\n";
+        return 1;
+    }
+
+    int failures = 0;
+    double totalTime = 0;
+    for (int i = first; i < argc; ++i)
+    {
+        std::string path = argv[i];
+        try
+        {
+            SessionReplay replay(path);
+            std::istream input(&replay);
+            input.exceptions(std::ios::badbit); // lets SessionEnded escape the input functions
+            HashingOutput hashing;
+            std::ostream output(&hashing);
+
+            // same starting point as the recorded run
+            seedRandom(replay.getSeed());
+            setGameStreams(input, output);
+
+            auto start = std::chrono::steady_clock::now();
+            std::string ending = "quit";
+            try
+            {
+                mainMenu();
+            }
+            catch (SessionEnded) {ending = "input ended";} // session was cut off partway through
+            catch (std::exception& error) {ending = std::string("error: ") + error.what();}
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            totalTime += seconds;
+
+            setGameStreams(std::cin, std::cout);
+            std::cout << path << ": " << replay.getInputSize() << " bytes of input, " << hashing.getLength() << " bytes of output, "
+                      << std::fixed << std::setprecision(3) << seconds * 1000 << " ms, output hash "
+                      << std::hex << std::setw(16) << std::setfill('0') << hashing.getHash() << std::dec << std::setfill(' ')
+                      << " (" << ending << ")\n";
+        }
+        catch (std::runtime_error& error)
+        {
+            setGameStreams(std::cin, std::cout);
+            std::cerr << error.what() << '\n';
+            ++failures;
+        }
+    }
+
+    std::cout << "Replayed " << argc - first - failures << " sessions in " << std::fixed << std::setprecision(3) << totalTime * 1000 << " ms\n";
+    return failures > 0;
+}
@@ -0,0 +1,95 @@
+#ifndef REPORT_CPP
+#define REPORT_CPP
+
+#include <iostream>
+#include <cstdio>
+#include <cerrno>
+#include <unistd.h>
+#include "report.hpp"
+#include "helperFunctions.hpp" // game output stream
+#include "gameContext.hpp" // current game
+
+namespace
+{
+    // two-digit lookup table for integer formatting ("00", "01", ... "99")
+    const char DIGIT_PAIRS[] =
+        "00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839" "40414243444546474849"
+        "50515253545556575859" "60616263646566676869" "70717273747576777879" "80818283848586878889" "90919293949596979899";
+}
+
+Report& Report::operator<<(int value)
+{
+    char digits[12]; // enough for any int with its sign
+    char* end = digits + sizeof(digits);
+    char* start = end;
+
+    // work with the magnitude as unsigned so the lowest int doesn't overflow
+    unsigned int magnitude = value < 0 ? 0u - static_cast<unsigned int>(value) : value;
+
+    // fill in digits from the back, two at a time
+    while (magnitude >= 100)
+    {
+        unsigned int pair = (magnitude % 100) * 2;
+        magnitude /= 100;
+        *--start = DIGIT_PAIRS[pair + 1];
+        *--start = DIGIT_PAIRS[pair];
+    }
+    if (magnitude >= 10)
+    {
+        *--start = DIGIT_PAIRS[magnitude * 2 + 1];
+        *--start = DIGIT_PAIRS[magnitude * 2];
+    }
+    else *--start = '0' + magnitude;
+
+    if (value < 0) *--start = '-';
+
+    buffer.append(start, end - start);
+    return *this;
+}
+
+void Report::flush()
+{
+    if (buffer.empty()) return;
+
+    std::ostream& out = target ? **target : gameOutput();
+    if (&out == &std::cout)
+    {
+        static const bool terminal = isatty(STDOUT_FILENO); // terminals are line-buffered, files and pipes aren't
+        std::cout.flush();
+
+        if (!terminal)
+        {
+            // stdio already collects output into large blocks here, one copy into it is enough
+            std::fwrite(buffer.data(), 1, buffer.size(), stdout);
+            buffer.clear();
+            return;
+        }
+
+        // write straight to the terminal, after anything still sitting in the stream buffers
+        std::fflush(stdout);
+
+        const char* data = buffer.data();
+        size_t remaining = buffer.size();
+        while (remaining > 0)
+        {
+            ssize_t written = write(STDOUT_FILENO, data, remaining);
+            if (written < 0)
+            {
+                if (errno == EINTR) continue;
+                break; // output closed, nothing else to do
+            }
+            data += written;
+            remaining -= written;
+        }
+    }
+    else out.write(buffer.data(), buffer.size()); // redirected output (e.g. game host sessions)
+
+    buffer.clear();
+}
+
+Report& consoleReport()
+{
+    return currentContext().report; // one per game, like the game streams
+}
+
+#endif // REPORT_CPP
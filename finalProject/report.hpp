@@ -0,0 +1,43 @@
+#ifndef REPORT_HPP
+#define REPORT_HPP
+
+#include <string>
+#include <iosfwd>
+
+/// buffered formatter for game output (annual reports, stats, standings, and action results)
+/// text gets built up in a buffer that's reused between reports and written out all at once with flush()
+/// formatting matches what std::ostream would produce for the same values
+
+class Report
+{
+private:
+    std::string buffer; // text waiting to be written, keeps its capacity between reports
+    std::ostream* const* target; // where flush() writes to (follows the owner's stream if it gets redirected), the game output if null
+
+public:
+    Report(std::ostream* const* t = nullptr) : target(t) {buffer.reserve(4096);} // enough for a full annual report without reallocating
+
+    // append text and values
+    Report& operator<<(const std::string& text) {buffer.append(text); return *this;}
+    Report& operator<<(const char* text) {buffer.append(text); return *this;}
+    Report& operator<<(char c) {buffer.push_back(c); return *this;}
+    Report& operator<<(unsigned char c) {buffer.push_back(c); return *this;} // written as a character like std::ostream does (int8 values)
+    Report& operator<<(int value);
+    // pre: N/A
+    // post: append decimal representation of value to the buffer
+
+    const std::string& text() const {return buffer;} // contents that haven't been written yet
+    void clear() {buffer.clear();} // discard contents without writing them
+
+    void flush();
+    // pre: N/A
+    // post: write all buffered text to the report's target (the game output by default, see gameOutput()) in a single write and clear the buffer
+    // terminal output gets written with one system call
+};
+
+Report& consoleReport();
+// pre: N/A
+// post: return the report shared by all output of the game running on the current thread (see GameContext)
+// output gets written out by whichever action started it (turnResults, printStats, buy, etc) so it all comes out in one piece
+
+#endif // REPORT_HPP
@@ -0,0 +1,59 @@
+#ifndef SESSIONRECORDER_CPP
+#define SESSIONRECORDER_CPP
+
+#include <sstream>
+#include <stdexcept>
+#include "sessionRecorder.hpp"
+
+/// recording
+
+SessionRecorder::SessionRecorder(std::streambuf* input, const std::string& path, unsigned int seed) : source(input), file(path, std::ios::binary)
+{
+    if (!file) throw std::runtime_error("Unable to write session file " + path + ".");
+    file << SESSION_HEADER << seed << '\n';
+    file.flush();
+}
+
+SessionRecorder::int_type SessionRecorder::underflow()
+{
+    if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+
+    // one character at a time, so nothing gets recorded before the game actually asks for it
+    int_type c = source->sbumpc();
+    if (traits_type::eq_int_type(c, traits_type::eof())) return c;
+
+    current = traits_type::to_char_type(c);
+    file.put(current);
+    if (current == '\n') file.flush();
+
+    setg(&current, &current, &current + 1);
+    return c;
+}
+
+
+/// replaying
+
+SessionReplay::SessionReplay(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("Unable to read session file " + path + ".");
+
+    std::string header;
+    getline(file, header);
+    if (header.compare(0, SESSION_HEADER.size(), SESSION_HEADER) != 0)
+        throw std::runtime_error(path + " isn't a session file.");
+    seed = std::stoul(header.substr(SESSION_HEADER.size()));
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    input = contents.str();
+    setg(&input[0], &input[0], &input[0] + input.size());
+}
+
+SessionReplay::int_type SessionReplay::underflow()
+{
+    if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+    throw SessionEnded(); // all of the recorded input has been used up
+}
+
+#endif // SESSIONRECORDER_CPP
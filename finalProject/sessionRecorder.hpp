@@ -0,0 +1,62 @@
+#ifndef SESSIONRECORDER_HPP
+#define SESSIONRECORDER_HPP
+
+/*
+Session recording details
+    - A session file holds everything needed to play a game session over again exactly the same way
+        - First line: the random seed the session started from (see seedRandom())
+        - Everything after that: the players' input exactly as it was typed (menu choices, quantities, names, and ENTER presses alike)
+    - Recording sits between the game and its real input: everything the game reads gets copied into the file as it comes in
+        - The file gets flushed after every line, so sessions that get cut off partway can still be replayed up to that point
+    - Replaying feeds the recorded input back into the game through the same input functions, with the same seed
+        - Once the recorded input runs out, the replay ends by throwing SessionEnded out of the game
+        - Settings from the command line aren't in the file (see replaySessions.cpp for the ones it can take)
+        - Hard bots limited by time (see SearchBudget) can search to different depths on different runs, so sessions with them aren't guaranteed to play out the same
+*/
+
+#include <string>
+#include <fstream>
+#include <streambuf>
+
+const std::string SESSION_HEADER = "Santa Paravia session, seed "; // start of the first line of every session file
+
+struct SessionEnded {}; // thrown out of a replayed game when its input runs out, not derived from std::exception so the input functions don't catch it
+
+// copies everything read from another stream buffer into a session file
+class SessionRecorder : public std::streambuf
+{
+private:
+    std::streambuf* source; // real input
+    std::ofstream file;
+    char current; // character being read by the game
+
+protected:
+    int_type underflow() override;
+
+public:
+    SessionRecorder(std::streambuf* input, const std::string& path, unsigned int seed);
+    // pre: valid stream buffer for input
+    // post: session file created at path with the seed written to it, throws std::runtime_error if the file can't be written
+};
+
+// plays the input from a session file back to the game
+class SessionReplay : public std::streambuf
+{
+private:
+    unsigned int seed;
+    std::string input; // recorded input after the header
+
+protected:
+    int_type underflow() override;
+    // post: throws SessionEnded once all of the recorded input has been read
+
+public:
+    SessionReplay(const std::string& path);
+    // pre: N/A
+    // post: session file loaded, throws std::runtime_error if the file can't be read or isn't a session file
+
+    unsigned int getSeed() const {return seed;}
+    size_t getInputSize() const {return input.size();}
+};
+
+#endif // SESSIONRECORDER_HPP
@@ -0,0 +1,35 @@
+#ifndef SHARDRING_CPP
+#define SHARDRING_CPP
+
+#include "shardRing.hpp"
+
+bool ShardRing::push(const ShardMessage& message)
+{
+    uint32_t position = pushed.load(std::memory_order_relaxed); // only this side writes it
+    if (position - popped.load(std::memory_order_acquire) == SHARD_RING_CAPACITY) return false; // full (positions wrap around together)
+
+    messages[position & (SHARD_RING_CAPACITY - 1)] = message;
+    pushed.store(position + 1, std::memory_order_release); // publishes the message
+    return true;
+}
+
+bool ShardRing::peek(ShardMessage& message) const
+{
+    uint32_t position = popped.load(std::memory_order_relaxed);
+    if (position == pushed.load(std::memory_order_acquire)) return false;
+
+    message = messages[position & (SHARD_RING_CAPACITY - 1)];
+    return true;
+}
+
+bool ShardRing::pop(ShardMessage& message)
+{
+    uint32_t position = popped.load(std::memory_order_relaxed); // only this side writes it
+    if (position == pushed.load(std::memory_order_acquire)) return false; // empty
+
+    message = messages[position & (SHARD_RING_CAPACITY - 1)];
+    popped.store(position + 1, std::memory_order_release); // frees the slot
+    return true;
+}
+
+#endif // SHARDRING_CPP
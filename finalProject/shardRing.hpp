@@ -0,0 +1,55 @@
+#ifndef SHARDRING_HPP
+#define SHARDRING_HPP
+
+/*
+Shard ring details
+    - Fixed-size queue of messages from one worker process to another, living in memory shared between them (see shardedWorld.cpp)
+        - Invasions and grain shipments between towns in different shards, delivered at the start of the receiving shard's next year
+    - Single producer, single consumer: only the sending shard pushes and only the receiving shard pops, so neither ever waits on the other
+        - The two positions are lock-free atomics (address-free, so they work between processes), each one only ever written by its own side
+        - A message is written before the push position moves past it, and read before the pop position does, so neither side sees half of a message
+    - No pointers inside, so the ring works wherever it gets mapped and can be set up before the workers get forked
+*/
+
+#include <atomic>
+#include <cstdint>
+
+namespace /// constant parameters for shard rings
+{
+    const uint32_t SHARD_RING_CAPACITY = 4096; // messages waiting at once (power of 2), pushes fail past this
+}
+
+enum ShardMessageType {InvasionMessage, ShipmentMessage};
+
+struct ShardMessage
+{
+    ShardMessageType type;
+    int year; // sent at the end of this year (messages only get delivered once everyone has finished it)
+    int town; // receiving town (world index), -1 for whichever town needs it most
+    int source; // sending town (world index)
+    int amount; // invading soldiers, or grain shipped
+};
+
+class ShardRing
+{
+private:
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shard rings need lock-free atomics to work between processes.");
+
+    std::atomic<uint32_t> pushed {0}; // messages ever pushed (only written by the sender)
+    std::atomic<uint32_t> popped {0}; // messages ever popped (only written by the receiver)
+    ShardMessage messages[SHARD_RING_CAPACITY];
+
+public:
+    bool push(const ShardMessage& message);
+    // pre: only called by the ring's sending shard
+    // post: add the message to the end of the ring and return true, false if the ring is full (message dropped)
+
+    bool peek(ShardMessage& message) const;
+    // pre: only called by the ring's receiving shard
+    // post: copy the oldest message into the parameter and return true without removing it, false if the ring is empty
+    bool pop(ShardMessage& message);
+    // pre: only called by the ring's receiving shard
+    // post: move the oldest message into the parameter and return true, false if the ring is empty
+};
+
+#endif // SHARDRING_HPP
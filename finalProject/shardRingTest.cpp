@@ -0,0 +1,110 @@
+/*
+Purpose: Check that shard rings hand messages over in order, refuse pushes when full and pops when empty, and keep working as positions wrap around the ring (see shardRing.hpp)
+Usage: shardRingTest
+    - Single-threaded checks of every edge, then a sender and a receiver on two threads passing many times the ring's capacity through it
+    - Returns 0 if every check passes, otherwise prints the ones that failed and returns 1
+*/
+
+#include <thread>
+#include <memory>
+#include "shardRing.hpp"
+#include "testCheck.hpp"
+
+namespace
+{
+    const int NUM_THREADED = 1000000; // messages passed between threads
+
+    ShardMessage numbered(int n) {return {n % 2 ? InvasionMessage : ShipmentMessage, n, n + 1, n + 2, n + 3};}
+
+    bool isNumbered(const ShardMessage& message, int n)
+    {
+        ShardMessage expected = numbered(n);
+        return message.type == expected.type && message.year == expected.year && message.town == expected.town
+            && message.source == expected.source && message.amount == expected.amount;
+    }
+
+    void checkEmpty()
+    {
+        std::unique_ptr<ShardRing> ring(new ShardRing); // too big for the stack
+        ShardMessage message;
+        check(!ring->peek(message) && !ring->pop(message), "new ring is empty");
+
+        ring->push(numbered(7));
+        check(ring->peek(message) && isNumbered(message, 7), "peek sees the message");
+        check(ring->pop(message) && isNumbered(message, 7), "pop takes the message peek saw");
+        check(!ring->peek(message) && !ring->pop(message), "ring is empty again after popping everything");
+    }
+
+    void checkFull()
+    {
+        std::unique_ptr<ShardRing> ring(new ShardRing);
+        bool pushed = true;
+        for (uint32_t i = 0; i < SHARD_RING_CAPACITY; ++i) pushed = pushed && ring->push(numbered(i));
+        check(pushed, "ring takes SHARD_RING_CAPACITY messages");
+        check(!ring->push(numbered(-1)), "push to a full ring fails");
+
+        ShardMessage message;
+        check(ring->pop(message) && isNumbered(message, 0), "full ring pops its oldest message");
+        check(ring->push(numbered(SHARD_RING_CAPACITY)), "popping one makes room for one");
+        check(!ring->push(numbered(-1)), "and only one");
+
+        bool inOrder = true;
+        for (uint32_t i = 1; i <= SHARD_RING_CAPACITY; ++i) inOrder = inOrder && ring->pop(message) && isNumbered(message, i);
+        check(inOrder, "full ring gives back every message in order, none lost to the failed pushes");
+        check(!ring->pop(message), "ring is empty after draining a full one");
+    }
+
+    void checkWrapAround()
+    {
+        // keep the ring partly full while positions go around it several times, at an offset that doesn't divide the capacity
+        std::unique_ptr<ShardRing> ring(new ShardRing);
+        const int backlog = SHARD_RING_CAPACITY / 3 + 5;
+        int next = 0, expected = 0;
+        bool ok = true;
+        for (int i = 0; i < backlog; ++i) ok = ok && ring->push(numbered(next++));
+        ShardMessage message;
+        while (next < static_cast<int>(SHARD_RING_CAPACITY) * 5)
+        {
+            ok = ok && ring->push(numbered(next++)) && ring->pop(message) && isNumbered(message, expected++);
+            if (next % 1000 == 0) // fill up every now and then, so the full check runs at wrapped positions too
+            {
+                while (ring->push(numbered(next))) ++next;
+                while (expected < next - backlog) ok = ok && ring->pop(message) && isNumbered(message, expected++);
+            }
+        }
+        while (ring->pop(message)) ok = ok && isNumbered(message, expected++);
+        check(ok && expected == next, "messages stay in order as positions wrap around the ring");
+    }
+
+    void checkThreads()
+    {
+        // one sender and one receiver, like two shards, retrying whenever the ring is full or empty
+        std::unique_ptr<ShardRing> ring(new ShardRing);
+        std::thread sender([&]
+        {
+            for (int i = 0; i < NUM_THREADED; ++i)
+                while (!ring->push(numbered(i))) std::this_thread::yield();
+        });
+
+        bool inOrder = true;
+        ShardMessage message;
+        for (int i = 0; i < NUM_THREADED; ++i)
+        {
+            while (!ring->pop(message)) std::this_thread::yield();
+            if (!isNumbered(message, i)) inOrder = false;
+        }
+        sender.join();
+        check(inOrder, "messages between threads arrive whole and in order");
+        check(!ring->pop(message), "nothing left after the receiver takes every message");
+    }
+}
+
+int main()
+{
+    checkEmpty();
+    checkFull();
+    checkWrapAround();
+    checkThreads();
+
+    return testResult("shard ring");
+}
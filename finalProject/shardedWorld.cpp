@@ -0,0 +1,397 @@
+/*
+Purpose: Play one very large world of bot towns split across worker processes on a single host, and report how the whole world did year by year
+Usage: shardedWorld [towns] [shards] [years] [random seed]
+    - Every shard is a forked worker process with its own block of towns, game context, and heap, so shards never contend for an allocator
+      and a shard that crashes only takes its own towns with it (the rest keep playing, see below)
+    - Towns take the same turns as in the tournament (policy table actions, random invasions, solver grain releases) for the given amount of years
+        - Towns with more grain than they'll need for SHIPMENT_RESERVE years ship half of the rest to a random other shard, where the town shortest on grain buys it
+        - Invasions can target any town in the world
+    - Everything between shards goes through shared memory mapped before the workers get forked, nothing goes over a network stack:
+        - Invasions and shipments for another shard go into a ring from the sending shard to the receiving one (see shardRing.hpp)
+          and get delivered at the start of the receiving shard's next year (invading armies arrive as raids, see Player::worldEvents())
+        - Every shard writes its results for each year into its own row of a shared table, which the orchestrator adds up at the end
+        - Shards wait for each other at the end of every year, so a year's messages are all sent before anyone delivers them
+          (the world plays out the same for the same seed and shard count, unless a ring fills up)
+    - Towns that break the game's formulas stop playing (counted every year), the rest of their shard carries on
+    - The orchestrator watches its workers, and marks any that die as failed so the others stop waiting for them
+        - A shard that keeps everyone waiting for BARRIER_TIMEOUT seconds gets marked as failed by whoever was waiting, and the orchestrator stops its worker
+    - Linux (or anything else with fork() and anonymous shared mappings) only
+*/
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <queue>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <new>
+#include <stdexcept>
+#include <csignal>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "player.hpp"
+#include "botPolicy.hpp" // bot turns
+#include "shardRing.hpp" // messages between shards
+#include "gameContext.hpp" // each shard's own game
+#include "helperFunctions.hpp"
+
+namespace
+{
+    const int MAX_SHARDS = 64;
+    const int SHIPMENT_RESERVE = 3; // years of grain demand a town keeps before shipping any away
+    const int BARRIER_TIMEOUT = 60; // seconds a shard waits for another to finish a year before giving up on it
+
+    struct ShardYear // one shard's results for a year (only written by that shard)
+    {
+        int towns; // still playing at the start of the year
+        long long score; // totals at the end of the year, over every town in the shard (including the ones that stopped playing)
+        long long gold;
+        int invasions; // launched by the shard's towns
+        int remoteInvasions; // of those, the ones sent to other shards
+        int shipments; // grain shipments sent to other shards
+        int delivered; // messages from other shards delivered
+        int dropped; // messages that didn't fit in their ring
+        int broken; // towns that broke the game's formulas during the year
+    };
+
+    struct SharedHeader // start of the shared region, followed by every shard's results and then the rings
+    {
+        std::atomic<int> progress[MAX_SHARDS]; // years each shard has finished
+        std::atomic<int> failed[MAX_SHARDS]; // set by the orchestrator once a shard's worker dies, or by a shard that timed out waiting for it
+    };
+
+    // the shared region, as seen from any process
+    class SharedWorld
+    {
+    private:
+        void* region;
+        std::size_t length;
+        int shards, years;
+        std::size_t resultsOffset, ringsOffset;
+
+    public:
+        SharedWorld(int s, int y) : shards(s), years(y)
+        {
+            resultsOffset = sizeof(SharedHeader);
+            ringsOffset = resultsOffset + sizeof(ShardYear) * shards * years;
+            ringsOffset = (ringsOffset + alignof(ShardRing) - 1) / alignof(ShardRing) * alignof(ShardRing);
+            length = ringsOffset + sizeof(ShardRing) * shards * shards;
+
+            // anonymous shared mapping, inherited by every worker forked afterwards (starts out zeroed)
+            region = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+            if (region == MAP_FAILED) throw std::runtime_error("Unable to map " + std::to_string(length) + " bytes of shared memory.");
+
+            SharedHeader* h = new (region) SharedHeader;
+            for (int shard = 0; shard < MAX_SHARDS; ++shard)
+            {
+                h->progress[shard].store(0);
+                h->failed[shard].store(0);
+            }
+            for (int ring = 0; ring < shards * shards; ++ring) new (static_cast<char*>(region) + ringsOffset + sizeof(ShardRing) * ring) ShardRing;
+        }
+        ~SharedWorld() {munmap(region, length);}
+        SharedWorld(const SharedWorld&) = delete;
+        SharedWorld& operator=(const SharedWorld&) = delete;
+
+        SharedHeader& header() {return *static_cast<SharedHeader*>(region);}
+        ShardYear& result(int shard, int year) {return reinterpret_cast<ShardYear*>(static_cast<char*>(region) + resultsOffset)[shard * years + year];}
+        ShardRing& ring(int from, int to) {return reinterpret_cast<ShardRing*>(static_cast<char*>(region) + ringsOffset)[from * shards + to];}
+        std::size_t size() const {return length;}
+    };
+
+    // towns are split into contiguous blocks, one per shard
+    int firstTown(int shard, int shards, int towns) {return static_cast<long long>(towns) * shard / shards;}
+    int shardOf(int town, int shards, int towns)
+    {
+        int shard = static_cast<long long>(town) * shards / towns;
+        while (firstTown(shard, shards, towns) > town) --shard;
+        while (firstTown(shard + 1, shards, towns) <= town) ++shard;
+        return shard;
+    }
+
+    // ordering for the queue of grain buyers, so the town with the least grain per serf comes first
+    bool hasMoreGrain(const Player* a, const Player* b)
+    {
+        return static_cast<long long>(a->getGrain()) * b->getSerfs() > static_cast<long long>(b->getGrain()) * a->getSerfs();
+    }
+
+    // run something on a single town, marking only that town as broken if it outgrows the game's formulas (anything else takes the shard down)
+    template <typename Action>
+    void forTown(std::vector<bool>& broken, int i, int& numBroken, Action action)
+    {
+        try {action();}
+        catch (FormulaOverflow&) // grew past what the game's formulas can handle
+        {
+            broken[i] = true;
+            ++numBroken;
+        }
+    }
+
+    // everything a single worker process does
+    void runShard(SharedWorld& world, int shard, int shards, int numTowns, int years, unsigned int seed)
+    {
+        // towns' own output isn't needed
+        std::istringstream noInput;
+        std::ostream muted(nullptr);
+        GameContext game(noInput, muted);
+        game.seed(seed + shard);
+        ContextScope scope(game);
+
+        const int first = firstTown(shard, shards, numTowns);
+        const int last = firstTown(shard + 1, shards, numTowns);
+        playerVector& towns = game.players;
+        for (int town = first; town < last; ++town)
+            towns.push_back(new Player(game, "Ruler", "Town " + std::to_string(town + 1), random(MIN_DIFFICULTY, MAX_DIFFICULTY))); // deleted along with the game
+
+        // towns that threw, left as they were and skipped like towns whose games have ended
+        std::vector<bool> broken(towns.size(), false);
+        auto playing = [&](int i) {return !broken[i] && !towns[i]->gameEnded();};
+
+        SharedHeader& header = world.header();
+        for (int year = 0; year < years; ++year)
+        {
+            ShardYear results {};
+
+            // deliver last year's messages from every other shard
+            auto moreGrain = [&](int a, int b) {return hasMoreGrain(towns[a], towns[b]);};
+            std::priority_queue<int, std::vector<int>, decltype(moreGrain)> buyers(moreGrain); // shard indexes, filled on the first shipment
+            bool buyersReady = false;
+            for (int from = 0; from < shards; ++from)
+            {
+                ShardRing& ring = world.ring(from, shard);
+                ShardMessage message;
+                while (ring.peek(message) && message.year < year)
+                {
+                    ring.pop(message);
+                    ++results.delivered;
+                    if (message.type == InvasionMessage)
+                    {
+                        int target = message.town - first;
+                        if (playing(target)) forTown(broken, target, results.broken, [&] {towns[target]->scheduleEvent(RaidEvent, 1, message.amount);}); // the army arrives next year
+                        continue;
+                    }
+
+                    // whoever has the least grain per serf buys as much as they can afford
+                    if (!buyersReady)
+                    {
+                        for (int i = 0; i < last - first; ++i) if (playing(i)) buyers.push(i);
+                        buyersReady = true;
+                    }
+                    while (!buyers.empty())
+                    {
+                        int index = buyers.top();
+                        Player* buyer = towns[index];
+                        buyers.pop();
+                        int price = buyer->getGrainPrice();
+                        int quantity = message.amount;
+                        if (quantity > GRAIN_PURCHASE_LIMIT) quantity = GRAIN_PURCHASE_LIMIT;
+                        if (price > 0 && quantity > (buyer->getGold() - 1) / price) quantity = (buyer->getGold() - 1) / price; // never into debt
+                        if (price <= 0 || quantity <= 0) continue; // can't buy anything this year, ask the next neediest
+
+                        forTown(broken, index, results.broken, [&] {buyer->buyGrain(quantity);});
+                        if (!broken[index]) buyers.push(index); // back in line with its new grain
+                        break;
+                    }
+                }
+            }
+
+            // every town's turn
+            for (int i = 0; i < last - first; ++i)
+            {
+                if (!playing(i)) continue;
+                Player* town = towns[i];
+                ++results.towns;
+
+                forTown(broken, i, results.broken, [&]
+                {
+                    applyPolicyAction(*town, policyAction(*town));
+
+                    // invade any town in the world
+                    if (rollChance(game.botAggression, 100))
+                    {
+                        int target = random(numTowns - 1);
+                        int targetShard = shardOf(target, shards, numTowns);
+                        if (targetShard == shard)
+                        {
+                            if (target - first != i && playing(target - first))
+                            {
+                                town->invade(towns[target - first]);
+                                ++results.invasions;
+                            }
+                        }
+                        else
+                        {
+                            ++results.invasions;
+                            ++results.remoteInvasions;
+                            if (!world.ring(shard, targetShard).push({InvasionMessage, year, target, first + i, town->getSoldiers()})) ++results.dropped;
+                        }
+                    }
+
+                    // ship surplus grain to another shard
+                    int surplus = town->getGrain() - town->getSerfs() * GRAIN_DEMAND * SHIPMENT_RESERVE;
+                    if (shards > 1 && surplus > 0)
+                    {
+                        int quantity = surplus / 2;
+                        if (quantity > town->getGrain() - MIN_GRAIN) quantity = town->getGrain() - MIN_GRAIN;
+                        if (quantity > GRAIN_PURCHASE_LIMIT) quantity = GRAIN_PURCHASE_LIMIT;
+                        if (quantity > 0)
+                        {
+                            int targetShard = random(shards - 2);
+                            if (targetShard >= shard) ++targetShard; // any shard but this one
+                            town->sellGrain(quantity);
+                            ++results.shipments;
+                            if (!world.ring(shard, targetShard).push({ShipmentMessage, year, -1, first + i, quantity})) ++results.dropped; // lost on the way
+                        }
+                    }
+
+                    applyRelease(*town, SolverRelease);
+                    town->turnResults();
+                });
+            }
+
+            for (Player* town : towns)
+            {
+                results.score += town->getScore();
+                results.gold += town->getGold();
+            }
+            world.result(shard, year) = results;
+
+            // finish the year, then wait for everyone else to (or to fail, or to take too long)
+            header.progress[shard].store(year + 1, std::memory_order_release);
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(BARRIER_TIMEOUT);
+            for (int other = 0; other < shards; ++other)
+                while (header.progress[other].load(std::memory_order_acquire) <= year && !header.failed[other].load(std::memory_order_acquire))
+                {
+                    if (std::chrono::steady_clock::now() > deadline)
+                    {
+                        std::cerr << "Shard " << shard << " gave up waiting for shard " << other << " to finish year " << STARTING_YEAR + year << ".\n";
+                        header.failed[other].store(1, std::memory_order_release); // everyone else stops waiting too, and the orchestrator stops its worker
+                        break;
+                    }
+                    std::this_thread::yield();
+                }
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // take settings from command line
+    int numTowns = argc > 1 ? std::stoi(argv[1]) : 10000;
+    int shards = argc > 2 ? std::stoi(argv[2]) : std::thread::hardware_concurrency();
+    int years = argc > 3 ? std::stoi(argv[3]) : 20;
+    unsigned int seed = argc > 4 ? std::stoul(argv[4]) : 2018;
+    if (numTowns < 1) numTowns = 1;
+    if (shards < 1) shards = 1;
+    if (shards > MAX_SHARDS) shards = MAX_SHARDS;
+    if (shards > numTowns) shards = numTowns;
+    if (years < 1) years = 1;
+
+    SharedWorld world(shards, years);
+    std::cout << "Playing " << numTowns << " towns for " << years << " years in " << shards << " worker processes ("
+              << world.size() / 1024 << " KiB of shared memory)\n";
+    std::cout.flush(); // nothing left in the buffer for the workers to write out again
+
+    // start every worker
+    auto start = std::chrono::steady_clock::now();
+    std::vector<pid_t> workers(shards);
+    for (int shard = 0; shard < shards; ++shard)
+    {
+        workers[shard] = fork();
+        if (workers[shard] < 0)
+        {
+            std::cerr << "Unable to start worker " << shard << ", counting it as failed.\n";
+            world.header().failed[shard].store(1, std::memory_order_release);
+        }
+        else if (workers[shard] == 0)
+        {
+            int status = 0;
+            try {runShard(world, shard, shards, numTowns, years, seed);}
+            catch (std::exception& error)
+            {
+                std::cerr << "Shard " << shard << ": " << error.what() << '\n';
+                status = 1;
+            }
+            std::cerr.flush();
+            _exit(status); // skip the orchestrator's destructors (the shared mapping stays up for everyone else)
+        }
+    }
+
+    // wait for the workers, letting the rest move on without any that die, and stopping any that another shard gave up on
+    int running = 0;
+    for (pid_t worker : workers) if (worker > 0) ++running;
+    std::vector<bool> failedShards(shards, false), stopped(shards, false);
+    while (running > 0)
+    {
+        int status;
+        pid_t done = waitpid(-1, &status, WNOHANG);
+        if (done < 0) break;
+        if (done == 0)
+        {
+            for (int shard = 0; shard < shards; ++shard)
+                if (workers[shard] > 0 && !stopped[shard] && world.header().failed[shard].load(std::memory_order_acquire))
+                {
+                    kill(workers[shard], SIGKILL); // timed out, so whatever it's stuck on, nobody is waiting for it anymore
+                    stopped[shard] = true;
+                }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+        --running;
+
+        for (int shard = 0; shard < shards; ++shard)
+        {
+            if (workers[shard] != done) continue;
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            {
+                failedShards[shard] = true;
+                world.header().failed[shard].store(1, std::memory_order_release);
+                std::cerr << "Worker for shard " << shard << " failed after " << world.header().progress[shard].load() << " years.\n";
+            }
+        }
+    }
+    for (int shard = 0; shard < shards; ++shard) if (workers[shard] < 0) failedShards[shard] = true;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // add up every shard's finished years
+    std::cout << "\n  Year     Towns   Mean score    Total gold  Invasions  Cross-shard  Shipments  Delivered  Dropped  Broken\n";
+    long long townYears = 0;
+    for (int year = 0; year < years; ++year)
+    {
+        ShardYear total {};
+        long long scoredTowns = 0; // every town in the shards added up, playing or not (same towns as the score)
+        for (int shard = 0; shard < shards; ++shard)
+        {
+            if (world.header().progress[shard].load(std::memory_order_acquire) <= year) continue; // never finished the year
+            const ShardYear& r = world.result(shard, year);
+            scoredTowns += firstTown(shard + 1, shards, numTowns) - firstTown(shard, shards, numTowns);
+            total.towns += r.towns;
+            total.score += r.score;
+            total.gold += r.gold;
+            total.invasions += r.invasions;
+            total.remoteInvasions += r.remoteInvasions;
+            total.shipments += r.shipments;
+            total.delivered += r.delivered;
+            total.dropped += r.dropped;
+            total.broken += r.broken;
+        }
+        townYears += total.towns;
+
+        std::cout << std::setw(6) << STARTING_YEAR + year << std::setw(10) << total.towns
+                  << std::setw(13) << (scoredTowns > 0 ? total.score / scoredTowns : 0) << std::setw(14) << total.gold
+                  << std::setw(11) << total.invasions << std::setw(13) << total.remoteInvasions << std::setw(11) << total.shipments
+                  << std::setw(11) << total.delivered << std::setw(9) << total.dropped << std::setw(8) << total.broken << '\n';
+    }
+
+    int failures = 0;
+    for (bool failed : failedShards) if (failed) ++failures;
+    std::cout << '\n' << townYears << " town-years in " << std::fixed << std::setprecision(2) << seconds << " seconds";
+    if (failures > 0) std::cout << ", " << failures << " of " << shards << " shards failed";
+    std::cout << '\n';
+
+    return failures > 0 ? 1 : 0;
+}
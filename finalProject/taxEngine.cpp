@@ -0,0 +1,52 @@
+#ifndef TAXENGINE_CPP
+#define TAXENGINE_CPP
+
+#include "taxEngine.hpp"
+#include "player.hpp"
+
+void TaxBatch::clear()
+{
+    for (std::vector<int>& b : base) b.clear();
+    for (std::vector<float>& r : rates) r.clear();
+    modifiers.clear();
+}
+
+void TaxBatch::add(const Player& town)
+{
+    base[MerchantBase].push_back(town.getMerchants());
+    base[ClergyBase].push_back(town.getClergy());
+    base[NobleBase].push_back(town.getNobles());
+    base[AssetBase].push_back(town.getTotalAssets());
+
+    for (int tax = 0; tax < NUM_TAXES; ++tax) rates[tax].push_back(taxFraction(town.getTaxRate(static_cast<TaxCategory>(tax))));
+    modifiers.push_back(DIFF_MODIFIERS[town.getDifficulty() - 1]);
+}
+
+void TaxBatch::compute()
+{
+    const int count = size();
+
+    for (int tax = 0; tax < NUM_TAXES; ++tax)
+    {
+        revenues[tax].resize(count);
+
+        // same formula as taxRevenue(), written as one flat loop over every town so the compiler can vectorize it
+        const int16* weights = TAX_WEIGHTS[tax];
+        const int* merchants = base[MerchantBase].data();
+        const int* clergy = base[ClergyBase].data();
+        const int* nobles = base[NobleBase].data();
+        const int* assets = base[AssetBase].data();
+        const float* rate = rates[tax].data();
+        const float* modifier = modifiers.data();
+        int* revenue = revenues[tax].data();
+
+        for (int i = 0; i < count; ++i)
+        {
+            int taxable = weights[MerchantBase] * merchants[i] + weights[ClergyBase] * clergy[i]
+                        + weights[NobleBase] * nobles[i] + weights[AssetBase] * assets[i];
+            revenue[i] = rate[i] * taxable / modifier[i];
+        }
+    }
+}
+
+#endif // TAXENGINE_CPP
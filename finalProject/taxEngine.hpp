@@ -0,0 +1,59 @@
+#ifndef TAXENGINE_HPP
+#define TAXENGINE_HPP
+
+/*
+Tax engine details
+    - Every tax works the same way: a weighted sum of the town's taxpayers and assets, times the tax rate, divided by the difficulty modifier
+        - The weights for every tax form a small matrix (TAX_WEIGHTS in the parameters file, one row per tax)
+        - The taxable groups (merchants, clergy, nobles, assets) form a vector that's shared by every tax
+        - All of a town's revenues are the matrix times that vector, scaled by each tax's rate
+    - A single town gets its revenues through Player::getTaxRevenues() (called as part of turnResults)
+    - Many towns at once can be put into a TaxBatch, which lays them out column by column so the whole batch gets calculated in one vectorized loop per tax
+        - Deferred year-end reports get caught up this way (see catchUpTowns() in the game flow)
+*/
+
+#include <vector>
+#include "parameters.hpp" // tax weights
+
+class Player;
+
+inline float taxFraction(int rate) {return static_cast<float>(rate / 100.0);} // tax rate as a decimal (same as percent(), without the range check)
+
+inline int taxRevenue(const int16 weights[NUM_TAX_BASES], const int base[NUM_TAX_BASES], int rate, float modifier)
+// pre: weights is a row of TAX_WEIGHTS, base holds the town's taxable groups (indexed by TaxBase), valid rate and difficulty modifier
+// post: return the yearly revenue the tax generates in the town
+{
+    int taxable = 0; // total taxable wealth for this tax
+    for (int b = 0; b < NUM_TAX_BASES; ++b) taxable += weights[b] * base[b];
+
+    return taxFraction(rate) * taxable / modifier; // take rate and difficulty into account
+}
+
+class TaxBatch
+{
+private:
+    // one entry per town in every array (structure of arrays so each tax is a single loop over contiguous data)
+    std::vector<int> base[NUM_TAX_BASES]; // taxable groups
+    std::vector<float> rates[NUM_TAXES]; // tax rates as decimals
+    std::vector<float> modifiers; // difficulty modifiers
+    std::vector<int> revenues[NUM_TAXES]; // results
+
+public:
+    void clear();
+    // post: remove all towns from the batch (keeps allocated memory for reuse)
+
+    void add(const Player& town);
+    // pre: player object initialized
+    // post: append the town's taxable groups and tax rates to the batch (town index is the old size())
+
+    void compute();
+    // pre: N/A
+    // post: calculate every tax revenue for every town in the batch, same results as Player::getTaxRevenues()
+
+    int size() const {return modifiers.size();}
+    int getRevenue(int town, TaxCategory tax) const {return revenues[tax][town];}
+    // pre: compute() called since the town was added, valid town index
+    // post: return the yearly revenue of the tax in that town
+};
+
+#endif // TAXENGINE_HPP
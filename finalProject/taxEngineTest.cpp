@@ -0,0 +1,129 @@
+/*
+Purpose: Check that tax batches come up with the same revenues as towns calculating their own, and that every tax uses its own rate and weights (see taxEngine.hpp)
+Usage: taxEngineTest
+    - Towns come from games with a fixed seed on every difficulty, taking random policy actions and random tax rates so their taxpayers, assets, and rates spread out
+    - Income taxes used to be calculated from the customs rate, so every town's income and customs rates get set apart from each other
+    - Returns 0 if every check passes, otherwise prints the ones that failed and returns 1
+*/
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include "taxEngine.hpp"
+#include "botPolicy.hpp"
+#include "player.hpp"
+#include "gameContext.hpp"
+#include "helperFunctions.hpp"
+#include "testCheck.hpp"
+
+namespace
+{
+    const int TOWNS_PER_DIFFICULTY = 100;
+    const int MAX_YEARS = 8; // most years a town plays before getting checked
+    const unsigned int TEST_SEED = 28;
+
+    const char* TAX_NAMES[NUM_TAXES] = {"sales", "income", "customs"};
+
+    // revenue written out with the tax's own named weights, as a check on the weight matrix and on which rate gets used
+    int expectedRevenue(const Player& town, TaxCategory tax)
+    {
+        const int weights[NUM_TAXES][NUM_TAX_BASES] =
+        {{MERCHANT_SALES, CLERGY_SALES, NOBLE_SALES, ASSET_SALES},
+        {MERCHANT_INCOME, CLERGY_INCOME, NOBLE_INCOME, ASSET_INCOME},
+        {MERCHANT_CUSTOMS, CLERGY_CUSTOMS, NOBLE_CUSTOMS, ASSET_CUSTOMS}};
+        const int rates[NUM_TAXES] = {town.getSales(), town.getIncome(), town.getCustoms()};
+
+        int taxable = weights[tax][MerchantBase] * town.getMerchants() + weights[tax][ClergyBase] * town.getClergy()
+                    + weights[tax][NobleBase] * town.getNobles() + weights[tax][AssetBase] * town.getTotalAssets();
+        return taxFraction(rates[tax]) * taxable / DIFF_MODIFIERS[town.getDifficulty() - 1];
+    }
+
+    // towns after a random amount of years with random decisions, each with random tax rates (income and customs always apart)
+    void playTowns(GameContext& game, int difficulty, std::vector<Player>& towns)
+    {
+        for (int i = 0; i < TOWNS_PER_DIFFICULTY; ++i)
+        {
+            std::unique_ptr<Player> town(new Player(game, "Bot", "Town", difficulty));
+            const int years = random(0, MAX_YEARS);
+            try
+            {
+                for (int year = 0; year < years; ++year)
+                {
+                    std::unique_ptr<Player> nextYear(new Player(*town));
+                    applyPolicyAction(*nextYear, random(0, NUM_POLICY_ACTIONS - 1));
+                    nextYear->releaseGrain(random(nextYear->minRelease(), nextYear->maxRelease()));
+                    nextYear->turnResults();
+                    if (nextYear->gameEnded()) break; // rates can't be changed anymore, so keep the year before
+                    town = std::move(nextYear);
+                }
+            }
+            catch (FormulaOverflow&) {} // still has taxes to check, from the year before
+
+            town->adjustSales(random(0, MAX_SALES_TAX));
+            town->adjustIncome(random(0, MAX_INCOME_TAX));
+            int customs;
+            do customs = random(0, MAX_CUSTOMS_TAX); while (customs == town->getIncome());
+            town->adjustCustoms(customs);
+            towns.push_back(*town);
+        }
+    }
+
+    void checkTowns(const std::vector<Player>& towns, TaxBatch& batch, const std::string& name)
+    {
+        batch.clear();
+        for (const Player& town : towns) batch.add(town);
+        batch.compute();
+        check(batch.size() == static_cast<int>(towns.size()), name + ": batch holds every town");
+
+        for (std::size_t i = 0; i < towns.size(); ++i)
+        {
+            int revenues[NUM_TAXES];
+            towns[i].getTaxRevenues(revenues);
+            for (int tax = 0; tax < NUM_TAXES; ++tax)
+            {
+                const std::string what = name + ", town " + std::to_string(i) + ", " + TAX_NAMES[tax] + " tax";
+                const int expected = expectedRevenue(towns[i], static_cast<TaxCategory>(tax));
+                check(revenues[tax] == expected, what + ": town got " + std::to_string(revenues[tax]) + ", expected " + std::to_string(expected));
+                check(batch.getRevenue(i, static_cast<TaxCategory>(tax)) == revenues[tax],
+                      what + ": batch got " + std::to_string(batch.getRevenue(i, static_cast<TaxCategory>(tax))) + ", town got " + std::to_string(revenues[tax]));
+            }
+        }
+    }
+
+    // income revenue follows the income rate and nothing else
+    void checkIncome(Player town)
+    {
+        int before[NUM_TAXES], after[NUM_TAXES];
+        town.adjustIncome(MAX_INCOME_TAX / 2);
+        town.adjustCustoms(0);
+        town.getTaxRevenues(before);
+        town.adjustCustoms(MAX_CUSTOMS_TAX);
+        town.getTaxRevenues(after);
+        check(after[IncomeTax] == before[IncomeTax], "income revenue doesn't change with the customs rate");
+        check(after[CustomsTax] > before[CustomsTax], "customs revenue goes up with the customs rate");
+
+        town.adjustIncome(MAX_INCOME_TAX);
+        town.getTaxRevenues(after);
+        check(after[IncomeTax] > before[IncomeTax], "income revenue goes up with the income rate");
+    }
+}
+
+int main()
+{
+    std::istringstream noInput;
+    std::ostream muted(nullptr);
+    GameContext game(noInput, muted);
+    game.seed(TEST_SEED);
+    ContextScope scope(game);
+
+    std::vector<Player> towns;
+    for (int difficulty = MIN_DIFFICULTY; difficulty <= MAX_DIFFICULTY; ++difficulty) playTowns(game, difficulty, towns);
+
+    TaxBatch batch; // reused like the game flow's, so a smaller batch after a bigger one gets checked too
+    checkTowns(towns, batch, "all difficulties");
+    checkTowns(std::vector<Player>(towns.begin(), towns.begin() + TOWNS_PER_DIFFICULTY / 2), batch, "smaller batch");
+    checkIncome(Player(game, "Bot", "Town", MIN_DIFFICULTY));
+
+    return testResult("tax engine");
+}
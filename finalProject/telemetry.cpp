@@ -0,0 +1,194 @@
+#ifndef TELEMETRY_CPP
+#define TELEMETRY_CPP
+
+#include <iostream>
+#include <fstream>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <stdexcept>
+#include "telemetry.hpp"
+#include "player.hpp" // score components
+
+namespace
+{
+    const int NUM_HISTOGRAMS = NUM_SCORE_COMPONENTS + 1; // every component, then the total score
+    const char* const COMPONENT_NAMES[AssetScore] = {"gold", "serfs", "merchants", "clergy", "nobles", "soldiers", "grain", "land"}; // components before the assets
+
+    const char* histogramName(int h)
+    {
+        if (h < AssetScore) return COMPONENT_NAMES[h];
+        if (h < NUM_SCORE_COMPONENTS) return ASSETS[h - AssetScore].plural; // asset components go by the registry's names
+        return "total";
+    }
+    const std::string EVENT_NAMES[NUM_TELEMETRY_EVENTS] = {"bankruptcy", "promotion", "death", "invasion"};
+
+    // only ever written by its own thread, so plain loads and stores are enough (no read-modify-write)
+    void add(std::atomic<uint64_t>& counter, uint64_t amount)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    struct Histogram
+    {
+        std::atomic<uint64_t> buckets[NUM_METRIC_BUCKETS] = {}; // values up to each bound (not cumulative, added up on export)
+        std::atomic<int64_t> sum {0};
+
+        void record(int value)
+        {
+            int bucket = 0;
+            while (bucket < NUM_METRIC_BUCKETS - 1 && value > METRIC_BUCKETS[bucket]) ++bucket;
+            add(buckets[bucket], 1);
+            sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+    };
+
+    struct Shard // everything recorded by a single thread
+    {
+        Histogram histograms[NUM_HISTOGRAMS];
+        std::atomic<uint64_t> events[NUM_TELEMETRY_EVENTS] = {};
+    };
+
+    std::atomic<bool> enabled {false};
+    std::mutex registryLock; // guards shards
+    std::vector<std::unique_ptr<Shard>> shards; // every thread's shard, kept after threads exit
+
+    Shard& threadShard()
+    {
+        thread_local Shard* shard = nullptr;
+        if (!shard)
+        {
+            std::lock_guard<std::mutex> guard(registryLock);
+            shards.emplace_back(new Shard);
+            shard = shards.back().get();
+        }
+        return *shard;
+    }
+}
+
+bool telemetryEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+void recordTownYear(const Player& town)
+{
+    if (!telemetryEnabled()) return;
+
+    int components[NUM_SCORE_COMPONENTS];
+    town.getScoreComponents(components);
+
+    Shard& shard = threadShard();
+    for (int i = 0; i < NUM_SCORE_COMPONENTS; ++i) shard.histograms[i].record(components[i]);
+    shard.histograms[NUM_SCORE_COMPONENTS].record(town.getScore());
+}
+
+void countEvent(TelemetryEvent event)
+{
+    if (!telemetryEnabled()) return;
+    add(threadShard().events[event], 1);
+}
+
+void writeMetrics(std::ostream& out, MetricsFormat format)
+{
+    // add up every shard
+    uint64_t buckets[NUM_HISTOGRAMS][NUM_METRIC_BUCKETS] = {};
+    int64_t sums[NUM_HISTOGRAMS] = {};
+    uint64_t events[NUM_TELEMETRY_EVENTS] = {};
+    {
+        std::lock_guard<std::mutex> guard(registryLock);
+        for (const std::unique_ptr<Shard>& shard : shards)
+        {
+            for (int h = 0; h < NUM_HISTOGRAMS; ++h)
+            {
+                for (int b = 0; b < NUM_METRIC_BUCKETS; ++b) buckets[h][b] += shard->histograms[h].buckets[b].load(std::memory_order_relaxed);
+                sums[h] += shard->histograms[h].sum.load(std::memory_order_relaxed);
+            }
+            for (int e = 0; e < NUM_TELEMETRY_EVENTS; ++e) events[e] += shard->events[e].load(std::memory_order_relaxed);
+        }
+    }
+
+    // score components as one histogram labeled by component, buckets counted up cumulatively
+    out << "# HELP paravia_score_points Score points from each part of a town at the end of every year.\n"
+        << "# TYPE paravia_score_points histogram\n";
+    for (int h = 0; h < NUM_HISTOGRAMS; ++h)
+    {
+        const char* label = histogramName(h);
+        uint64_t count = 0;
+        for (int b = 0; b < NUM_METRIC_BUCKETS; ++b)
+        {
+            count += buckets[h][b];
+            out << "paravia_score_points_bucket{component=\"" << label << "\",le=\"";
+            if (b < NUM_METRIC_BUCKETS - 1) out << METRIC_BUCKETS[b];
+            else out << "+Inf";
+            out << "\"} " << count << '\n';
+        }
+        out << "paravia_score_points_sum{component=\"" << label << "\"} " << sums[h] << '\n'
+            << "paravia_score_points_count{component=\"" << label << "\"} " << count << '\n';
+    }
+
+    // events (OpenMetrics names the counter without its _total suffix)
+    const std::string counter = format == OpenMetricsFormat ? "paravia_events" : "paravia_events_total";
+    out << "# HELP " << counter << " Town events since the process started.\n"
+        << "# TYPE " << counter << " counter\n";
+    for (int e = 0; e < NUM_TELEMETRY_EVENTS; ++e)
+        out << "paravia_events_total{event=\"" << EVENT_NAMES[e] << "\"} " << events[e] << '\n';
+
+    if (format == OpenMetricsFormat) out << "# EOF\n";
+}
+
+
+/// exporter
+
+MetricsExporter::MetricsExporter(std::string p, MetricsFormat f, int milliseconds)
+: path(p), format(f), interval(milliseconds)
+{
+    if (interval < 1) throw std::logic_error("Error: Metrics exporter created with an interval below 1 millisecond.");
+    if (enabled.exchange(true)) throw std::logic_error("Error: Metrics exporter created while another one is running.");
+
+    thread = std::thread(&MetricsExporter::exportLoop, this);
+}
+
+MetricsExporter::~MetricsExporter()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_one();
+    thread.join();
+
+    enabled = false;
+    try {exportNow();} // last values recorded
+    catch (std::runtime_error& error) {std::cerr << error.what() << '\n';}
+}
+
+void MetricsExporter::exportLoop()
+{
+    std::unique_lock<std::mutex> guard(lock);
+    while (!wake.wait_for(guard, std::chrono::milliseconds(interval), [&] {return stopping;}))
+    {
+        guard.unlock();
+        try {exportNow();}
+        catch (std::runtime_error& error) {std::cerr << error.what() << '\n';} // try again next time
+        guard.lock();
+    }
+}
+
+void MetricsExporter::exportNow()
+{
+    // readers only ever see a finished file
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary);
+        if (!file) throw std::runtime_error("Unable to write metrics to " + temporary + ".");
+        writeMetrics(file, format);
+        if (!file) throw std::runtime_error("Unable to write metrics to " + temporary + ".");
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) throw std::runtime_error("Unable to replace " + path + " with new metrics.");
+}
+
+#endif // TELEMETRY_CPP
@@ -0,0 +1,83 @@
+#ifndef TELEMETRY_HPP
+#define TELEMETRY_HPP
+
+/*
+Telemetry details
+    - Keeps statistics on every town-year played in the process, for watching long-running simulations (tournaments, the game host) from outside
+        - Histograms of every score component at the end of each year (gold, each population class, grain, land, each asset type) along with the total score
+        - Counters for bankruptcies, promotions, deaths, and invasions
+    - Nothing gets recorded unless a MetricsExporter is running, and only towns in games that ask for it (see GameContext::recordMetrics, off for scratch games like bot searches)
+    - Lock-free: every thread records into its own shard, which only that thread ever writes to
+        - Shards get registered once per thread (the only time a lock is taken) and stay around after their thread exits, so nothing recorded gets lost
+        - Exports add up all of the shards while threads keep recording, so they can be a few values behind but never block anything
+    - The exporter writes everything to a file in the Prometheus text format (or OpenMetrics) every so often and once more when it stops
+        - Written to a temporary file and renamed over the old one, so whatever reads the file never sees half of an export
+*/
+
+#include <string>
+#include <iosfwd>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace /// constant parameters for telemetry
+{
+    const int METRICS_INTERVAL = 10000; // milliseconds between exports
+    const int NUM_METRIC_BUCKETS = 17; // upper bounds of histogram buckets, in score points (last one catches everything, +Inf)
+    const int METRIC_BUCKETS[NUM_METRIC_BUCKETS - 1] =
+    {-100000, -10000, -1000, 0, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, 2500000, 5000000};
+}
+
+class Player;
+
+enum TelemetryEvent {BankruptcyEvent, PromotionEvent, DeathEvent, InvasionEvent};
+const int NUM_TELEMETRY_EVENTS = 4;
+
+enum MetricsFormat {PrometheusFormat, OpenMetricsFormat};
+
+bool telemetryEnabled();
+// pre: N/A
+// post: return true if an exporter is running (recording functions do nothing otherwise)
+
+void recordTownYear(const Player& town);
+// pre: player object initialized, called at the end of the town's year-end report
+// post: add each of the town's score components and its total score to the current thread's histograms
+
+void countEvent(TelemetryEvent event);
+// pre: N/A
+// post: add one to the event's counter for the current thread
+
+void writeMetrics(std::ostream& out, MetricsFormat format);
+// pre: N/A
+// post: write the totals of every thread's histograms and counters to the stream in the format
+
+class MetricsExporter // writes metrics to a file periodically for as long as it exists (only one at a time)
+{
+private:
+    std::string path;
+    MetricsFormat format;
+    int interval;
+
+    std::thread thread;
+    std::mutex lock; // guards stopping
+    std::condition_variable wake;
+    bool stopping = false;
+
+    void exportLoop();
+    // post: export every interval until the exporter gets stopped
+
+public:
+    MetricsExporter(std::string p, MetricsFormat f = PrometheusFormat, int milliseconds = METRICS_INTERVAL);
+    // pre: path in a writable directory, interval above 0, no other exporter running
+    // post: turn on recording and start exporting to the file in the background
+    ~MetricsExporter();
+    // post: turn off recording, stop the background thread, and write one last export
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+    void exportNow();
+    // pre: N/A
+    // post: write the current totals to the file (throws std::runtime_error if it can't be written)
+};
+
+#endif // TELEMETRY_HPP
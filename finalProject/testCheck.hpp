@@ -0,0 +1,50 @@
+#ifndef TESTCHECK_HPP
+#define TESTCHECK_HPP
+
+/*
+Test check details
+    - Shared by the test programs (each one is its own executable run by ctest, see CMakeLists.txt), which only hold their own checks
+    - A failed check gets printed and counted instead of stopping the test, so one run shows everything that's wrong
+    - A test's main() ends with testResult(), returning 0 if every check passed and 1 otherwise
+*/
+
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+namespace /// each test program has its own count
+{
+    int failures = 0; // checks that have failed so far
+
+    // print and count the check if it didn't pass
+    void check(bool passed, const std::string& what)
+    {
+        if (passed) return;
+        std::cout << "FAILED: " << what << '\n';
+        ++failures;
+    }
+
+    // check that the call gets refused with a logic_error (how every class in the game refuses bad arguments)
+    template <typename Call>
+    void checkThrows(Call call, const std::string& what)
+    {
+        bool threw = false;
+        try {call();}
+        catch (std::logic_error&) {threw = true;}
+        check(threw, what);
+    }
+
+    // print how the test went and return its exit code
+    int testResult(const std::string& name)
+    {
+        if (failures > 0)
+        {
+            std::cout << failures << ' ' << name << " checks failed\n";
+            return 1;
+        }
+        std::cout << "All " << name << " checks passed\n";
+        return 0;
+    }
+}
+
+#endif // TESTCHECK_HPP
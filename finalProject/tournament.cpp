@@ -0,0 +1,201 @@
+/*
+Purpose: Play many bot-only games and report percentiles of how the bots did (see quantileSketch.hpp)
+Usage: tournament [games] [threads] [search nodes per decision] [random seed] [metrics file] [metrics format]
+    - Every game has TOURNAMENT_TOWNS bots with random difficulties, each one randomly playing by the policy table or by searching
+    - Bots take the same turns as in botActions(), including random invasions of each other, until every town's game has ended
+    - Results are kept as quantile sketches for every metric, difficulty, and strategy, so memory use stays the same however many games get played
+        - Towns that break the game's formulas are left out of the sketches and reported by difficulty instead
+        - Each thread fills its own sketches, which get merged together at the end
+    - Given a metrics file, score components and events of every town-year get exported to it while the games run (see telemetry.hpp)
+        - Prometheus text format by default, "openmetrics" as the format for OpenMetrics
+*/
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include "bot.hpp"
+#include "botPolicy.hpp"
+#include "botSearch.hpp"
+#include "quantileSketch.hpp"
+#include "telemetry.hpp"
+#include "gameContext.hpp" // each game's own state
+#include "helperFunctions.hpp"
+
+namespace
+{
+    enum Metric {ScoreMetric, LengthMetric, BankruptcyMetric, PlaceMetric};
+    const int NUM_METRICS = 4;
+    const std::string METRIC_NAMES[NUM_METRICS] = {"Final score", "Years played", "Years in debt", "Place in game"};
+    const int NUM_STRATEGIES = 2;
+    const std::string STRATEGY_NAMES[NUM_STRATEGIES] = {"Policy", "Search"};
+
+    // sketches for every metric of every kind of bot
+    struct Results
+    {
+        std::vector<QuantileSketch> sketches = std::vector<QuantileSketch>(NUM_STRATEGIES * MAX_DIFFICULTY * NUM_METRICS);
+        long brokenTowns[MAX_DIFFICULTY] = {}; // towns of each difficulty that grew past what the game's formulas can handle
+
+        QuantileSketch& sketch(BotStrategy strategy, int difficulty, Metric metric)
+        {
+            return sketches[(strategy * MAX_DIFFICULTY + difficulty - 1) * NUM_METRICS + metric];
+        }
+
+        void merge(const Results& other)
+        {
+            for (std::size_t i = 0; i < sketches.size(); ++i) sketches[i].merge(other.sketches[i]);
+            for (int d = 0; d < MAX_DIFFICULTY; ++d) brokenTowns[d] += other.brokenTowns[d];
+        }
+    };
+
+    // play through a single game (in its own context, with its own random numbers) and add every town's results
+    void playTournamentGame(long searchNodes, unsigned int seed, Results& results)
+    {
+        // towns' own output isn't needed
+        std::istringstream noInput;
+        std::ostream muted(nullptr);
+        GameContext game(noInput, muted);
+        game.seed(seed); // every game plays out the same whichever thread takes it
+        ContextScope scope(game);
+
+        std::vector<Bot*> towns;
+        for (int i = 0; i < TOURNAMENT_TOWNS; ++i)
+        {
+            towns.push_back(new Bot(game, "Bot", "Town", static_cast<BotStrategy>(random(NUM_STRATEGIES - 1)), {0, searchNodes, 1})); // games already run on every thread
+            game.bots.push_back(towns.back()); // deleted along with the game
+        }
+
+        std::vector<int> debtYears(towns.size(), 0);
+        std::vector<int> firstYear(towns.size());
+        std::vector<bool> broken(towns.size(), false);
+        for (std::size_t i = 0; i < towns.size(); ++i) firstYear[i] = towns[i]->getYear();
+
+        bool playing;
+        do
+        {
+            playing = false;
+            for (std::size_t i = 0; i < towns.size(); ++i)
+            {
+                Bot* bot = towns[i];
+                if (broken[i] || bot->gameEnded()) continue;
+                playing = true;
+
+                try
+                {
+                    // same turn as botActions()
+                    BotDecision decision = bot->getStrategy() == SearchStrategy ? searchDecision(*bot, bot->getBudget()) : BotDecision {policyAction(*bot), SolverRelease};
+                    applyPolicyAction(*bot, decision.action);
+
+                    if (rollChance(game.botAggression, 100))
+                    {
+                        Player* target = invasionTarget(*bot, game.bots);
+                        if (target) bot->invade(target);
+                    }
+
+                    applyRelease(*bot, decision.release);
+                    bot->turnResults();
+                    if (bot->getGold() < 0) ++debtYears[i];
+                }
+                catch (FormulaOverflow&) {broken[i] = true;} // left out of the results
+            }
+        } while (playing);
+
+        // places go by final score, best first
+        for (std::size_t i = 0; i < towns.size(); ++i)
+        {
+            if (broken[i])
+            {
+                ++results.brokenTowns[towns[i]->getDifficulty() - 1];
+                continue;
+            }
+
+            int place = 1;
+            for (std::size_t j = 0; j < towns.size(); ++j)
+            {
+                if (!broken[j] && towns[j]->getScore() > towns[i]->getScore()) ++place;
+            }
+
+            BotStrategy strategy = towns[i]->getStrategy();
+            int difficulty = towns[i]->getDifficulty();
+            results.sketch(strategy, difficulty, ScoreMetric).add(towns[i]->getScore());
+            results.sketch(strategy, difficulty, LengthMetric).add(towns[i]->getYear() - firstYear[i]);
+            results.sketch(strategy, difficulty, BankruptcyMetric).add(debtYears[i]);
+            results.sketch(strategy, difficulty, PlaceMetric).add(place);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // take settings from command line
+    long games = argc > 1 ? std::stol(argv[1]) : 10000;
+    int numThreads = argc > 2 ? std::stoi(argv[2]) : std::thread::hardware_concurrency();
+    long searchNodes = argc > 3 ? std::stol(argv[3]) : TOURNAMENT_SEARCH_NODES;
+    unsigned int seed = argc > 4 ? std::stoul(argv[4]) : 2018;
+    std::string metricsPath = argc > 5 ? argv[5] : "";
+    MetricsFormat metricsFormat = argc > 6 && std::string(argv[6]) == "openmetrics" ? OpenMetricsFormat : PrometheusFormat;
+    if (numThreads < 1) numThreads = 1;
+    if (searchNodes < 1) searchNodes = 1;
+
+    // exports keep going for as long as the games do, with a final one once they're done
+    std::unique_ptr<MetricsExporter> exporter;
+    if (!metricsPath.empty()) exporter.reset(new MetricsExporter(metricsPath, metricsFormat));
+
+    std::cout << "Playing " << games << " games of " << static_cast<int>(TOURNAMENT_TOWNS) << " bots on " << numThreads << " threads\n";
+
+    // every thread plays games until there are none left, keeping its own results
+    std::vector<Results> threadResults(numThreads);
+    std::atomic<long> nextGame(0);
+    auto playGames = [&](int thread)
+    {
+        for (long game = nextGame++; game < games; game = nextGame++) playTournamentGame(searchNodes, seed + game, threadResults[thread]);
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i) threads.emplace_back(playGames, i);
+    for (std::thread& t : threads) t.join();
+    exporter.reset();
+
+    // combine and report
+    Results total;
+    for (const Results& r : threadResults) total.merge(r);
+
+    std::cout << std::fixed << std::setprecision(0);
+    for (int strategy = 0; strategy < NUM_STRATEGIES; ++strategy)
+    {
+        for (int difficulty = MIN_DIFFICULTY; difficulty <= MAX_DIFFICULTY; ++difficulty)
+        {
+            long towns = total.sketch(static_cast<BotStrategy>(strategy), difficulty, ScoreMetric).getCount();
+            std::cout << '\n' << STRATEGY_NAMES[strategy] << " bots, difficulty " << difficulty << " (" << towns << " towns)\n";
+            if (towns == 0) continue;
+
+            for (int metric = 0; metric < NUM_METRICS; ++metric)
+            {
+                const QuantileSketch& sketch = total.sketch(static_cast<BotStrategy>(strategy), difficulty, static_cast<Metric>(metric));
+                std::cout << "    " << std::left << std::setw(15) << METRIC_NAMES[metric] << std::right
+                          << " p50 " << std::setw(9) << sketch.quantile(0.5)
+                          << "  p90 " << std::setw(9) << sketch.quantile(0.9)
+                          << "  p99 " << std::setw(9) << sketch.quantile(0.99)
+                          << "  (" << sketch.getRetained() << " values kept)\n";
+            }
+        }
+    }
+
+    // towns that broke the formulas aren't in any sketch, so they get counted on their own
+    long broken = 0;
+    for (int d = 0; d < MAX_DIFFICULTY; ++d) broken += total.brokenTowns[d];
+    if (broken > 0)
+    {
+        std::cout << '\n' << broken << " towns left out after breaking the game's formulas:\n";
+        for (int difficulty = MIN_DIFFICULTY; difficulty <= MAX_DIFFICULTY; ++difficulty)
+            std::cout << "    difficulty " << difficulty << ": " << total.brokenTowns[difficulty - 1] << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+#ifndef TOWNHISTORY_CPP
+#define TOWNHISTORY_CPP
+
+#include <stdexcept>
+#include "townHistory.hpp"
+
+/// turn history
+
+TurnHistory::TurnHistory(Player& t) : town(t)
+{
+    for (int stat = 0; stat < NUM_TOWN_STATS; ++stat) latest[stat] = town.getStat(static_cast<TownStat>(stat));
+}
+
+bool TurnHistory::record(const std::string& label)
+{
+    // compare against the latest step, keeping only what changed
+    Step step {label, {}};
+    for (int stat = 0; stat < NUM_TOWN_STATS; ++stat)
+    {
+        int value = town.getStat(static_cast<TownStat>(stat));
+        if (value == latest[stat]) continue;
+
+        step.changes.push_back({static_cast<TownStat>(stat), latest[stat], value});
+        latest[stat] = value;
+    }
+    if (step.changes.empty()) return false;
+
+    undoSteps.push_back(std::move(step));
+    redoSteps.clear(); // a new decision replaces whatever was undone
+    return true;
+}
+
+void TurnHistory::apply(const Step& step, bool forward)
+{
+    for (const Change& change : step.changes)
+    {
+        int value = forward ? change.after : change.before;
+        town.setStat(change.stat, value);
+        latest[change.stat] = value;
+    }
+}
+
+void TurnHistory::undo()
+{
+    if (!canUndo()) throw std::logic_error("Error: Undoing with no decisions in the turn history.");
+
+    apply(undoSteps.back(), false);
+    redoSteps.push_back(std::move(undoSteps.back()));
+    undoSteps.pop_back();
+}
+
+void TurnHistory::redo()
+{
+    if (!canRedo()) throw std::logic_error("Error: Redoing with no undone decisions in the turn history.");
+
+    apply(redoSteps.back(), true);
+    undoSteps.push_back(std::move(redoSteps.back()));
+    redoSteps.pop_back();
+}
+
+void TurnHistory::rollback(std::size_t position)
+{
+    if (position > undoSteps.size()) throw std::logic_error("Error: Rolling back to a position past the end of the turn history.");
+
+    record(""); // unrecorded changes go back along with everything else
+    while (undoSteps.size() > position)
+    {
+        apply(undoSteps.back(), false);
+        undoSteps.pop_back();
+    }
+    redoSteps.clear();
+}
+
+void TurnHistory::restart()
+{
+    undoSteps.clear();
+    redoSteps.clear();
+    for (int stat = 0; stat < NUM_TOWN_STATS; ++stat) latest[stat] = town.getStat(static_cast<TownStat>(stat));
+}
+
+
+/// sandbox
+
+TownSandbox::TownSandbox(const Player& town)
+: muted(nullptr), scratch(noInput, muted), original(town, scratch)
+{
+    noInput.exceptions(std::ios::eofbit); // decisions that ask for input fail instead of waiting forever
+    scratch.recordMetrics = false; // tries aren't part of the game
+}
+
+#endif // TOWNHISTORY_CPP
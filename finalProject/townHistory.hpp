@@ -0,0 +1,124 @@
+#ifndef TOWNHISTORY_HPP
+#define TOWNHISTORY_HPP
+
+/*
+Town history details
+    - Undo and redo for the decisions a player makes during a turn (see gameMenu())
+    - The history is a chain of snapshots of the town's stats, where each snapshot shares every stat it didn't change with the one before it
+        - A step only stores the stats that changed (values before and after), so undoing or redoing it costs as much as it changed instead of a full Player copy
+        - Only stats that turn decisions can change are covered (see TownStat), including how many times the town has gone bankrupt
+        - Results like bankruptcy seizures come back exactly as they happened on a redo, nothing gets rolled again (the random numbers they took aren't given back on an undo either)
+        - Bankruptcies only get counted in the telemetry once the year ends (see Player::turnResults()), so undone ones never show up there
+    - Invasions change other towns too, so they can't be undone and the history starts over after them
+    - TownSandbox is for trying out whole years instead (see the what-if advisor): decisions and the year end get played out on a copy of the town in a scratch game
+        - Every try starts from a fresh copy, since a history can't take back a year end (and copying a town costs next to nothing compared to one)
+        - Tries get seeded, so tries with the same seed see the same rolls and only differ by their decisions
+*/
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <optional>
+#include <cstddef>
+#include "player.hpp"
+#include "gameContext.hpp"
+
+class TurnHistory
+{
+private:
+    struct Change // a single stat changed by a step
+    {
+        TownStat stat;
+        int before;
+        int after;
+    };
+    struct Step // everything changed by one decision
+    {
+        std::string label; // describes the decision in program output
+        std::vector<Change> changes;
+    };
+
+    Player& town;
+    int latest[NUM_TOWN_STATS]; // stats as of the latest step, which the next step gets compared against
+    std::vector<Step> undoSteps; // most recent last
+    std::vector<Step> redoSteps; // next one to redo last
+
+    void apply(const Step& step, bool forward);
+    // pre: step recorded for this town
+    // post: set every stat the step changed to its value after (forward) or before the step, keeping latest in line
+
+public:
+    TurnHistory(Player& t);
+    // pre: player object initialized, outlives the history
+    // post: empty history starting from the town's current stats
+
+    bool record(const std::string& label);
+    // pre: N/A
+    // post: store every change to the town since the latest step as a new step with the label, forgetting any steps that could be redone
+    // return false (storing nothing) if nothing changed
+
+    bool canUndo() const {return !undoSteps.empty();}
+    bool canRedo() const {return !redoSteps.empty();}
+    const std::string& undoLabel() const {return undoSteps.back().label;} // pre: canUndo()
+    const std::string& redoLabel() const {return redoSteps.back().label;} // pre: canRedo()
+
+    void undo();
+    // pre: canUndo(), no unrecorded changes to the town
+    // post: put the town back to how it was before the latest step, which can then be redone
+    void redo();
+    // pre: canRedo(), no unrecorded changes to the town
+    // post: make the changes of the last undone step again
+
+    std::size_t mark() const {return undoSteps.size();}
+    // post: return a position in the history to roll back to later
+    void rollback(std::size_t position);
+    // pre: position returned by mark() since the last restart()
+    // post: undo every step after the position along with any unrecorded changes, none of which can be redone
+
+    void restart();
+    // pre: N/A
+    // post: forget every step, the history starts over from the town's current stats (used after changes that can't be undone)
+};
+
+class TownSandbox
+{
+private:
+    // scratch game the copy lives in: no input, output goes nowhere
+    std::istringstream noInput;
+    std::ostream muted;
+    GameContext scratch;
+
+    Player original; // copy of the town as it was handed over
+    std::optional<Player> town; // copy the latest try played out on
+
+public:
+    TownSandbox(const Player& original);
+    // pre: player object initialized
+    // post: copy the town into a sandbox of its own, later changes to the original don't show up in the sandbox
+
+    template <typename Decisions> bool tryOut(Decisions decisions, unsigned int seed)
+    // pre: decisions is callable with a Player& and only makes decisions that don't need input (like purchases within the town's gold), the town's game hasn't ended
+    // post: make the decisions (up to and including the year end) on a fresh copy of the town as it was handed over,
+    //       with the sandbox as the current game and its random numbers starting from the seed (see getTown() for the results)
+    // return false if the decisions needed input or broke the game's formulas
+    {
+        town.reset(); // before the new copy, so the scratch game's player count stays the same
+        town.emplace(original, scratch);
+        scratch.seed(seed);
+        ContextScope scope(scratch);
+        try
+        {
+            decisions(*town);
+            return true;
+        }
+        catch (std::ios_base::failure&) {} // asked for input that isn't there
+        catch (std::logic_error&) {}
+        return false;
+    }
+
+    const Player& getTown() const {return *town;}
+    // pre: tryOut() called
+    // post: return the copy as the last tryOut() left it
+};
+
+#endif // TOWNHISTORY_HPP
@@ -0,0 +1,122 @@
+/*
+Purpose: Check that turn histories put towns back exactly as they were on undo, redo, and rollback (see townHistory.hpp)
+Usage: townHistoryTest
+    - A single town in a game of its own with a fixed seed, muted output, and scripted answers for purchases that put it into debt
+    - Returns 0 if every check passes, otherwise prints the ones that failed and returns 1
+*/
+
+#include <sstream>
+#include "townHistory.hpp"
+#include "player.hpp"
+#include "gameContext.hpp"
+#include "testCheck.hpp"
+
+namespace
+{
+    struct Snapshot // every stat a turn history covers
+    {
+        int stats[NUM_TOWN_STATS];
+
+        Snapshot(const Player& town)
+        {
+            for (int stat = 0; stat < NUM_TOWN_STATS; ++stat) stats[stat] = town.getStat(static_cast<TownStat>(stat));
+        }
+
+        bool matches(const Player& town) const
+        {
+            for (int stat = 0; stat < NUM_TOWN_STATS; ++stat) if (stats[stat] != town.getStat(static_cast<TownStat>(stat))) return false;
+            return true;
+        }
+    };
+
+    void checkUndoRedo(Player& town)
+    {
+        TurnHistory history(town);
+        check(!history.record("nothing"), "recording without changes stores nothing");
+        check(!history.canUndo() && !history.canRedo(), "new history has nothing to undo or redo");
+
+        Snapshot start(town);
+        town.buyGrain(20);
+        history.record("buying grain");
+        Snapshot afterGrain(town);
+        town.buyAsset(MarketAsset);
+        town.adjustSales(town.getSales() + 1);
+        history.record("buying a market and raising taxes");
+        Snapshot afterMarket(town);
+
+        history.undo();
+        check(afterGrain.matches(town), "undo puts back the latest step");
+        check(history.canRedo() && history.redoLabel() == "buying a market and raising taxes", "undone step can be redone");
+        history.undo();
+        check(start.matches(town) && !history.canUndo(), "undoing every step gets back to the start");
+
+        history.redo();
+        history.redo();
+        check(afterMarket.matches(town) && !history.canRedo(), "redoing every step gets back to the end");
+
+        history.undo();
+        town.buyLand(1);
+        history.record("buying land");
+        check(!history.canRedo(), "a new step replaces undone ones");
+        history.undo();
+        check(afterGrain.matches(town), "undoing the new step goes back past the replaced one");
+    }
+
+    void checkRollback(Player& town)
+    {
+        TurnHistory history(town);
+        town.buyGrain(10);
+        history.record("buying grain");
+        std::size_t position = history.mark();
+        Snapshot marked(town);
+
+        town.buySoldiers(5);
+        history.record("buying soldiers");
+        town.buyAsset(MillAsset); // never recorded
+        history.rollback(position);
+        check(marked.matches(town), "rollback undoes recorded and unrecorded changes");
+        check(history.mark() == position && !history.canRedo(), "rolled back steps can't be redone");
+
+        checkThrows([&] {history.rollback(position + 1);}, "rollback past the end throws");
+    }
+
+    void checkBankruptcy(Player& town)
+    {
+        // a new town that starts at the limit, so any purchase goes past it
+        int stats[NUM_TOWN_STATS];
+        for (int stat = 0; stat < NUM_TOWN_STATS; ++stat) stats[stat] = town.getStat(static_cast<TownStat>(stat));
+        stats[GoldStat] = BANKRUPTCY_LIMIT;
+        town.startFrom(stats, 1);
+
+        TurnHistory history(town);
+        Snapshot before(town);
+
+        town.buySoldiers(1); // answers yes to going into debt
+        history.record("buying soldiers");
+        Snapshot after(town);
+        check(town.getBankruptcies() == before.stats[BankruptcyStat] + 1, "purchase past the limit goes bankrupt");
+
+        history.undo();
+        check(before.matches(town), "undo takes back the bankruptcy along with its seizures");
+        history.redo();
+        check(after.matches(town), "redo brings the bankruptcy back exactly as it happened");
+    }
+}
+
+int main()
+{
+    std::istringstream input("y\n"); // the only purchase that goes into debt is the one that goes bankrupt
+    input.exceptions(std::ios::eofbit); // any other question fails the test instead of waiting forever
+    std::ostream muted(nullptr);
+    GameContext game(input, muted);
+    game.seed(2018);
+    ContextScope scope(game);
+    Player town(game, "Test", "Town", MIN_DIFFICULTY);
+    checkUndoRedo(town);
+    checkRollback(town);
+
+    Player broke(game, "Test", "Town", MIN_DIFFICULTY);
+    checkBankruptcy(broke);
+
+    return testResult("town history");
+}
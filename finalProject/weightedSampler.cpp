@@ -0,0 +1,101 @@
+#ifndef WEIGHTEDSAMPLER_CPP
+#define WEIGHTEDSAMPLER_CPP
+
+#include <stdexcept>
+#include "weightedSampler.hpp"
+#include "gameContext.hpp" // random numbers
+
+AliasTable::AliasTable(const std::vector<double>& w)
+{
+    resize(w.size());
+    for (int i = 0; i < size(); ++i) setWeight(i, w[i]);
+    build();
+}
+
+void AliasTable::resize(int size)
+{
+    if (size < 0) throw std::logic_error("Error: Resizing an alias table to a negative size.");
+
+    weights.resize(size, 0);
+    stale = true;
+}
+
+void AliasTable::setWeight(int index, double weight)
+{
+    if (index < 0 || index >= size()) throw std::logic_error("Error: Setting the weight of an index outside of the alias table.");
+    if (weight < 0) throw std::logic_error("Error: Setting a negative weight in an alias table.");
+
+    weights[index] = weight;
+    stale = true;
+}
+
+double AliasTable::sum() const
+{
+    double added = 0;
+    for (double weight : weights) added += weight;
+    return added;
+}
+
+void AliasTable::build()
+{
+    total = sum();
+
+    const int count = size();
+    thresholds.assign(count, ALIAS_RESOLUTION);
+    aliases.resize(count);
+    for (int i = 0; i < count; ++i) aliases[i] = i;
+    stale = false;
+    if (total <= 0) return;
+
+    // each column holds an average weight, split the indexes into ones below and above it
+    std::vector<double> scaled(count);
+    std::vector<int> small, large;
+    int heaviest = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        if (weights[i] > weights[heaviest]) heaviest = i;
+        scaled[i] = weights[i] * count / total;
+        if (scaled[i] < 1) small.push_back(i);
+        else large.push_back(i);
+    }
+
+    // top up every small column with part of a large one, which goes back into the right list with what's left
+    while (!small.empty() && !large.empty())
+    {
+        int less = small.back(), more = large.back();
+        small.pop_back();
+
+        thresholds[less] = static_cast<int>(scaled[less] * ALIAS_RESOLUTION);
+        aliases[less] = more;
+        scaled[more] -= 1 - scaled[less];
+        if (scaled[more] < 1)
+        {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+    // whatever is left is full up to rounding, so it keeps its default threshold (unless rounding left behind an index that can't ever be drawn)
+    for (int less : small)
+        if (weights[less] == 0)
+        {
+            thresholds[less] = 0;
+            aliases[less] = heaviest;
+        }
+}
+
+int AliasTable::draw(GameContext& game)
+{
+    if (stale) build();
+    return static_cast<const AliasTable&>(*this).draw(game);
+}
+
+int AliasTable::draw(GameContext& game) const
+{
+    if (stale) throw std::logic_error("Error: Drawing from an alias table that hasn't been rebuilt since its weights changed.");
+    if (total <= 0) throw std::logic_error("Error: Drawing from an alias table without any weight.");
+
+    int column = game.random(0, size() - 1);
+    return game.random(0, ALIAS_RESOLUTION - 1) < thresholds[column] ? column : aliases[column];
+}
+
+#endif // WEIGHTEDSAMPLER_CPP
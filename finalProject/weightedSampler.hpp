@@ -0,0 +1,68 @@
+#ifndef WEIGHTEDSAMPLER_HPP
+#define WEIGHTEDSAMPLER_HPP
+
+/*
+Weighted sampler details
+    - Picks an index at random with odds proportional to its weight, for every weighted choice in the game
+        - Which world event gets scheduled for a town (see Player::worldEvents()), which town a bot invades (see invasionTarget() in the bot policy)
+    - Alias method (Vose): the weights get turned into a table with one column per index, each column holding a threshold and a second ("alias") index
+        - A draw picks a column evenly, then keeps it or takes its alias depending on a second random number against the threshold
+        - Two random numbers per draw however many choices there are, building the table takes a single pass over the weights
+    - Changing a weight only marks the table as stale, it gets rebuilt on the next draw (so any number of changes between draws cost one rebuild)
+        - Tables shared between threads have to be built up front (constructed from their weights) and drawn from as const
+    - Thresholds are whole numbers out of ALIAS_RESOLUTION so draws only need the game's integer random numbers (see GameContext::random())
+*/
+
+#include <vector>
+
+namespace /// constant parameters for the weighted sampler
+{
+    const int ALIAS_RESOLUTION = 1 << 30; // column thresholds are out of this
+}
+
+struct GameContext;
+
+class AliasTable
+{
+private:
+    std::vector<double> weights;
+    double total = 0; // as of the last build (see totalWeight())
+
+    std::vector<int> thresholds; // chance out of ALIAS_RESOLUTION of keeping each column
+    std::vector<int> aliases; // index drawn otherwise
+    bool stale = false; // weights changed since the last build
+
+    double sum() const;
+    // pre: N/A
+    // post: return the weights added up in index order (the same every time for the same weights, so a total of exactly 0 stays 0)
+
+    void build();
+    // pre: N/A
+    // post: rebuild the columns from the current weights
+
+public:
+    AliasTable() = default; // no choices
+    AliasTable(const std::vector<double>& w);
+    // pre: no negative weights
+    // post: table over the weights, built right away
+
+    void resize(int size);
+    // pre: size greater than or equal to 0
+    // post: keep the weights of the first size indexes, new indexes start out with a weight of 0
+    void setWeight(int index, double weight);
+    // pre: valid index, weight greater than or equal to 0
+    // post: change the index's weight (table rebuilt on the next draw)
+
+    int size() const {return weights.size();}
+    double getWeight(int index) const {return weights[index];}
+    double totalWeight() const {return stale ? sum() : total;} // counted from scratch, so it's 0 exactly when every weight is (draw() checks the same sum)
+
+    int draw(GameContext& game);
+    // pre: total weight above 0
+    // post: return a random index with odds of its weight out of the total weight, using the game's random numbers (rebuilds the table first if it's stale)
+    int draw(GameContext& game) const;
+    // pre: same as above, table not stale
+    // post: same as above, without rebuilding (safe from several threads at once)
+};
+
+#endif // WEIGHTEDSAMPLER_HPP
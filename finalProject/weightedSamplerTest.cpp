@@ -0,0 +1,128 @@
+/*
+Purpose: Check that alias tables draw every index as often as its weight says, never draw indexes without weight, and keep up with weight changes (see weightedSampler.hpp)
+Usage: weightedSamplerTest
+    - Draws from a game with a fixed seed, so every run checks the same draws
+    - Counts have to be within five standard deviations of what the weights say (wide enough that a correct table doesn't fail by chance), and exactly 0 for zero weights
+    - Returns 0 if every check passes, otherwise prints the ones that failed and returns 1
+*/
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include "weightedSampler.hpp"
+#include "gameContext.hpp"
+#include "testCheck.hpp"
+
+namespace
+{
+    const int NUM_DRAWS = 400000;
+
+    // draw many times and compare every index's count with its share of the total weight
+    void checkFrequencies(AliasTable& table, GameContext& game, const std::string& name)
+    {
+        std::vector<long> counts(table.size(), 0);
+        for (int i = 0; i < NUM_DRAWS; ++i) ++counts[table.draw(game)];
+
+        for (int i = 0; i < table.size(); ++i)
+        {
+            double chance = table.getWeight(i) / table.totalWeight();
+            std::string index = name + ": index " + std::to_string(i);
+            if (chance == 0)
+            {
+                check(counts[i] == 0, index + " has no weight but was drawn " + std::to_string(counts[i]) + " times");
+                continue;
+            }
+            double expected = chance * NUM_DRAWS, deviation = std::sqrt(NUM_DRAWS * chance * (1 - chance));
+            check(std::abs(counts[i] - expected) <= 5 * deviation + 1, index + " drawn " + std::to_string(counts[i]) + " times, expected about " + std::to_string(expected));
+        }
+    }
+
+    void checkWeights(GameContext& game)
+    {
+        AliasTable uneven({0, 1, 2, 0, 7, 0.5, 0});
+        checkFrequencies(uneven, game, "uneven weights with zeros");
+
+        AliasTable single({0, 0, 3, 0});
+        checkFrequencies(single, game, "one index with weight");
+
+        AliasTable even(std::vector<double>(10, 1));
+        checkFrequencies(even, game, "even weights");
+
+        AliasTable skewed({1000, 1, 0, 1, 0.01});
+        checkFrequencies(skewed, game, "skewed weights");
+
+        AliasTable zerosFirst({0, 0, 0, 0, 0, 0, 1, 1});
+        checkFrequencies(zerosFirst, game, "zeros before every weighted index");
+    }
+
+    void checkChanges(GameContext& game)
+    {
+        AliasTable table({5, 1, 1});
+        checkFrequencies(table, game, "before changes");
+
+        table.setWeight(0, 0); // the heaviest index drops out
+        table.setWeight(2, 4);
+        checkFrequencies(table, game, "after changing weights");
+
+        table.resize(5); // new indexes start without weight
+        check(table.getWeight(3) == 0 && table.getWeight(4) == 0, "new indexes start out with a weight of 0");
+        table.setWeight(4, 5);
+        checkFrequencies(table, game, "after growing");
+
+        table.resize(2);
+        check(std::abs(table.totalWeight() - 1) < 1e-9, "shrinking takes away the dropped weights");
+        checkFrequencies(table, game, "after shrinking");
+    }
+
+    void checkClearedWeights(GameContext& game)
+    {
+        // weights that don't add up exactly in floating point, then cleared again, like invasion odds when every town left is out of reach
+        AliasTable table;
+        table.resize(3);
+        table.setWeight(0, 0.3);
+        table.setWeight(1, 1.7 / 3);
+        table.setWeight(2, 2.9 / 7);
+        table.draw(game);
+        for (int i = 0; i < 3; ++i) table.setWeight(i, 0);
+        check(table.totalWeight() == 0, "clearing every weight gives a total of exactly 0, not " + std::to_string(table.totalWeight()));
+
+        // reused at a different size, the way a table kept between turns gets used
+        table.resize(5);
+        table.setWeight(3, 1.1 / 9);
+        table.resize(4);
+        table.setWeight(3, 0);
+        check(table.totalWeight() == 0, "shrinking and clearing gives a total of exactly 0");
+
+        table.setWeight(1, 2);
+        checkFrequencies(table, game, "after clearing every weight and setting one");
+    }
+
+    void checkErrors(GameContext& game)
+    {
+        AliasTable empty({0, 0});
+        checkThrows([&] {empty.draw(game);}, "drawing without any weight throws");
+
+        checkThrows([&] {empty.setWeight(0, -1);}, "a negative weight throws");
+
+        checkThrows([&] {empty.setWeight(2, 1);}, "a weight outside the table throws");
+
+        empty.setWeight(1, 1);
+        checkThrows([&] {static_cast<const AliasTable&>(empty).draw(game);}, "drawing from a stale table as const throws");
+    }
+}
+
+int main()
+{
+    std::istringstream noInput;
+    std::ostream muted(nullptr);
+    GameContext game(noInput, muted);
+    game.seed(2018);
+
+    checkWeights(game);
+    checkChanges(game);
+    checkClearedWeights(game);
+    checkErrors(game);
+
+    return testResult("weighted sampler");
+}
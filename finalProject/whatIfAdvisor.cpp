@@ -0,0 +1,138 @@
+#ifndef WHATIFADVISOR_CPP
+#define WHATIFADVISOR_CPP
+
+#include <algorithm>
+#include <cmath>
+#include "whatIfAdvisor.hpp"
+#include "player.hpp"
+
+namespace
+{
+    // standard bundles (see addStandardBundles())
+    const int NUM_GRAIN_STEPS = 8;
+    const int GRAIN_STEPS[NUM_GRAIN_STEPS] = {-2000, -1000, -500, 0, 500, 1000, 2500, 5000};
+    const int NUM_LAND_STEPS = 8;
+    const int LAND_STEPS[NUM_LAND_STEPS] = {-1000, -500, -250, 0, 250, 500, 1000, 2500};
+    const int MAX_ADVISED_ASSETS = 2; // most of a single asset type in a standard bundle
+
+    const unsigned int PROJECTION_SEED = 2018; // first of the seeds every bundle's years get played out with
+
+    // the bundle's decisions (sales first, then purchases), the grain release the serfs need, and the year end
+    void playYear(Player& town, const WhatIfBundle& bundle)
+    {
+        if (bundle.grain < 0) town.sellGrain(-bundle.grain);
+        if (bundle.land < 0) town.sellLand(-bundle.land);
+        if (bundle.grain > 0) town.buyGrain(bundle.grain);
+        if (bundle.land > 0) town.buyLand(bundle.land);
+        for (int a = 0; a < NUM_ASSETS; ++a)
+            for (int n = 0; n < bundle.assets[a]; ++n) town.buyAsset(static_cast<AssetType>(a)); // asks for confirmation (which fails the try) once it would go into debt
+
+        int needed = town.grainDemand() - town.getReleasedGrain();
+        town.releaseGrain(std::min(std::max(needed, town.minRelease()), town.maxRelease()));
+        town.turnResults();
+    }
+
+    void describeAmount(std::string& text, int amount, const std::string& good)
+    {
+        if (amount == 0) return;
+        if (!text.empty()) text += ", ";
+        text += (amount > 0 ? "buy " : "sell ") + std::to_string(std::abs(amount)) + ' ' + good;
+    }
+}
+
+std::string describeBundle(const WhatIfBundle& bundle)
+{
+    std::string text;
+    describeAmount(text, bundle.grain, "grain");
+    describeAmount(text, bundle.land, "land");
+    for (int a = 0; a < NUM_ASSETS; ++a)
+        describeAmount(text, bundle.assets[a], bundle.assets[a] > 1 ? ASSETS[a].plural : ASSETS[a].name);
+    return text.empty() ? "do nothing" : text;
+}
+
+WhatIfBatch::WhatIfBatch(const Player& town)
+: sandbox(town),
+  grainSellable(town.getGrain() > MIN_GRAIN ? town.getGrain() - MIN_GRAIN : 0),
+  landSellable(town.getLand() > MIN_LAND ? town.getLand() - MIN_LAND : 0)
+{
+}
+
+void WhatIfBatch::add(const WhatIfBundle& bundle)
+{
+    bundles.push_back(bundle);
+}
+
+void WhatIfBatch::addStandardBundles()
+{
+    add(WhatIfBundle()); // doing nothing comes first
+
+    for (int g = 0; g < NUM_GRAIN_STEPS; ++g)
+        for (int l = 0; l < NUM_LAND_STEPS; ++l)
+        {
+            WhatIfBundle bundle;
+            bundle.grain = GRAIN_STEPS[g];
+            bundle.land = LAND_STEPS[l];
+            if (bundle.grain != 0 || bundle.land != 0) add(bundle); // no assets
+
+            for (int a = 0; a < NUM_ASSETS; ++a)
+                for (int count = 1; count <= MAX_ADVISED_ASSETS; ++count)
+                {
+                    WhatIfBundle withAsset = bundle;
+                    withAsset.assets[a] = count;
+                    add(withAsset);
+                }
+        }
+}
+
+bool WhatIfBatch::allowed(const WhatIfBundle& bundle) const
+{
+    // same limits as goodsMenu()
+    return bundle.grain <= GRAIN_PURCHASE_LIMIT && bundle.land <= LAND_PURCHASE_LIMIT
+        && -bundle.grain <= grainSellable && -bundle.land <= landSellable;
+}
+
+void WhatIfBatch::compute()
+{
+    const int count = size();
+    scores.assign(count, 0);
+    cash.assign(count, 0);
+
+    for (int i = 0; i < count; ++i)
+    {
+        const WhatIfBundle& bundle = bundles[i];
+        bool possible = allowed(bundle);
+        for (int sample = 0; possible && sample < ADVISOR_SAMPLES; ++sample)
+        {
+            possible = sandbox.tryOut([&](Player& town) {playYear(town, bundle);}, PROJECTION_SEED + sample);
+            if (!possible) break;
+
+            const Player& town = sandbox.getTown();
+            scores[i] += static_cast<float>(town.getScore()) / ADVISOR_SAMPLES;
+            cash[i] += static_cast<float>(town.getGold()) / ADVISOR_SAMPLES;
+        }
+        if (!possible) scores[i] = -HUGE_VALF;
+    }
+}
+
+bool WhatIfBatch::possible(int i) const
+{
+    return scores[i] > -HUGE_VALF;
+}
+
+std::vector<int> WhatIfBatch::best(int count) const
+{
+    std::vector<int> order;
+    for (int i = 0; i < size(); ++i) if (possible(i)) order.push_back(i);
+
+    if (count > static_cast<int>(order.size())) count = order.size();
+    std::partial_sort(order.begin(), order.begin() + count, order.end(), [&](int a, int b)
+    {
+        if (scores[a] != scores[b]) return scores[a] > scores[b];
+        if (cash[a] != cash[b]) return cash[a] > cash[b];
+        return a < b;
+    });
+    order.resize(count);
+    return order;
+}
+
+#endif // WHATIFADVISOR_CPP
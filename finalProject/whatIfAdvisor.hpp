@@ -0,0 +1,74 @@
+#ifndef WHATIFADVISOR_HPP
+#define WHATIFADVISOR_HPP
+
+/*
+What-if advisor details
+    - Ranks bundles of decisions (buying or selling grain and land, buying assets) by where they're projected to leave the town at the end of next year
+        - Shown in the goods and asset menus, so players can see what their gold would do best before spending it (see advisorPanel() in the game flow)
+    - Projections play the decisions and the year end out on a copy of the town (see TownSandbox), so they follow the same rules as the game itself
+        - World events already on their way, harvest losses, bankruptcy, and rounding all count, and any change to the year end shows up here too
+        - Assumes the player releases the grain their serfs need (as far as the release limits allow), since the release comes after these decisions
+        - Every bundle gets the average of ADVISOR_SAMPLES years, with the same rolls for every bundle (fixed seeds), so bundles only differ by their decisions and results are the same every time for the same town
+        - Invasions aren't part of the projection
+    - The town gets cloned into the batch once, and every bundle is only stored as its decisions
+        - The standard set covers every mix of a grain amount, a land amount, and an asset purchase (several hundred bundles, a few milliseconds in all)
+    - Bundles that would need the player's confirmation (going into debt) or break the menus' purchase and sale limits don't get ranked
+*/
+
+#include <string>
+#include <vector>
+#include "parameters.hpp"
+#include "townHistory.hpp" // town sandbox
+
+struct WhatIfBundle // decisions made together during a turn
+{
+    int grain = 0; // bought (sold if negative)
+    int land = 0;
+    int assets[NUM_ASSETS] = {}; // bought, by AssetType
+};
+
+std::string describeBundle(const WhatIfBundle& bundle);
+// pre: N/A
+// post: return the bundle's decisions as a short phrase for program output ("buy 500 grain, buy 1 mill"), "do nothing" if there aren't any
+
+class WhatIfBatch
+{
+private:
+    TownSandbox sandbox; // the cloned town
+    int grainSellable, landSellable; // most the goods menu lets the town sell
+
+    std::vector<WhatIfBundle> bundles;
+    std::vector<float> scores, cash; // results, one entry per bundle, -HUGE_VALF score for bundles that can't be made
+
+    bool allowed(const WhatIfBundle& bundle) const;
+    // pre: N/A
+    // post: return true if the menus would let the player make every decision in the bundle
+
+public:
+    WhatIfBatch(const Player& town);
+    // pre: player object initialized
+    // post: empty batch over a clone of the town's current stats (later changes to the town don't affect the batch)
+
+    void add(const WhatIfBundle& bundle);
+    // pre: N/A
+    // post: append the bundle to the batch (bundle index is the old size())
+    void addStandardBundles();
+    // pre: N/A
+    // post: append doing nothing, followed by every other mix of the standard grain amounts, land amounts, and asset purchases
+
+    void compute();
+    // pre: the town's game hasn't ended
+    // post: project the town's score and gold at the end of next year for every bundle in the batch
+
+    int size() const {return bundles.size();}
+    const WhatIfBundle& getBundle(int i) const {return bundles[i];}
+    bool possible(int i) const; // pre: compute() called since the bundle was added
+    float getScore(int i) const {return scores[i];}
+    float getCash(int i) const {return cash[i];}
+
+    std::vector<int> best(int count) const;
+    // pre: compute() called since the last bundle was added
+    // post: return the indexes of up to count possible bundles with the highest projected score (most gold on ties), best first
+};
+
+#endif // WHATIFADVISOR_HPP
@@ -0,0 +1,268 @@
+/*
+Purpose: Estimate the chances that a bot of each difficulty reaches the top rank before its ruler dies, that it ends a year in debt, and that it breaks the game's formulas, to a given precision, playing only as many games as that takes
+Usage: winEstimator [interval width] [confidence] [most games] [threads] [random seed]
+    - Games are like tournament games (TOURNAMENT_TOWNS policy table bots each, including random invasions of each other), played on every thread at once
+    - Games get played in batches, doubling in size every batch, and every difficulty's estimate gets checked after each one (sequential stopping)
+        - Each estimate comes with a Wilson score interval, and is done once its interval is narrower than the given width
+        - Every game has the same mix of difficulties however many estimates are done (rivals change how a town does), done estimates just stop getting checked
+        - Checking after every batch would make intervals miss more often than the confidence says, so check k only gets (1 - confidence) / (k * (k + 1)) of the allowed misses
+          (adding up to 1 - confidence over every check, so the final intervals hold at the given confidence however many checks it took)
+    - Stops once every difficulty is done or the most games have been played, then reports every estimate with how many towns it took
+        - Along with how many towns a fixed-size run would have needed (sized up front for the worst case, a chance of one half)
+    - Towns that break the game's formulas are an outcome of their own, with its own estimate (they count as towns for every estimate, and stop where they broke)
+*/
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include "player.hpp"
+#include "botPolicy.hpp"
+#include "gameContext.hpp" // each game's own state
+#include "helperFunctions.hpp"
+
+namespace
+{
+    const long FIRST_BATCH = 64; // games in the first batch, doubling every batch after
+
+    enum Metric {WinMetric, DebtMetric, BrokenMetric};
+    const int NUM_METRICS = 3;
+    const std::string METRIC_NAMES[NUM_METRICS] = {"Reached top rank", "Ended a year in debt", "Broke the formulas"};
+    const int NUM_DIFFICULTIES = MAX_DIFFICULTY - MIN_DIFFICULTY + 1;
+
+    struct Tally // towns of one difficulty
+    {
+        long towns = 0;
+        long wins = 0; // reached the top rank
+        long debt = 0; // ended at least one year in debt
+        long years = 0; // town-years played
+        long broken = 0; // grew past what the game's formulas can handle
+
+        long count(Metric metric) const {return metric == WinMetric ? wins : metric == DebtMetric ? debt : broken;}
+
+        void add(const Tally& other)
+        {
+            towns += other.towns;
+            wins += other.wins;
+            debt += other.debt;
+            years += other.years;
+            broken += other.broken;
+        }
+    };
+
+    struct Interval
+    {
+        double estimate, low, high;
+        long towns; // the estimate's sample size
+        double width() const {return high - low;}
+    };
+
+    // two-sided standard normal quantile, found by bisection (only needed once per check)
+    double normalQuantile(double p)
+    {
+        double low = -40, high = 40;
+        for (int i = 0; i < 200; ++i)
+        {
+            double middle = (low + high) / 2;
+            if (0.5 * std::erfc(-middle / std::sqrt(2.0)) < p) low = middle;
+            else high = middle;
+        }
+        return (low + high) / 2;
+    }
+
+    Interval wilsonInterval(long wins, long towns, double z)
+    {
+        if (towns == 0) return {0.5, 0, 1, 0};
+        double n = towns, p = wins / n, z2 = z * z;
+        double center = (p + z2 / (2 * n)) / (1 + z2 / n);
+        double half = z / (1 + z2 / n) * std::sqrt(p * (1 - p) / n + z2 / (4 * n * n));
+        return {p, std::max(0.0, center - half), std::min(1.0, center + half), towns};
+    }
+
+    // play a single game of policy bots with the given difficulties (in its own context, with its own random numbers), adding every town to its difficulty's tally
+    void playEstimatorGame(const std::vector<int>& difficulties, unsigned int seed, Tally tallies[MAX_DIFFICULTY])
+    {
+        // towns' own output isn't needed
+        std::istringstream noInput;
+        std::ostream muted(nullptr);
+        GameContext game(noInput, muted);
+        game.seed(seed); // every game plays out the same whichever thread takes it
+        ContextScope scope(game);
+
+        playerVector& towns = game.bots;
+        for (int difficulty : difficulties) towns.push_back(new Player(game, "Bot", "Town", difficulty)); // deleted along with the game
+
+        std::vector<bool> broken(towns.size(), false);
+        std::vector<bool> inDebt(towns.size(), false);
+        std::vector<int> firstYear(towns.size());
+        for (std::size_t i = 0; i < towns.size(); ++i) firstYear[i] = towns[i]->getYear();
+
+        bool playing;
+        do
+        {
+            playing = false;
+            for (std::size_t i = 0; i < towns.size(); ++i)
+            {
+                Player* town = towns[i];
+                if (broken[i] || town->gameEnded()) continue;
+                playing = true;
+
+                try
+                {
+                    // same turn as botActions() for policy bots
+                    applyPolicyAction(*town, policyAction(*town));
+                    if (rollChance(game.botAggression, 100))
+                    {
+                        Player* target = invasionTarget(*town, towns);
+                        if (target) town->invade(target);
+                    }
+                    applyRelease(*town, SolverRelease);
+                    town->turnResults();
+                    if (town->getGold() < 0) inDebt[i] = true;
+                }
+                catch (FormulaOverflow&) {broken[i] = true;} // stops where it broke
+            }
+        } while (playing);
+
+        for (std::size_t i = 0; i < towns.size(); ++i)
+        {
+            Tally& tally = tallies[towns[i]->getDifficulty() - 1];
+            ++tally.towns;
+            if (broken[i]) ++tally.broken;
+            if (towns[i]->won()) ++tally.wins;
+            if (inDebt[i]) ++tally.debt;
+            tally.years += towns[i]->getYear() - firstYear[i];
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // take settings from command line
+    const char* usage = "Usage: winEstimator [interval width] [confidence] [most games] [threads] [random seed]\n";
+    double targetWidth, confidence;
+    long maxGames;
+    int numThreads;
+    unsigned int seed;
+    try
+    {
+        targetWidth = argc > 1 ? std::stod(argv[1]) : 0.02;
+        confidence = argc > 2 ? std::stod(argv[2]) : 0.95;
+        maxGames = argc > 3 ? std::stol(argv[3]) : 1000000;
+        numThreads = argc > 4 ? std::stoi(argv[4]) : std::thread::hardware_concurrency();
+        seed = argc > 5 ? std::stoul(argv[5]) : 2018;
+    }
+    catch (std::logic_error&) // invalid_argument or out_of_range
+    {
+        std::cerr << "Settings have to be numbers in range.\n" << usage;
+        return 1;
+    }
+    if (targetWidth <= 0 || confidence <= 0 || confidence >= 1)
+    {
+        std::cerr << "Interval width has to be above 0 and confidence between 0 and 1.\n" << usage;
+        return 1;
+    }
+    if (numThreads < 1) numThreads = 1;
+
+    std::cout << "Estimating win chances to within " << targetWidth << " at " << confidence * 100 << "% confidence, playing at most "
+              << maxGames << " games of " << static_cast<int>(TOURNAMENT_TOWNS) << " bots on " << numThreads << " threads\n\n";
+
+    Tally totals[MAX_DIFFICULTY];
+    bool done[MAX_DIFFICULTY][NUM_METRICS] = {};
+    Interval intervals[MAX_DIFFICULTY][NUM_METRICS] = {};
+    long gamesPlayed = 0, batch = FIRST_BATCH;
+    int check = 0;
+
+    std::cout << std::fixed << std::setprecision(4);
+    while (gamesPlayed < maxGames)
+    {
+        // difficulties with estimates that still need checking (every game still gets every difficulty)
+        std::vector<int> active;
+        for (int difficulty = MIN_DIFFICULTY; difficulty <= MAX_DIFFICULTY; ++difficulty)
+        {
+            bool needed = false;
+            for (int metric = 0; metric < NUM_METRICS; ++metric) if (!done[difficulty - 1][metric]) needed = true;
+            if (needed) active.push_back(difficulty);
+        }
+        if (active.empty()) break;
+        if (batch > maxGames - gamesPlayed) batch = maxGames - gamesPlayed;
+
+        // every thread plays games until there are none left in the batch, keeping its own tallies
+        std::vector<std::vector<Tally>> threadTallies(numThreads, std::vector<Tally>(MAX_DIFFICULTY));
+        std::atomic<long> nextGame(0);
+        const long first = gamesPlayed;
+        auto playGames = [&](int thread)
+        {
+            std::vector<int> difficulties(TOURNAMENT_TOWNS);
+            for (long game = nextGame++; game < batch; game = nextGame++)
+            {
+                long index = first + game; // same games for the same seed however many threads play them
+                for (int i = 0; i < TOURNAMENT_TOWNS; ++i) difficulties[i] = MIN_DIFFICULTY + (index * TOURNAMENT_TOWNS + i) % NUM_DIFFICULTIES;
+                playEstimatorGame(difficulties, seed + index, threadTallies[thread].data());
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i) threads.emplace_back(playGames, i);
+        for (std::thread& t : threads) t.join();
+        for (const std::vector<Tally>& tallies : threadTallies)
+            for (int d = 0; d < MAX_DIFFICULTY; ++d) totals[d].add(tallies[d]);
+        gamesPlayed += batch;
+        batch *= 2;
+
+        // check every unfinished estimate with this check's share of the allowed misses
+        ++check;
+        double alpha = (1 - confidence) / (check * (check + 1.0));
+        double z = normalQuantile(1 - alpha / 2);
+        std::cout << "Check " << std::setw(2) << check << " after " << std::setw(8) << gamesPlayed << " games (z = " << std::setprecision(2) << z << std::setprecision(4) << "):\n";
+        for (int difficulty : active)
+        {
+            std::cout << "    difficulty " << difficulty << ':';
+            for (int metric = 0; metric < NUM_METRICS; ++metric)
+            {
+                if (done[difficulty - 1][metric]) continue;
+                const Tally& tally = totals[difficulty - 1];
+                Interval& interval = intervals[difficulty - 1][metric];
+                interval = wilsonInterval(tally.count(static_cast<Metric>(metric)), tally.towns, z);
+                if (interval.width() < targetWidth) done[difficulty - 1][metric] = true;
+                std::cout << "  " << METRIC_NAMES[metric] << ' ' << interval.estimate << " +/- " << interval.width() / 2 << (done[difficulty - 1][metric] ? " (done)" : "");
+            }
+            std::cout << '\n';
+        }
+    }
+
+    // report every estimate
+    std::cout << "\nDifficulty  Estimate                    Towns   Chance    Interval            Status\n";
+    long towns = 0, townYears = 0, broken = 0;
+    for (int difficulty = MIN_DIFFICULTY; difficulty <= MAX_DIFFICULTY; ++difficulty)
+    {
+        const Tally& tally = totals[difficulty - 1];
+        towns += tally.towns;
+        townYears += tally.years;
+        broken += tally.broken;
+
+        for (int metric = 0; metric < NUM_METRICS; ++metric)
+        {
+            const Interval& interval = intervals[difficulty - 1][metric];
+            std::cout << std::setw(10) << difficulty << "  " << std::left << std::setw(22) << METRIC_NAMES[metric] << std::right
+                      << std::setw(11) << interval.towns << std::setw(9) << interval.estimate << "   [" << interval.low << ", " << interval.high << "]   "
+                      << (done[difficulty - 1][metric] ? "done" : "out of games") << '\n';
+        }
+    }
+
+    // a fixed-size run has to be big enough for a chance of one half, checked once at the plain confidence
+    double z = normalQuantile(1 - (1 - confidence) / 2);
+    long fixedTowns = static_cast<long>(std::ceil(z * z / (targetWidth * targetWidth))) * NUM_DIFFICULTIES;
+
+    std::cout << '\n' << gamesPlayed << " games, " << towns << " towns, " << townYears << " town-years played\n"
+              << "A fixed-size run would need about " << fixedTowns << " towns (" << std::setprecision(1) << static_cast<double>(fixedTowns) / std::max(towns, 1L) << " times as many)\n";
+    if (broken > 0) std::cout << broken << " towns broke the game's formulas (counted in every estimate, see above for each difficulty)\n";
+
+    return 0;
+}